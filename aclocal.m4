@@ -1183,6 +1183,7 @@ m4_include([m4/configure_hdf5.m4])
 m4_include([m4/configure_hypre.m4])
 m4_include([m4/configure_libmesh.m4])
 m4_include([m4/configure_muparser.m4])
+m4_include([m4/configure_openmp.m4])
 m4_include([m4/configure_petsc.m4])
 m4_include([m4/configure_samrai.m4])
 m4_include([m4/configure_silo.m4])
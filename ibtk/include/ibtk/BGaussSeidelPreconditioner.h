@@ -316,6 +316,12 @@ private:
      */
     std::map<unsigned int, std::vector<SAMRAI::tbox::Pointer<LinearOperator> > > d_linear_ops_map;
 
+    /*!
+     * Scratch copy of the right-hand-side vector, allocated by
+     * initializeSolverState() and kept until deallocateSolverState().
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_f;
+
     /*!
      * Parameters to specify the ordering of the application of the component
      * preconditioners.
@@ -162,6 +162,23 @@ public:
      */
     const std::string& getPatternName() const override;
 
+    /*!
+     * Returns whether the overlaps include the interior of the destination
+     * patch on the target level.
+     */
+    bool getIncludeDstPatchBox() const;
+
+    /*!
+     * Returns whether the overlaps include edges on the target level.
+     */
+    bool getIncludeEdgesOnDstLevel() const;
+
+    /*!
+     * Returns whether the overlaps include edges on levels other than the
+     * target level.
+     */
+    bool getIncludeEdgesOnSrcLevel() const;
+
 private:
     /*!
      * \brief Default constructor.
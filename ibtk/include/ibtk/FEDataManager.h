@@ -112,6 +112,10 @@ namespace IBTK
  * construction through the FEDataManager::WorkloadSpec object, which contains
  * reasonable defaults.
  *
+ * \note FEDataManager requires a replicated mesh (e.g., libMesh::ReplicatedMesh,
+ * which is the default libMesh::Mesh unless libMesh is configured with
+ * --enable-parmesh).  Distributed meshes are not supported.
+ *
  * \note Multiple FEDataManager objects may be instantiated simultaneously.
  */
 class FEDataManager : public SAMRAI::tbox::Serializable, public SAMRAI::mesh::StandardTagAndInitStrategy<NDIM>
@@ -787,12 +791,20 @@ private:
     void updateQuadPointCountData(int coarsest_ln, int finest_ln);
 
     /*!
-     * Compute the bounding boxes of all active elements.
+     * Compute the bounding boxes of those active elements that may intersect a
+     * local Cartesian grid patch on the specified level grown by the specified
+     * ghost cell width.
+     *
+     * Each process computes the bounding boxes of its local active elements
+     * and sends each box only to those processes that own a patch that the
+     * box may intersect.  The boxes received by this process (including those
+     * of its own elements) are stored in d_active_elem_bboxes, and the
+     * corresponding element ids are stored in d_active_elem_bbox_ids.
      *
-     * \note For inactive elements, the lower and upper bound values will be
-     * identically zero.
+     * \note The received element ids are resolved through the local copy of
+     * the mesh, so the mesh must be replicated on every process.
      */
-    std::vector<std::pair<Point, Point> >* computeActiveElementBoundingBoxes();
+    void computeActiveElementBoundingBoxes(int level_number, const SAMRAI::hier::IntVector<NDIM>& ghost_width);
 
     /*!
      * Collect all of the active elements which are located within a local
@@ -936,6 +948,7 @@ private:
     std::vector<std::vector<libMesh::Elem*> > d_active_patch_elem_map;
     std::vector<std::vector<libMesh::Node*> > d_active_patch_node_map;
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
+    std::vector<unsigned int> d_active_elem_bbox_ids;
     std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
 
     /*
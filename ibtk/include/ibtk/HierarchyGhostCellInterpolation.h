@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -89,6 +90,14 @@ namespace IBTK
  * \note In cases where physical boundary conditions are set via extrapolation
  * from interior values, setting ghost cell values may require both coarsening
  * and refining.
+ *
+ * \note Communication schedules are cached for each collection of transaction
+ * components passed to resetTransactionComponents(), so that switching back to
+ * a previously used collection of transaction components does not require the
+ * schedules to be recomputed.  At most getMaxScheduleCacheSize() collections
+ * are cached; when the cache is full, the least recently used schedules are
+ * discarded.  The cache is cleared whenever the operator state is
+ * (re)initialized or deallocated.
  */
 class HierarchyGhostCellInterpolation : public SAMRAI::tbox::DescribedClass
 {
@@ -337,6 +346,24 @@ public:
      */
     void fillData(double fill_time);
 
+    /*!
+     * \return The number of times that resetTransactionComponents() has reused
+     * cached communication schedules.
+     */
+    int getNumberOfScheduleCacheHits() const;
+
+    /*!
+     * \return The number of times that communication schedules have been
+     * created for a new collection of transaction components.
+     */
+    int getNumberOfScheduleCacheMisses() const;
+
+    /*!
+     * \return The maximum number of collections of transaction components for
+     * which communication schedules are cached.
+     */
+    static unsigned int getMaxScheduleCacheSize();
+
 protected:
 private:
     /*!
@@ -359,6 +386,34 @@ private:
      */
     HierarchyGhostCellInterpolation& operator=(const HierarchyGhostCellInterpolation& that) = delete;
 
+    /*!
+     * \brief Return the key used to identify the communication schedules
+     * associated with a collection of transaction components.
+     *
+     * The key depends on the source and destination data indices, the refine
+     * and coarsen operators, the coarse-fine and physical boundary treatments,
+     * and the fill patterns of the transaction components.
+     */
+    static std::string getScheduleCacheKey(const std::vector<InterpolationTransactionComponent>& transaction_comps);
+
+    /*!
+     * \brief Return the part of the schedule cache key that identifies a fill
+     * pattern.
+     *
+     * Fill patterns provided by SAMRAI and IBTK are identified by their types
+     * and parameters (e.g., the stencil width), so that equivalent fill
+     * patterns allocated for different transaction components share cached
+     * schedules.  Other fill patterns are identified by their addresses.
+     */
+    static std::string getFillPatternKey(SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > fill_pattern);
+
+    /*!
+     * \brief Store the active communication algorithms and schedules in the
+     * cache using the specified key, discarding the least recently used cache
+     * entry if the cache is full.
+     */
+    void cacheSchedules(const std::string& cache_key);
+
     // Boolean indicating whether the operator is initialized.
     bool d_is_initialized = false;
 
@@ -383,6 +438,20 @@ private:
     SAMRAI::xfer::RefinePatchStrategy<NDIM>* d_refine_strategy = nullptr;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
 
+    // Communication schedules for each collection of transaction components
+    // that has been used since the operator state was last initialized.
+    struct ScheduleCacheEntry
+    {
+        SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > coarsen_alg;
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > coarsen_scheds;
+        SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > refine_alg;
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > refine_scheds;
+        unsigned int last_use = 0;
+    };
+    std::map<std::string, ScheduleCacheEntry> d_schedule_cache;
+    unsigned int d_schedule_cache_use_count = 0;
+    int d_schedule_cache_hits = 0, d_schedule_cache_misses = 0;
+
     // Cached coarse-fine boundary and physical boundary condition handlers.
     std::vector<SAMRAI::tbox::Pointer<CoarseFineBoundaryRefinePatchStrategy> > d_cf_bdry_ops;
     std::vector<SAMRAI::tbox::Pointer<CartExtrapPhysBdryOp> > d_extrap_bc_ops;
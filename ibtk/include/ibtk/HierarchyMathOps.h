@@ -1026,6 +1026,42 @@ public:
                     int src2_idx = -1,
                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
 
+    /*!
+     * \brief Compute the action of the staggered-grid Stokes operator using a
+     * single fused sweep over each patch.
+     *
+     * Sets dst1 = C src1 + div D grad src1 + grad src2 + gamma src3 and dst2 =
+     * -div src1, in which src1 is the side-centered velocity and src2 is the
+     * cell-centered pressure.  The result is the same as that obtained by
+     * calling grad() without synchronization, then laplace(), and then div()
+     * with coarse-fine interface synchronization of src1.
+     *
+     * If C and D are both zero, the Laplacian term is skipped.  This allows
+     * operators with variable coefficients to compute that term separately,
+     * e.g., via vc_laplace(), and to pass it as src3.
+     *
+     * \note The present implementation of this operator \em requires that
+     * damping factor C and diffusivity D be spatially constant and
+     * scalar-valued.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void stokes(int dst1_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst1_var,
+                int dst2_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > dst2_var,
+                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                int src1_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src1_var,
+                int src2_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src2_var,
+                SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                double src_ghost_fill_time,
+                double gamma = 0.0,
+                int src3_idx = -1,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src3_var = NULL);
+
     /*!
      * \brief Compute dst = alpha src1 + beta src2, pointwise.
      *
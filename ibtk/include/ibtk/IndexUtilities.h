@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
@@ -197,6 +198,28 @@ public:
                                                            const SAMRAI::hier::Box<NDIM>& patch_box,
                                                            const SAMRAI::hier::IntVector<NDIM>& box_size,
                                                            const SAMRAI::hier::IntVector<NDIM>& overlap_size);
+
+    /*!
+     * \return The position of the index \em i along a Morton (Z-order) curve
+     * over the index space with lower corner \em lower.
+     *
+     * \note The index \em i must satisfy lower <= i < lower + 2^(64/NDIM) in
+     * each coordinate direction.
+     */
+    static std::uint64_t getMortonIndex(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& lower);
+
+    /*!
+     * \return The position of the index \em i along a Hilbert curve over the
+     * index space with lower corner \em lower and extents 2^num_bits in each
+     * coordinate direction.
+     *
+     * \note The index \em i must satisfy lower <= i < lower + 2^num_bits in
+     * each coordinate direction, and num_bits must not exceed 64/NDIM.
+     */
+    static std::uint64_t getHilbertIndex(const SAMRAI::hier::Index<NDIM>& i,
+                                         const SAMRAI::hier::Index<NDIM>& lower,
+                                         int num_bits);
+
 private:
     /*!
      * \brief Default constructor.
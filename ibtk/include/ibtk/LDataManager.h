@@ -60,6 +60,7 @@
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscao.h"
 #include "petscvec.h"
@@ -204,6 +205,77 @@ public:
      */
     const std::string& getDefaultSpreadKernelFunction() const;
 
+    /*!
+     * \brief Set the ordering of the local Lagrangian nodes used when
+     * redistributing the nodes.
+     *
+     * The local nodes owned by each patch are always assigned contiguous local
+     * PETSc indices.  With the default PATCH_LNODE_ORDERING, the nodes of each
+     * patch are numbered in the order in which they are stored in the patch
+     * data.  With MORTON_LNODE_ORDERING or HILBERT_LNODE_ORDERING, the nodes of
+     * each patch are instead numbered along a Morton or Hilbert curve over the
+     * cell indices of the patch, and the indices cached by each LNodeSetData
+     * object are sorted by local PETSc index.  Consequently, the interpolation
+     * and spreading kernels visit nearby grid cells and nearby entries of the
+     * Lagrangian data arrays consecutively.
+     *
+     * \note The new ordering takes effect the next time endDataRedistribution()
+     * is called.
+     */
+    void setNodeOrdering(LNodeOrderingType node_ordering);
+
+    /*!
+     * \brief Return the ordering of the local Lagrangian nodes used when
+     * redistributing the nodes.
+     */
+    LNodeOrderingType getNodeOrdering() const;
+
+    /*!
+     * \brief Enable or disable the shortcut that skips the full redistribution
+     * of levels on which no Lagrangian node changed patches.
+     *
+     * When this option is enabled, endDataRedistribution() checks each level
+     * for which (1) the patch level was not regenerated since the call to
+     * beginDataRedistribution(), (2) no structures were displaced, and (3) no
+     * node changed the patch whose interior contains it.  For such levels, the
+     * application ordering, the local PETSc ordering, and the local parts of
+     * the LData objects are kept as is, and only the nonlocal (ghost) nodes are
+     * renumbered.  New PETSc Vec objects are created only if the set of ghost
+     * nodes changed.  All other levels are redistributed from scratch.
+     *
+     * \note This option does not migrate individual nodes between processes:
+     * if any node on a level changes patches, the whole level is redistributed.
+     * Moreover, regridding regenerates all levels finer than the coarsest
+     * level, so this shortcut generally applies only to the coarsest level or
+     * to calls to beginDataRedistribution() and endDataRedistribution() that
+     * are not accompanied by a regrid.  By default, this option is disabled.
+     *
+     * \note Nodes that remain in the same patch keep their local PETSc indices,
+     * so with MORTON_LNODE_ORDERING or HILBERT_LNODE_ORDERING the local nodes
+     * are only re-sorted along the curve when a level is redistributed from
+     * scratch.
+     */
+    void setUseIncrementalRedistribution(bool use_incremental_redistribution);
+
+    /*!
+     * \brief Return whether incremental redistribution of the Lagrangian nodes
+     * is enabled.
+     */
+    bool getUseIncrementalRedistribution() const;
+
+    /*!
+     * \brief Return the permutation applied to the local nodes by the most
+     * recent call to endDataRedistribution().
+     *
+     * Entry k of the returned vector is the local PETSc index that would have
+     * been assigned to the node with local PETSc index k had the nodes been
+     * numbered using PATCH_LNODE_ORDERING.  The vector is empty if the nodes on
+     * the level have not been redistributed, or if the most recent call to
+     * endDataRedistribution() kept the existing local ordering of the level
+     * (see setUseIncrementalRedistribution()).
+     */
+    const std::vector<int>& getLocalNodePermutation(int level_number) const;
+
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
      * using the default spreading kernel function.
@@ -659,6 +731,17 @@ public:
      */
     Point computeLagrangianStructureCenterOfMass(int structure_id, int level_number);
 
+    /*!
+     * \brief Get the centers of mass of the Lagrangian structures with the
+     * specified IDs.
+     *
+     * This is equivalent to calling computeLagrangianStructureCenterOfMass()
+     * for each structure, but requires only a single pass over the local nodes
+     * and a single collective reduction.
+     */
+    std::vector<Point> computeLagrangianStructureCentersOfMass(const std::vector<int>& structure_ids,
+                                                               int level_number);
+
     /*!
      * \brief Get the bounding box of the Lagrangian structure with the
      * specified ID.
@@ -1014,6 +1097,20 @@ private:
                                  unsigned int& node_offset,
                                  int level_number);
 
+    /*!
+     * Renumber the nonlocal nodes of the specified level without changing the
+     * application ordering or the PETSc ordering of the local nodes.
+     *
+     * \note This function is only valid when no node has changed the patch
+     * whose interior contains it since the last time that the node
+     * distribution was computed.
+     *
+     * \return Whether the global PETSc indices of the nonlocal nodes changed.
+     */
+    bool updateNonlocalNodeDistribution(std::vector<int>& nonlocal_lag_indices,
+                                        std::vector<int>& nonlocal_petsc_indices,
+                                        int level_number);
+
     /*!
      * Determine the number of local Lagrangian nodes on all MPI processes with
      * rank less than the rank of the current MPI process.
@@ -1182,6 +1279,16 @@ private:
      */
     std::vector<bool> d_needs_synch;
 
+    /*!
+     * Data used to determine which levels may be redistributed incrementally:
+     * whether incremental redistribution is enabled, the patch levels at the
+     * time beginDataRedistribution() was called, and whether any node changed
+     * the patch whose interior contains it.
+     */
+    bool d_use_incremental_redistribution = false;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > > d_redistribution_levels;
+    std::vector<bool> d_nodes_changed_patches;
+
     /*!
      * PETSc AO objects provide mappings between the fixed global Lagrangian
      * node IDs and the ever-changing global PETSc ordering.
@@ -1222,6 +1329,14 @@ private:
     std::vector<std::vector<int> > d_local_lag_indices;
     std::vector<std::vector<int> > d_nonlocal_lag_indices;
 
+    /*!
+     * The ordering of the local nodes and the permutation applied to the local
+     * nodes by the most recent redistribution on each level of the patch
+     * hierarchy.
+     */
+    LNodeOrderingType d_node_ordering = PATCH_LNODE_ORDERING;
+    std::vector<std::vector<int> > d_local_node_permutation;
+
     /*!
      * The node indices of all local nodes (i.e. the nodes owned by this
      * processor) on each level of the hierarchy.  The indices are in the global
@@ -54,6 +54,7 @@ class multi_array;
 namespace IBTK
 {
 class LData;
+class LEStencilCache;
 template <class T>
 class LIndexSetData;
 } // namespace IBTK
@@ -101,8 +102,96 @@ public:
     static double (*s_kernel_fcn)(double r);
     static int s_kernel_fcn_stencil_size;
 
+    /*!
+     * \brief Whether to use the tiled (and, when IBTK is compiled with OpenMP
+     * support, multithreaded) implementation of interpolation and spreading.
+     *
+     * When enabled, the markers on each patch are sorted into spatial tiles
+     * that are at least one kernel stencil wide.  Tiles are colored so that
+     * the stencils of markers in distinct tiles of the same color never
+     * overlap, and tiles of the same color are processed concurrently without
+     * atomic updates.  Interpolation results are identical to those of the
+     * serial implementation.  Spreading results depend only on the tiling and
+     * \em not on the number of threads, but because the tiling changes the
+     * order in which contributions are accumulated into each grid value, they
+     * generally differ from the serial results by round-off error.  Use
+     * s_use_fixed_order_spreading to obtain the serial results.
+     *
+     * \note Threading requires configuring IBAMR with \p --enable-openmp,
+     * which adds the compiler's OpenMP flags to CXXFLAGS, FCFLAGS, and LIBS.
+     *
+     * \note The user-defined kernel always uses the serial implementation.
+     */
+    static bool s_use_threaded_interaction;
+
+    /*!
+     * \brief Whether the multithreaded implementation of spreading should
+     * accumulate values in the same order as the serial implementation.
+     *
+     * When enabled along with s_use_threaded_interaction, the ghost box of each
+     * patch is split into slabs along the last coordinate direction, one per
+     * thread, and each thread spreads every marker whose stencil intersects
+     * its slab, modifying only the values in that slab.  Each grid value
+     * receives the contributions of the markers in their original order, so
+     * that the results are bitwise identical to those of the serial
+     * implementation using the same kernels (the Fortran kernels, or the C++
+     * kernels when s_use_vectorized_kernels is enabled), for any number of
+     * threads.  Markers whose stencils straddle slab boundaries have their
+     * weights evaluated by more than one thread.
+     *
+     * \note The user-defined kernel, and the piecewise constant kernel when
+     * the Fortran kernels are used, are not clipped to the patch ghost box and
+     * always use the serial implementation when this setting is enabled.
+     */
+    static bool s_use_fixed_order_spreading;
+
+    /*!
+     * \brief Whether to reuse the delta function stencils cached by
+     * LIndexSetData objects.
+     *
+     * When enabled, interpolation and spreading operations that use an
+     * LIndexSetData object to determine the markers in either the patch
+     * interior or the patch ghost box use the kernel weights stored in the
+     * LEStencilCache associated with that object.  The weights are evaluated
+     * only when the marker positions change, so that interpolation and
+     * spreading at the same positions (e.g., within a single time step) share
+     * a single evaluation of the kernel function.
+     *
+     * \note Cached stencils are applied serially and take precedence over
+     * s_use_threaded_interaction.  Kernel functions that are not supported by
+     * LEStencilCache (e.g., the user-defined kernel) always use the uncached
+     * implementation.
+     */
+    static bool s_use_stencil_cache;
+
+    /*!
+     * \brief Whether to use the vectorizable C++ implementations of the
+     * interpolation and spreading kernels provided by LEInteractorKernels in
+     * place of the Fortran implementations.
+     *
+     * The C++ kernels evaluate the kernel weights for batches of markers at a
+     * time and apply them in unit-stride loops over the Eulerian data.  They
+     * use the same stencils, weights, and order of operations as the Fortran
+     * kernels.  This setting may be combined with s_use_threaded_interaction.
+     *
+     * \note Kernel functions that are not supported by LEInteractorKernels
+     * (i.e., the discontinuous linear and user-defined kernels) always use the
+     * Fortran implementations.
+     */
+    static bool s_use_vectorized_kernels;
+
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * Supported keys:
+     *   - \p use_threaded_interaction (bool): see s_use_threaded_interaction.
+     *   - \p use_fixed_order_spreading (bool): see s_use_fixed_order_spreading.
+     *   - \p use_stencil_cache (bool): see s_use_stencil_cache.
+     *   - \p use_vectorized_kernels (bool): see s_use_vectorized_kernels.
+     *
+     * IBMethod, IBFEMethod, IBFESurfaceMethod, and IMPMethod call this function
+     * with the \p LEInteractor sub-database of their input databases, if it is
+     * present.
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -1265,7 +1354,9 @@ private:
                             const std::vector<int>& local_indices,
                             const std::vector<double>& periodic_shifts,
                             const std::string& interp_fcn,
-                            int axis = 0);
+                            int axis = 0,
+                            LEStencilCache* stencil_cache = nullptr,
+                            bool interior_only = false);
 
     /*!
      * Implementation of the IB spreading operation.
@@ -1285,7 +1376,61 @@ private:
                        const std::vector<int>& local_indices,
                        const std::vector<double>& periodic_shifts,
                        const std::string& spread_fcn,
-                       int axis = 0);
+                       int axis = 0,
+                       LEStencilCache* stencil_cache = nullptr);
+
+    /*!
+     * Call the interpolation kernel for the specified list of markers.
+     */
+    static void interpolateKernel(double* Q_data,
+                                  int Q_depth,
+                                  const double* X_data,
+                                  const double* q_data,
+                                  const SAMRAI::hier::Box<NDIM>& q_data_box,
+                                  const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                                  int q_depth,
+                                  const double* x_lower,
+                                  const double* x_upper,
+                                  const double* dx,
+                                  const int* local_indices,
+                                  const double* periodic_shifts,
+                                  int num_local_indices,
+                                  const std::string& interp_fcn,
+                                  int axis);
+
+    /*!
+     * Call the spreading kernel for the specified list of markers.
+     */
+    static void spreadKernel(double* q_data,
+                             const SAMRAI::hier::Box<NDIM>& q_data_box,
+                             const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                             int q_depth,
+                             const double* Q_data,
+                             int Q_depth,
+                             const double* X_data,
+                             const double* x_lower,
+                             const double* x_upper,
+                             const double* dx,
+                             const int* local_indices,
+                             const double* periodic_shifts,
+                             int num_local_indices,
+                             const std::string& spread_fcn,
+                             int axis);
+
+    /*!
+     * \brief Return the stencil cache associated with the index data if cached
+     * stencils may be used for the markers located within the provided box,
+     * or NULL otherwise.
+     *
+     * \param interior_only Set to true if the box is the patch interior and to
+     * false if the box is the ghost box of the index data.
+     */
+    template <class T>
+    static LEStencilCache* getStencilCache(SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                           const SAMRAI::hier::Box<NDIM>& box,
+                                           const std::string& kernel_fcn,
+                                           bool& interior_only);
 
     /*!
      * \brief Compute the local PETSc indices located within the provided box
@@ -0,0 +1,173 @@
+// Filename: LEInteractorKernels.h
+// Created on 16 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LEInteractorKernels
+#define included_IBTK_LEInteractorKernels
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+
+#include "Box.h"
+#include "IntVector.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LEInteractorKernels provides C++ implementations of the
+ * Lagrangian-Eulerian interpolation and spreading kernels that are designed to
+ * be vectorized by the compiler.
+ *
+ * Markers are processed in fixed-size batches.  For each batch, the
+ * one-dimensional kernel weights are first evaluated for all markers and
+ * stored in structure-of-arrays form, in a loop that contains no data
+ * dependencies between markers and that is marked for SIMD execution when
+ * OpenMP is enabled.  The weights are then applied to the Eulerian data one
+ * data component at a time, with the innermost loop running over the
+ * contiguous (unit-stride) cell index along the first coordinate direction.
+ * The application step is templated on the kernel function and on the data
+ * depth, so that the stencil loops have compile-time trip counts for stencils
+ * that do not intersect the boundary of the ghost box.
+ *
+ * The kernels use the same stencils, weights, and order of operations as the
+ * Fortran kernels in lagrangian_interaction{2,3}d.f.m4.
+ *
+ * \note Only the kernel functions for which isKernelSupported() returns true
+ * are implemented.  In particular, the discontinuous linear kernel and
+ * user-defined kernels are not.
+ *
+ * \see LEInteractor
+ * \see LEKernelFunctions
+ */
+class LEInteractorKernels
+{
+public:
+    /*!
+     * \return Whether the specified kernel function is implemented.
+     */
+    static bool isKernelSupported(const std::string& kernel_fcn);
+
+    /*!
+     * \brief Interpolate data from the Eulerian grid to the specified markers.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            const double* q_data,
+                            const SAMRAI::hier::Box<NDIM>& q_data_box,
+                            const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                            int q_depth,
+                            const double* x_lower,
+                            const double* dx,
+                            const int* local_indices,
+                            const double* periodic_shifts,
+                            int num_local_indices,
+                            const std::string& interp_fcn);
+
+    /*!
+     * \brief Spread values (\em not densities) from the specified markers to
+     * the Eulerian grid.
+     */
+    static void spread(double* q_data,
+                       const SAMRAI::hier::Box<NDIM>& q_data_box,
+                       const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                       int q_depth,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       const double* x_lower,
+                       const double* dx,
+                       const int* local_indices,
+                       const double* periodic_shifts,
+                       int num_local_indices,
+                       const std::string& spread_fcn);
+
+    /*!
+     * \brief Spread values (\em not densities) from the specified markers to
+     * the Eulerian grid, modifying only the data in the intersection of the
+     * ghost box and the specified update box.
+     *
+     * The contributions of the markers to each cell are accumulated in the
+     * order in which the markers are listed in \a local_indices, so that
+     * spreading the same markers to disjoint update boxes concurrently yields
+     * results that are identical to those of a single serial call.
+     */
+    static void spread(double* q_data,
+                       const SAMRAI::hier::Box<NDIM>& q_data_box,
+                       const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                       int q_depth,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       const double* x_lower,
+                       const double* dx,
+                       const int* local_indices,
+                       const double* periodic_shifts,
+                       int num_local_indices,
+                       const std::string& spread_fcn,
+                       const SAMRAI::hier::Box<NDIM>& update_box);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LEInteractorKernels() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LEInteractorKernels(const LEInteractorKernels& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LEInteractorKernels& operator=(const LEInteractorKernels& that) = delete;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LEInteractorKernels
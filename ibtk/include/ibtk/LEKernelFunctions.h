@@ -0,0 +1,196 @@
+// Filename: LEKernelFunctions.h
+// Created on 16 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LEKernelFunctions
+#define included_IBTK_LEKernelFunctions
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LEKernelFunctions collects the one-dimensional kernel functions
+ * used by the C++ implementations of the Lagrangian-Eulerian interaction
+ * operations.
+ *
+ * Each kernel is represented by a struct that provides the width of the
+ * kernel stencil along with a function that evaluates the kernel weights for
+ * a marker located at X_o_dx = (X - x_lower)/dx, in which x_lower is the
+ * physical location of the lower corner of the patch and dx is the grid
+ * spacing.  The function stores the weights in w[0], w[stride], ...,
+ * w[(stencil_size-1)*stride] and returns the lower index of the stencil
+ * relative to the lower index of the patch.
+ *
+ * The stencils and weights are the same as those used by the Fortran kernels
+ * in lagrangian_interaction{2,3}d.f.m4.  The weight functions are branch-free
+ * (or nearly so) and are declared inline so that compilers may vectorize
+ * loops that evaluate the weights for many markers at once.
+ *
+ * \note The discontinuous linear kernel, which uses different stencils in
+ * different coordinate directions, and the user-defined kernel are not
+ * included.
+ */
+class LEKernelFunctions
+{
+public:
+    /*!
+     * \return The integer nearest to \a a, with ties rounded away from zero
+     * (i.e., Fortran's NINT).
+     */
+    static int nint(double a);
+
+    /*!
+     * \return The largest integer not greater than \a a.
+     */
+    static int floor(double a);
+
+    struct PiecewiseConstant
+    {
+        static const int stencil_size = 1;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct PiecewiseLinear
+    {
+        static const int stencil_size = 2;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct PiecewiseCubic
+    {
+        static const int stencil_size = 4;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct IB3
+    {
+        static const int stencil_size = 3;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct IB4
+    {
+        static const int stencil_size = 4;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct IB4W8
+    {
+        static const int stencil_size = 8;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct IB5
+    {
+        static const int stencil_size = 5;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct IB6
+    {
+        static const int stencil_size = 6;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct BSpline3
+    {
+        static const int stencil_size = 3;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct BSpline4
+    {
+        static const int stencil_size = 4;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct BSpline5
+    {
+        static const int stencil_size = 5;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+    struct BSpline6
+    {
+        static const int stencil_size = 6;
+        static int computeWeights(double X_o_dx, double* w, int stride = 1);
+    };
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LEKernelFunctions() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LEKernelFunctions(const LEKernelFunctions& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LEKernelFunctions& operator=(const LEKernelFunctions& that) = delete;
+
+    /*!
+     * \brief One-dimensional delta functions that are evaluated pointwise.
+     */
+    static double piecewise_cubic_delta(double r);
+    static double ib_3_delta(double r);
+    static double bspline_3_delta(double x);
+    static double bspline_4_delta(double x);
+    static double bspline_5_delta(double x);
+    static double bspline_6_delta(double x);
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/LEKernelFunctions-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LEKernelFunctions
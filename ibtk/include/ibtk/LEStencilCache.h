@@ -0,0 +1,219 @@
+// Filename: LEStencilCache.h
+// Created on 16 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LEStencilCache
+#define included_IBTK_LEStencilCache
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LEStencilCache stores the delta function stencils used by
+ * LEInteractor to interpolate and spread data between the Eulerian grid and
+ * the markers of a single patch.
+ *
+ * For each marker, the cache records the lower corner of the (unclipped)
+ * kernel stencil along with the one-dimensional kernel weights along each
+ * coordinate direction.  Tensor-product weights are formed on the fly when the
+ * stencil is applied.  Stencils are computed once for each combination of
+ * kernel function and grid centering and are reused for as long as the marker
+ * positions are unchanged, so that, e.g., interpolating the velocity and then
+ * spreading the force at the same positions requires only a single evaluation
+ * of the kernel weights.
+ *
+ * The stencils are always computed for the complete set of markers associated
+ * with the patch data object (including markers in the ghost cell region).
+ * Interpolation may be restricted to the markers in the patch interior.
+ *
+ * Cached stencils are validated against the marker positions each time they
+ * are used, so a cache can never be used with stale positions.
+ *
+ * \note Only the kernel functions for which isKernelSupported() returns true
+ * may be cached.  Other kernels are handled by the uncached implementation.
+ *
+ * \see LEInteractor
+ * \see LIndexSetData
+ */
+class LEStencilCache
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    LEStencilCache() = default;
+
+    /*!
+     * \brief Default destructor.
+     */
+    ~LEStencilCache() = default;
+
+    /*!
+     * \brief Copy constructor.
+     */
+    LEStencilCache(const LEStencilCache& from) = default;
+
+    /*!
+     * \brief Assignment operator.
+     */
+    LEStencilCache& operator=(const LEStencilCache& that) = default;
+
+    /*!
+     * \return Whether the specified kernel function may be cached.
+     */
+    static bool isKernelSupported(const std::string& kernel_fcn);
+
+    /*!
+     * \brief Reset the set of markers associated with the cache and discard
+     * all cached stencils.
+     *
+     * \param local_indices Local PETSc indices of all markers, including
+     * those in the ghost cell region.
+     *
+     * \param periodic_shifts Periodic shifts of all markers.
+     *
+     * \param interior_offsets Offsets into \a local_indices of those markers
+     * that lie in the patch interior.
+     */
+    void setMarkers(const std::vector<int>& local_indices,
+                    const std::vector<double>& periodic_shifts,
+                    const std::vector<int>& interior_offsets);
+
+    /*!
+     * \brief Discard all cached stencils.
+     */
+    void clear();
+
+    /*!
+     * \return The number of markers in the patch interior.
+     */
+    int getNumberOfInteriorMarkers() const;
+
+    /*!
+     * \return The total number of markers.
+     */
+    int getNumberOfMarkers() const;
+
+    /*!
+     * \brief Interpolate data from the Eulerian grid to the markers.
+     *
+     * \param interior_only Whether to interpolate only to markers in the patch
+     * interior.
+     */
+    void interpolate(double* Q_data,
+                     int Q_depth,
+                     const double* X_data,
+                     const double* q_data,
+                     const SAMRAI::hier::Box<NDIM>& q_data_box,
+                     const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                     int q_depth,
+                     const double* x_lower,
+                     const double* dx,
+                     const std::string& interp_fcn,
+                     bool interior_only);
+
+    /*!
+     * \brief Spread values (\em not densities) from all markers to the
+     * Eulerian grid.
+     */
+    void spread(double* q_data,
+                const SAMRAI::hier::Box<NDIM>& q_data_box,
+                const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                int q_depth,
+                const double* Q_data,
+                int Q_depth,
+                const double* X_data,
+                const double* x_lower,
+                const double* dx,
+                const std::string& spread_fcn);
+
+    /*!
+     * \return The number of times that cached stencils have been reused.
+     */
+    int getNumberOfHits() const;
+
+    /*!
+     * \return The number of times that stencils have been (re)computed.
+     */
+    int getNumberOfMisses() const;
+
+private:
+    /*!
+     * \brief The cached stencils for a single kernel function and grid
+     * centering.
+     */
+    struct Entry
+    {
+        std::string kernel_fcn;
+        int stencil_size;
+        std::array<double, NDIM> x_lower, dx;
+        SAMRAI::hier::IntVector<NDIM> ilower;
+        std::vector<double> X_shifted;
+        std::vector<int> stencil_lower;
+        std::vector<double> weights;
+    };
+
+    /*!
+     * \brief Return the entry for the specified configuration, (re)computing
+     * the stencils if the marker positions have changed.
+     */
+    const Entry& getEntry(const std::string& kernel_fcn,
+                          const double* X_data,
+                          const double* x_lower,
+                          const double* dx,
+                          const SAMRAI::hier::IntVector<NDIM>& ilower);
+
+    /*!
+     * \brief Compute the stencils for all markers.
+     */
+    void computeEntry(Entry& entry, const double* X_data) const;
+
+    std::vector<int> d_local_indices;
+    std::vector<double> d_periodic_shifts;
+    std::vector<int> d_interior_offsets;
+    std::vector<Entry> d_entries;
+    int d_num_hits = 0, d_num_misses = 0;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LEStencilCache
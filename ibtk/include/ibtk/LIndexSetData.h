@@ -38,7 +38,9 @@
 #include <vector>
 
 #include "Box.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "ibtk/LEStencilCache.h"
 #include "ibtk/LSetData.h"
 #include "tbox/Pointer.h"
 
@@ -81,9 +83,14 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * \param sort_by_local_petsc_index Whether to order the cached indices by
+     * their local PETSc indices (rather than by the order in which they are
+     * stored in the patch data object).
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           bool sort_by_local_petsc_index = false);
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
@@ -157,6 +164,48 @@ public:
      */
     const std::vector<double>& getGhostPeriodicShifts() const;
 
+    /*!
+     * \return A constant reference to the cell indices of the cells (including
+     * those in the ghost cell region) that contain at least one index.
+     *
+     * \note The indices are also cached cell by cell in compressed sparse row
+     * format: the local PETSc indices of the nodes in cell
+     * getOccupiedCellIndices()[k] are stored in getCellLocalPETScIndices() at
+     * positions getCellOffsets()[k] to getCellOffsets()[k+1] (exclusive), and
+     * the periodic shift of that cell is stored in getCellPeriodicShifts() at
+     * positions NDIM*k to NDIM*(k+1) (exclusive).  This allows the indices that
+     * lie in an arbitrary box to be found without traversing the index sets.
+     */
+    const std::vector<SAMRAI::hier::Index<NDIM> >& getOccupiedCellIndices() const;
+
+    /*!
+     * \return A constant reference to the offsets of each occupied cell into
+     * the array returned by getCellLocalPETScIndices().
+     */
+    const std::vector<int>& getCellOffsets() const;
+
+    /*!
+     * \return A constant reference to the local PETSc data indices that lie in
+     * the patch (including the ghost cell region), grouped by cell.
+     */
+    const std::vector<int>& getCellLocalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the periodic shifts of the occupied
+     * cells.
+     */
+    const std::vector<double>& getCellPeriodicShifts() const;
+
+    /*!
+     * \return A reference to the cache of interpolation and spreading stencils
+     * for the indices that lie in the patch (including the ghost cell region).
+     *
+     * \note The set of markers associated with the stencil cache is reset by
+     * the first call to this function following cacheLocalIndices(), so that
+     * no stencil cache data are set up unless the cache is actually used.
+     */
+    LEStencilCache& getStencilCache();
+
 private:
     /*!
      * \brief Default constructor.
@@ -189,6 +238,12 @@ private:
     std::vector<int> d_global_petsc_indices, d_interior_global_petsc_indices, d_ghost_global_petsc_indices;
     std::vector<int> d_local_petsc_indices, d_interior_local_petsc_indices, d_ghost_local_petsc_indices;
     std::vector<double> d_periodic_shifts, d_interior_periodic_shifts, d_ghost_periodic_shifts;
+    std::vector<int> d_interior_offsets;
+    std::vector<SAMRAI::hier::Index<NDIM> > d_occupied_cell_indices;
+    std::vector<int> d_cell_offsets, d_cell_local_petsc_indices;
+    std::vector<double> d_cell_periodic_shifts;
+    LEStencilCache d_stencil_cache;
+    bool d_stencil_cache_is_current = false;
 };
 } // namespace IBTK
 
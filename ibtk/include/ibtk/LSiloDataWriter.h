@@ -71,6 +71,14 @@ namespace IBTK
  *
  * For more information about Silo, see the Silo manual <A
  * HREF="http://www.llnl.gov/bdiv/meshtv/manuals/silo.pdf">here</A>.
+ *
+ * By default, each MPI process writes its data to a separate Silo file.  When
+ * the number of files is set via setNumberOfFiles(), the MPI processes are
+ * instead divided into contiguous groups, and the processes in each group take
+ * turns writing their data to a shared file (the "baton passing" strategy
+ * used by Silo's PMPIO interface).  In either case, the metadata required to
+ * write the multimesh summary file is gathered on the root MPI process by a
+ * small number of collective operations.
  */
 class LSiloDataWriter : public SAMRAI::tbox::Serializable
 {
@@ -109,6 +117,27 @@ public:
 
     //\}
 
+    /*!
+     * \name Methods to set output options.
+     */
+    //\{
+
+    /*!
+     * \brief Set the number of Silo files written for each time step.
+     *
+     * A non-positive value (the default) indicates that each MPI process
+     * writes its own file.
+     */
+    void setNumberOfFiles(int num_files);
+
+    /*!
+     * \brief Set whether to write the coordinate and variable data in double
+     * precision.  By default, data are written in single precision.
+     */
+    void setUseDoublePrecision(bool use_double_precision);
+
+    //\}
+
     /*!
      * \brief Register or update a range of Lagrangian indices that are to be
      * visualized as a cloud of marker particles.
@@ -277,6 +306,12 @@ private:
      */
     int d_time_step_number = -1;
 
+    /*
+     * Output options.
+     */
+    int d_num_files = 0;
+    bool d_use_double_precision = false;
+
     /*
      * Grid hierarchy information.
      */
@@ -121,6 +121,11 @@ public:
      */
     const std::string& getPatternName() const override;
 
+    /*!
+     * Returns the axis along which values are synchronized.
+     */
+    unsigned int getAxis() const;
+
 private:
     /*!
      * \brief Default constructor.
@@ -53,14 +53,31 @@ namespace IBTK
 /*!
  * \brief Class ParallelMap is a utility class for associating integer keys with
  * arbitrary data items in parallel.
+ *
+ * By default, the map is replicated on all MPI processes, and the pending
+ * additions and removals of all processes are exchanged by a single
+ * MPI_Allgatherv each.  For keys that are needed by only a few processes, the
+ * map may instead be partitioned so that each item is stored only by the
+ * process that owns its key (see getOwnerRank()).  In this case, pending
+ * additions and removals are sent only to the owning processes via a sparse
+ * neighbor exchange.
  */
 class ParallelMap : public SAMRAI::tbox::DescribedClass
 {
 public:
     /*!
-     * \brief Default constructor.
+     * \brief Enumerated type for the data distribution strategy.
      */
-    ParallelMap() = default;
+    enum DistributionType
+    {
+        REPLICATED,
+        OWNER_PARTITIONED
+    };
+
+    /*!
+     * \brief Constructor.
+     */
+    explicit ParallelMap(DistributionType distribution_type = REPLICATED);
 
     /*!
      * \brief Copy constructor.
@@ -116,11 +133,32 @@ public:
 
     /*!
      * \brief Return a const reference to the map.
+     *
+     * \note When the map is partitioned, the returned map contains only those
+     * items whose keys are owned by the calling process.
      */
     const std::map<int, SAMRAI::tbox::Pointer<Streamable> >& getMap() const;
 
+    /*!
+     * \brief Return the rank of the MPI process that stores the item with the
+     * specified key when the map is partitioned.
+     */
+    static int getOwnerRank(int key);
+
 private:
+    /*!
+     * \brief Communicate the pending additions and removals to all processes.
+     */
+    void communicateReplicatedData();
+
+    /*!
+     * \brief Communicate the pending additions and removals to the processes
+     * that own the corresponding keys.
+     */
+    void communicatePartitionedData();
+
     // Member data.
+    DistributionType d_distribution_type;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_map;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_pending_additions;
     std::vector<int> d_pending_removals;
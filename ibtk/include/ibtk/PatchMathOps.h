@@ -499,6 +499,28 @@ public:
                     int m = 0,
                     int n = 0) const;
 
+    /*!
+     * \brief Computes the action of the staggered-grid Stokes operator,
+     *
+     *    dst1 = alpha L src1 + beta src1 + grad src2 + gamma src3,
+     *    dst2 = -div src1,
+     *
+     * in a single sweep over the patch, in which src1 is the side-centered
+     * velocity and src2 is the cell-centered pressure.
+     *
+     * The Laplacian uses the same stencil as laplace() and is skipped if alpha
+     * and beta are both zero.  src3 may be the same patch data as dst1.
+     */
+    void stokes(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst1,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst2,
+                double alpha,
+                double beta,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src1,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src2,
+                double gamma,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src3,
+                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
     /*!
      * \brief Compute dst_i = alpha src1_j + beta src2_k, pointwise.
      */
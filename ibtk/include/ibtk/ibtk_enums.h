@@ -194,6 +194,41 @@ enum_to_string<VCInterpType>(VCInterpType val)
     return "UNKNOWN_VC_INTERP_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for different orderings of the local Lagrangian
+ * nodes.
+ */
+enum LNodeOrderingType
+{
+    PATCH_LNODE_ORDERING,
+    MORTON_LNODE_ORDERING,
+    HILBERT_LNODE_ORDERING,
+    UNKNOWN_LNODE_ORDERING_TYPE = -1
+};
+
+template <>
+inline LNodeOrderingType
+string_to_enum<LNodeOrderingType>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "PATCH") == 0) return PATCH_LNODE_ORDERING;
+    if (strcasecmp(val.c_str(), "PATCH_LNODE_ORDERING") == 0) return PATCH_LNODE_ORDERING;
+    if (strcasecmp(val.c_str(), "MORTON") == 0) return MORTON_LNODE_ORDERING;
+    if (strcasecmp(val.c_str(), "MORTON_LNODE_ORDERING") == 0) return MORTON_LNODE_ORDERING;
+    if (strcasecmp(val.c_str(), "HILBERT") == 0) return HILBERT_LNODE_ORDERING;
+    if (strcasecmp(val.c_str(), "HILBERT_LNODE_ORDERING") == 0) return HILBERT_LNODE_ORDERING;
+    return UNKNOWN_LNODE_ORDERING_TYPE;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<LNodeOrderingType>(LNodeOrderingType val)
+{
+    if (val == PATCH_LNODE_ORDERING) return "PATCH_LNODE_ORDERING";
+    if (val == MORTON_LNODE_ORDERING) return "MORTON_LNODE_ORDERING";
+    if (val == HILBERT_LNODE_ORDERING) return "HILBERT_LNODE_ORDERING";
+    return "UNKNOWN_LNODE_ORDERING_TYPE";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -162,10 +163,36 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * \brief Ensure that the arrays storing the time and position variables
+     * can hold the specified number of points, (re-)defining the parser
+     * variables if the arrays are reallocated.
      */
-    double d_parser_time = 0.0;
-    Point d_parser_posn;
+    void resizeParserVariables(int num_points);
+
+    /*!
+     * \brief Determine which function is used to set the specified component
+     * of face-, side-, or edge-centered data.
+     */
+    int getFunctionDepth(unsigned int axis, int data_depth, int depth) const;
+
+    /*!
+     * \brief Evaluate the specified function at the first num_points positions
+     * stored in the position arrays using muParser's bulk mode.
+     */
+    void evaluateParser(int function_depth, int num_points, double data_time);
+
+    /*!
+     * Whether any of the functions depend on time.
+     */
+    bool d_time_dependent = true;
+
+    /*!
+     * Time and position variables, and the values of the functions at those
+     * points.  These are stored as arrays so that the functions may be
+     * evaluated at all of the data points of a patch in a single call.
+     */
+    std::vector<double> d_parser_time, d_parser_vals;
+    std::array<std::vector<double>, NDIM> d_parser_posn;
 };
 } // namespace IBTK
 
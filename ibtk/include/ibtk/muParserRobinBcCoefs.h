@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -181,25 +182,28 @@ private:
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that) = delete;
 
     /*!
-     * Current time value used by the mu::Parser instances.
-     *
-     * This value is mutable since the mu::Parser objects each store a pointer
-     * to it but its specific value (the present time) changes during each
-     * call to muParserRobinBcCoefs::setBcCoefs. The alternative would be to
-     * rebuild the mu::Parser objects during each call to
-     * muParserRobinBcCoefs::setBcCoefs, which is much more expensive. Since
-     * this variable is only written to and subsequently read from in that
-     * function this is reasonable.
+     * \brief Ensure that the arrays storing the time and position variables
+     * can hold the specified number of points, (re-)defining the parser
+     * variables if the arrays are reallocated.
      */
-    mutable double d_parser_time = 0.0;
+    void resizeParserVariables(int num_points) const;
 
     /*!
-     * Current space point used by the mu::Parser instances.
+     * Current time and space points used by the mu::Parser instances, and the
+     * values of the functions at those points.  These are stored as arrays so
+     * that the functions may be evaluated at all of the points of a boundary
+     * box in a single call using muParser's bulk mode.
      *
-     * This value is mutable for the same reasons that
-     * muParserRobinBcCoefs::d_parser_time is mutable.
+     * These values are mutable since the mu::Parser objects each store a
+     * pointer to them but their specific values (the present time and the
+     * positions of the boundary points) change during each call to
+     * muParserRobinBcCoefs::setBcCoefs. The alternative would be to rebuild the
+     * mu::Parser objects during each call to muParserRobinBcCoefs::setBcCoefs,
+     * which is much more expensive. Since these variables are only written to
+     * and subsequently read from in that function this is reasonable.
      */
-    mutable Point d_parser_posn;
+    mutable std::vector<double> d_parser_time, d_parser_vals;
+    mutable std::array<std::vector<double>, NDIM> d_parser_posn;
 
     /*!
      * The Cartesian grid geometry object provides the extents of the
@@ -222,10 +226,13 @@ private:
 
     /*!
      * The mu::Parser objects which evaluate the data-setting functions.
+     *
+     * These objects are mutable since muParser's bulk evaluation mode is not
+     * const.
      */
-    std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
 };
 } // namespace IBTK
 
@@ -211,6 +211,82 @@ IndexUtilities::partitionPatchBox(std::vector<SAMRAI::hier::Box<NDIM> >& overlap
     return subdomains;
 } // partitionPatchBox
 
+inline std::uint64_t
+IndexUtilities::getMortonIndex(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& lower)
+{
+    static const int num_bits = 64 / NDIM;
+    std::uint64_t morton_idx = 0;
+    for (int b = num_bits - 1; b >= 0; --b)
+    {
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const auto x = static_cast<std::uint64_t>(i(d) - lower(d));
+            morton_idx = (morton_idx << 1) | ((x >> b) & 1);
+        }
+    }
+    return morton_idx;
+} // getMortonIndex
+
+inline std::uint64_t
+IndexUtilities::getHilbertIndex(const SAMRAI::hier::Index<NDIM>& i,
+                                const SAMRAI::hier::Index<NDIM>& lower,
+                                const int num_bits)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_bits > 0 && num_bits <= 64 / NDIM);
+#endif
+    // Convert the coordinates to the "transposed" form of the Hilbert index
+    // using the algorithm of J. Skilling, "Programming the Hilbert curve", AIP
+    // Conf. Proc. 707 (2004).
+    std::uint64_t X[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        X[d] = static_cast<std::uint64_t>(i(d) - lower(d));
+    }
+    const std::uint64_t M = std::uint64_t(1) << (num_bits - 1);
+    for (std::uint64_t Q = M; Q > 1; Q >>= 1)
+    {
+        const std::uint64_t P = Q - 1;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (X[d] & Q)
+            {
+                X[0] ^= P;
+            }
+            else
+            {
+                const std::uint64_t t = (X[0] ^ X[d]) & P;
+                X[0] ^= t;
+                X[d] ^= t;
+            }
+        }
+    }
+    for (int d = 1; d < NDIM; ++d)
+    {
+        X[d] ^= X[d - 1];
+    }
+    std::uint64_t t = 0;
+    for (std::uint64_t Q = M; Q > 1; Q >>= 1)
+    {
+        if (X[NDIM - 1] & Q) t ^= Q - 1;
+    }
+    for (int d = 0; d < NDIM; ++d)
+    {
+        X[d] ^= t;
+    }
+
+    // Interleave the bits of the transposed index.
+    std::uint64_t hilbert_idx = 0;
+    for (int b = num_bits - 1; b >= 0; --b)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            hilbert_idx = (hilbert_idx << 1) | ((X[d] >> b) & 1);
+        }
+    }
+    return hilbert_idx;
+} // getHilbertIndex
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
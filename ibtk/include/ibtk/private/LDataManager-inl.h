@@ -63,6 +63,44 @@ LDataManager::getDefaultSpreadKernelFunction() const
     return d_default_spread_kernel_fcn;
 } // getDefaultSpreadKernelFunction
 
+inline void
+LDataManager::setNodeOrdering(const LNodeOrderingType node_ordering)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(node_ordering != UNKNOWN_LNODE_ORDERING_TYPE);
+#endif
+    d_node_ordering = node_ordering;
+    return;
+} // setNodeOrdering
+
+inline LNodeOrderingType
+LDataManager::getNodeOrdering() const
+{
+    return d_node_ordering;
+} // getNodeOrdering
+
+inline void
+LDataManager::setUseIncrementalRedistribution(const bool use_incremental_redistribution)
+{
+    d_use_incremental_redistribution = use_incremental_redistribution;
+    return;
+} // setUseIncrementalRedistribution
+
+inline bool
+LDataManager::getUseIncrementalRedistribution() const
+{
+    return d_use_incremental_redistribution;
+} // getUseIncrementalRedistribution
+
+inline const std::vector<int>&
+LDataManager::getLocalNodePermutation(const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= 0 && level_number < static_cast<int>(d_local_node_permutation.size()));
+#endif
+    return d_local_node_permutation[level_number];
+} // getLocalNodePermutation
+
 inline bool
 LDataManager::levelContainsLagrangianData(const int level_number) const
 {
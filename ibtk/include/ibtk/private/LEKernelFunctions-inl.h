@@ -0,0 +1,302 @@
+// Filename: LEKernelFunctions-inl.h
+// Created on 16 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LEKernelFunctions_inl_h
+#define included_IBTK_LEKernelFunctions_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <cmath>
+
+#include "ibtk/LEKernelFunctions.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+inline int
+LEKernelFunctions::nint(const double a)
+{
+    return (a >= 0.0 ? static_cast<int>(a + 0.5) : static_cast<int>(a - 0.5));
+} // nint
+
+inline int
+LEKernelFunctions::floor(const double a)
+{
+    return static_cast<int>(std::floor(a));
+} // floor
+
+inline int
+LEKernelFunctions::PiecewiseConstant::computeWeights(const double X_o_dx, double* const w, const int /*stride*/)
+{
+    w[0] = 1.0;
+    return nint(X_o_dx - 0.5);
+} // PiecewiseConstant::computeWeights
+
+inline int
+LEKernelFunctions::PiecewiseLinear::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = nint(X_o_dx) - 1;
+    const double r = X_o_dx - (ic_lower + 0.5);
+    w[0] = 1.0 - r;
+    w[stride] = r;
+    return ic_lower;
+} // PiecewiseLinear::computeWeights
+
+inline int
+LEKernelFunctions::PiecewiseCubic::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = nint(X_o_dx) - 2;
+    for (int k = 0; k < stencil_size; ++k)
+    {
+        w[k * stride] = piecewise_cubic_delta(X_o_dx - (ic_lower + k + 0.5));
+    }
+    return ic_lower;
+} // PiecewiseCubic::computeWeights
+
+inline int
+LEKernelFunctions::IB3::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = floor(X_o_dx) - 1;
+    for (int k = 0; k < stencil_size; ++k)
+    {
+        w[k * stride] = ib_3_delta(X_o_dx - (ic_lower + k + 0.5));
+    }
+    return ic_lower;
+} // IB3::computeWeights
+
+inline int
+LEKernelFunctions::IB4::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = nint(X_o_dx) - 2;
+    const double r = X_o_dx - ((ic_lower + 1) + 0.5);
+    const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+    w[0 * stride] = 0.125 * (3.0 - 2.0 * r - q);
+    w[1 * stride] = 0.125 * (3.0 - 2.0 * r + q);
+    w[2 * stride] = 0.125 * (1.0 + 2.0 * r + q);
+    w[3 * stride] = 0.125 * (1.0 + 2.0 * r - q);
+    return ic_lower;
+} // IB4::computeWeights
+
+inline int
+LEKernelFunctions::IB4W8::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = nint(X_o_dx) - 4;
+    double r = 0.5 * (X_o_dx - ((ic_lower + 3) + 0.5));
+    double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+    w[1 * stride] = 0.0625 * (3.0 - 2.0 * r - q);
+    w[3 * stride] = 0.0625 * (3.0 - 2.0 * r + q);
+    w[5 * stride] = 0.0625 * (1.0 + 2.0 * r + q);
+    w[7 * stride] = 0.0625 * (1.0 + 2.0 * r - q);
+    r = r + 0.5;
+    q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+    w[0 * stride] = 0.0625 * (3.0 - 2.0 * r - q);
+    w[2 * stride] = 0.0625 * (3.0 - 2.0 * r + q);
+    w[4 * stride] = 0.0625 * (1.0 + 2.0 * r + q);
+    w[6 * stride] = 0.0625 * (1.0 + 2.0 * r - q);
+    return ic_lower;
+} // IB4W8::computeWeights
+
+inline int
+LEKernelFunctions::IB5::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    // K = (38 - sqrt(69))/60.
+    const double K = 0.4948896022846988;
+    const int ic_center = floor(X_o_dx);
+    const double r = X_o_dx - (ic_center + 0.5);
+    const double r2 = r * r, r3 = r2 * r, r4 = r3 * r, r6 = r4 * r2;
+    const double phi = (136.0 - 40.0 * K - 40.0 * r2 +
+                        std::sqrt(2.0) * std::sqrt(3123.0 - 6840.0 * K + 3600.0 * (K * K) - 12440.0 * r2 +
+                                                   25680.0 * K * r2 - 12600.0 * (K * K) * r2 + 8080.0 * r4 -
+                                                   8400.0 * K * r4 - 1400.0 * r6)) /
+                       280.0;
+    w[0 * stride] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K + r - 3.0 * K * r + 2.0 * r2 - r3);
+    w[1 * stride] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K - 4.0 * r + 3.0 * K * r - r2 + r3);
+    w[2 * stride] = phi;
+    w[3 * stride] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K + 4.0 * r - 3.0 * K * r - r2 - r3);
+    w[4 * stride] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K - r + 3.0 * K * r + 2.0 * r2 + r3);
+    return ic_center - 2;
+} // IB5::computeWeights
+
+inline int
+LEKernelFunctions::IB6::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    // K = (59/60)*(1 - sqrt(1 - 3220/3481)).
+    const double K = 0.714075092976608;
+    const int ic_lower = nint(X_o_dx) - 3;
+    const double r = 1.0 - X_o_dx + ((ic_lower + 2) + 0.5);
+    const double r2 = r * r, r3 = r2 * r, r4 = r3 * r, r6 = r4 * r2;
+    const double alpha = 28.0;
+    const double beta = (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+    const double gamma = (1.0 / 4.0) * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * (1.0 / 2.0) * r2 +
+                                        (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r4 + (5.0 / 18.0) * r6);
+    const double discr = beta * beta - 4.0 * alpha * gamma;
+    const double sgn = ((3.0 / 2.0) - K) >= 0.0 ? 1.0 : -1.0;
+    const double pm3 = (-beta + sgn * std::sqrt(discr)) / (2.0 * alpha);
+    w[0 * stride] = pm3;
+    w[1 * stride] =
+        -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r + (1.0 / 12.0) * r3;
+    w[2 * stride] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+    w[3 * stride] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+    w[4 * stride] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+    w[5 * stride] =
+        pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r - (1.0 / 12.0) * r3;
+    return ic_lower;
+} // IB6::computeWeights
+
+inline int
+LEKernelFunctions::BSpline3::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = floor(X_o_dx) - 1;
+    for (int k = 0; k < stencil_size; ++k)
+    {
+        w[k * stride] = bspline_3_delta(X_o_dx - (ic_lower + k + 0.5));
+    }
+    return ic_lower;
+} // BSpline3::computeWeights
+
+inline int
+LEKernelFunctions::BSpline4::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = nint(X_o_dx) - 2;
+    for (int k = 0; k < stencil_size; ++k)
+    {
+        w[k * stride] = bspline_4_delta(X_o_dx - (ic_lower + k + 0.5));
+    }
+    return ic_lower;
+} // BSpline4::computeWeights
+
+inline int
+LEKernelFunctions::BSpline5::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = floor(X_o_dx) - 2;
+    for (int k = 0; k < stencil_size; ++k)
+    {
+        w[k * stride] = bspline_5_delta(X_o_dx - (ic_lower + k + 0.5));
+    }
+    return ic_lower;
+} // BSpline5::computeWeights
+
+inline int
+LEKernelFunctions::BSpline6::computeWeights(const double X_o_dx, double* const w, const int stride)
+{
+    const int ic_lower = nint(X_o_dx) - 3;
+    for (int k = 0; k < stencil_size; ++k)
+    {
+        w[k * stride] = bspline_6_delta(X_o_dx - (ic_lower + k + 0.5));
+    }
+    return ic_lower;
+} // BSpline6::computeWeights
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+inline double
+LEKernelFunctions::piecewise_cubic_delta(double r)
+{
+    r = std::abs(r);
+    if (r < 1.0) return 1.0 - 0.5 * r - r * r + 0.5 * r * r * r;
+    if (r < 2.0) return 1.0 - (11.0 / 6.0) * r + r * r - (1.0 / 6.0) * r * r * r;
+    return 0.0;
+} // piecewise_cubic_delta
+
+inline double
+LEKernelFunctions::ib_3_delta(double r)
+{
+    r = std::abs(r);
+    if (r < 0.5) return 0.333333333333333 * (1.0 + std::sqrt(1.0 - 3.0 * r * r));
+    if (r < 1.5) return 0.16666666666667 * (5.0 - 3.0 * r - std::sqrt(1.0 - 3.0 * (1.0 - r) * (1.0 - r)));
+    return 0.0;
+} // ib_3_delta
+
+inline double
+LEKernelFunctions::bspline_3_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 1.5;
+    const double r2 = r * r;
+    if (modx <= 0.5) return 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+    if (modx <= 1.5) return 0.5 * (r2 - 6.0 * r + 9.0);
+    return 0.0;
+} // bspline_3_delta
+
+inline double
+LEKernelFunctions::bspline_4_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    if (modx <= 1.0) return (1.0 / 6.0) * (3.0 * r3 - 24.0 * r2 + 60.0 * r - 44.0);
+    if (modx <= 2.0) return (1.0 / 6.0) * (-r3 + 12.0 * r2 - 48.0 * r + 64.0);
+    return 0.0;
+} // bspline_4_delta
+
+inline double
+LEKernelFunctions::bspline_5_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.5;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    if (modx <= 0.5) return (1.0 / 24.0) * (6.0 * r4 - 60.0 * r3 + 210.0 * r2 - 300.0 * r + 155.0);
+    if (modx <= 1.5) return (1.0 / 24.0) * (-4.0 * r4 + 60.0 * r3 - 330.0 * r2 + 780.0 * r - 655.0);
+    if (modx <= 2.5) return (1.0 / 24.0) * (r4 - 20.0 * r3 + 150.0 * r2 - 500.0 * r + 625.0);
+    return 0.0;
+} // bspline_5_delta
+
+inline double
+LEKernelFunctions::bspline_6_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 3.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    const double r5 = r4 * r;
+    if (modx <= 1.0)
+        return (1.0 / 60.0) * (2193.0 - 3465.0 * r + 2130.0 * r2 - 630.0 * r3 + 90.0 * r4 - 5.0 * r5);
+    if (modx <= 2.0)
+        return (1.0 / 120.0) * (-10974.0 + 12270.0 * r - 5340.0 * r2 + 1140.0 * r3 - 120.0 * r4 + 5.0 * r5);
+    if (modx <= 3.0) return (1.0 / 120.0) * (7776.0 - 6480.0 * r + 2160.0 * r2 - 360.0 * r3 + 30.0 * r4 - r5);
+    return 0.0;
+} // bspline_6_delta
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LEKernelFunctions_inl_h
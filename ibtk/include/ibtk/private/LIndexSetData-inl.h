@@ -127,6 +127,46 @@ LIndexSetData<T>::getGhostPeriodicShifts() const
     return d_ghost_periodic_shifts;
 } // getGhostPeriodicShifts
 
+template <class T>
+inline const std::vector<SAMRAI::hier::Index<NDIM> >&
+LIndexSetData<T>::getOccupiedCellIndices() const
+{
+    return d_occupied_cell_indices;
+} // getOccupiedCellIndices
+
+template <class T>
+inline const std::vector<int>&
+LIndexSetData<T>::getCellOffsets() const
+{
+    return d_cell_offsets;
+} // getCellOffsets
+
+template <class T>
+inline const std::vector<int>&
+LIndexSetData<T>::getCellLocalPETScIndices() const
+{
+    return d_cell_local_petsc_indices;
+} // getCellLocalPETScIndices
+
+template <class T>
+inline const std::vector<double>&
+LIndexSetData<T>::getCellPeriodicShifts() const
+{
+    return d_cell_periodic_shifts;
+} // getCellPeriodicShifts
+
+template <class T>
+inline LEStencilCache&
+LIndexSetData<T>::getStencilCache()
+{
+    if (!d_stencil_cache_is_current)
+    {
+        d_stencil_cache.setMarkers(d_local_petsc_indices, d_periodic_shifts, d_interior_offsets);
+        d_stencil_cache_is_current = true;
+    }
+    return d_stencil_cache;
+} // getStencilCache
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
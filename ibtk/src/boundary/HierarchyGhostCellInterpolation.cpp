@@ -33,10 +33,14 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <map>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "BoxGeometryFillPattern.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -66,9 +70,15 @@
 #include "ibtk/CartSideDoubleCubicCoarsen.h"
 #include "ibtk/CartSideDoubleQuadraticCFInterpolation.h"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
+#include "ibtk/CellNoCornersFillPattern.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/EdgeSynchCopyFillPattern.h"
+#include "ibtk/FaceSynchCopyFillPattern.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/NodeSynchCopyFillPattern.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/SideNoCornersFillPattern.h"
+#include "ibtk/SideSynchCopyFillPattern.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Pointer.h"
@@ -100,12 +110,18 @@ namespace
 static Timer* t_initialize_operator_state;
 static Timer* t_reset_transaction_component;
 static Timer* t_reset_transaction_components;
+static Timer* t_reset_transaction_components_cache_hit;
+static Timer* t_reset_transaction_components_cache_miss;
 static Timer* t_reinitialize_operator_state;
 static Timer* t_deallocate_operator_state;
 static Timer* t_fill_data;
 static Timer* t_fill_data_coarsen;
 static Timer* t_fill_data_refine;
 static Timer* t_fill_data_set_physical_bcs;
+
+// The maximum number of collections of transaction components for which
+// communication schedules are cached.
+static const unsigned int MAX_SCHEDULE_CACHE_SIZE = 8;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -120,6 +136,10 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::resetTransactionComponent()");
         t_reset_transaction_components =
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::resetTransactionComponents()");
+        t_reset_transaction_components_cache_hit = TimerManager::getManager()->getTimer(
+            "IBTK::HierarchyGhostCellInterpolation::resetTransactionComponents()[cache_hit]");
+        t_reset_transaction_components_cache_miss = TimerManager::getManager()->getTimer(
+            "IBTK::HierarchyGhostCellInterpolation::resetTransactionComponents()[cache_miss]");
         t_reinitialize_operator_state =
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::reinitializeOperatorState()");
         t_deallocate_operator_state =
@@ -344,6 +364,11 @@ HierarchyGhostCellInterpolation::initializeOperatorState(
         d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
     }
 
+    // Cache the communication schedules so that they may be reused by
+    // subsequent calls to resetTransactionComponents().
+    cacheSchedules(getScheduleCacheKey(d_transaction_comps));
+    ++d_schedule_cache_misses;
+
     // Setup physical BC type.
     setHomogeneousBc(d_homogeneous_bc);
 
@@ -393,40 +418,70 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
     // Reset the transaction components.
     d_transaction_comps = transaction_comps;
 
-    // Reset cached coarsen algorithms and schedules.
+    // Look up the communication schedules for this collection of transaction
+    // components.  New schedules are only created the first time that a
+    // particular configuration is encountered.
+    const std::string cache_key = getScheduleCacheKey(d_transaction_comps);
+    const auto cache_it = d_schedule_cache.find(cache_key);
+    const bool cache_hit = cache_it != d_schedule_cache.end();
+    if (cache_hit)
+    {
+        IBTK_TIMER_START(t_reset_transaction_components_cache_hit);
+        ScheduleCacheEntry& cache_entry = cache_it->second;
+        cache_entry.last_use = ++d_schedule_cache_use_count;
+        d_coarsen_alg = cache_entry.coarsen_alg;
+        d_coarsen_scheds = cache_entry.coarsen_scheds;
+        d_refine_alg = cache_entry.refine_alg;
+        d_refine_scheds = cache_entry.refine_scheds;
+        ++d_schedule_cache_hits;
+    }
+    else
+    {
+        IBTK_TIMER_START(t_reset_transaction_components_cache_miss);
+    }
+
+    // Setup new coarsen algorithms and schedules.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    bool registered_coarsen_op = false;
-    d_coarsen_alg = new CoarsenAlgorithm<NDIM>();
-    for (const auto& transaction_comp : d_transaction_comps)
+    if (!cache_hit)
     {
-        const std::string& coarsen_op_name = transaction_comp.d_coarsen_op_name;
-        if (coarsen_op_name != "NONE")
+        bool registered_coarsen_op = false;
+        d_coarsen_alg = new CoarsenAlgorithm<NDIM>();
+        for (const auto& transaction_comp : d_transaction_comps)
         {
-            const int src_data_idx = transaction_comp.d_src_data_idx;
-            Pointer<Variable<NDIM> > var;
-            var_db->mapIndexToVariable(src_data_idx, var);
+            const std::string& coarsen_op_name = transaction_comp.d_coarsen_op_name;
+            if (coarsen_op_name != "NONE")
+            {
+                const int src_data_idx = transaction_comp.d_src_data_idx;
+                Pointer<Variable<NDIM> > var;
+                var_db->mapIndexToVariable(src_data_idx, var);
 #if !defined(NDEBUG)
-            TBOX_ASSERT(var);
+                TBOX_ASSERT(var);
 #endif
-            Pointer<CoarsenOperator<NDIM> > coarsen_op = d_grid_geom->lookupCoarsenOperator(var, coarsen_op_name);
+                Pointer<CoarsenOperator<NDIM> > coarsen_op = d_grid_geom->lookupCoarsenOperator(var, coarsen_op_name);
 #if !defined(NDEBUG)
-            TBOX_ASSERT(coarsen_op);
+                TBOX_ASSERT(coarsen_op);
 #endif
-            d_coarsen_alg->registerCoarsen(src_data_idx, src_data_idx, coarsen_op);
-            registered_coarsen_op = true;
+                d_coarsen_alg->registerCoarsen(src_data_idx, src_data_idx, coarsen_op);
+                registered_coarsen_op = true;
+            }
         }
-    }
 
-    if (registered_coarsen_op)
-    {
-        for (int src_ln = std::max(1, d_coarsest_ln); src_ln <= d_finest_ln; ++src_ln)
+        d_coarsen_scheds.clear();
+        d_coarsen_scheds.resize(d_finest_ln + 1);
+        if (registered_coarsen_op)
         {
-            d_coarsen_alg->resetSchedule(d_coarsen_scheds[src_ln]);
+            for (int src_ln = std::max(1, d_coarsest_ln); src_ln <= d_finest_ln; ++src_ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(src_ln);
+                Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(src_ln - 1);
+                d_coarsen_scheds[src_ln] = d_coarsen_alg->createSchedule(coarser_level, level, d_coarsen_strategy);
+            }
         }
     }
 
-    // Reset cached refine algorithms and schedules.
-    d_refine_alg = new RefineAlgorithm<NDIM>();
+    // Reset the refine patch strategies and, if necessary, setup new refine
+    // algorithms.
+    if (!cache_hit) d_refine_alg = new RefineAlgorithm<NDIM>();
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
         const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
@@ -437,46 +492,51 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
         Pointer<NodeVariable<NDIM, double> > nc_var = var;
         Pointer<SideVariable<NDIM, double> > sc_var = var;
         Pointer<EdgeVariable<NDIM, double> > ec_var = var;
-        Pointer<RefineOperator<NDIM> > refine_op = nullptr;
-        Pointer<VariableFillPattern<NDIM> > fill_pattern = d_transaction_comps[comp_idx].d_fill_pattern;
         if (d_cf_bdry_ops[comp_idx]) d_cf_bdry_ops[comp_idx]->setPatchDataIndex(dst_data_idx);
-        if (cc_var)
+
+        // The refine operators only need to be looked up when new refine
+        // algorithms are created.
+        if (!cache_hit)
         {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+            Pointer<RefineOperator<NDIM> > refine_op = nullptr;
+            Pointer<VariableFillPattern<NDIM> > fill_pattern = d_transaction_comps[comp_idx].d_fill_pattern;
+            if (cc_var)
             {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+                {
+                    refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                }
             }
-        }
-        else if (nc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+            else if (nc_var)
             {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+                {
+                    refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                }
             }
-        }
-        else if (sc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+            else if (sc_var)
             {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+                {
+                    refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                }
             }
-        }
-        else if (ec_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+            else if (ec_var)
             {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+                {
+                    refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+                }
             }
+            else
+            {
+                TBOX_ERROR("HierarchyGhostCellInterpolation::resetTransactionComponents():\n"
+                           << "  only double-precision cell-, node-, side-, or edge-centered data is "
+                              "presently supported."
+                           << std::endl);
+            }
+            d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
         }
-        else
-        {
-            TBOX_ERROR("HierarchyGhostCellInterpolation::resetTransactionComponents():\n"
-                       << "  only double-precision cell-, node-, side-, or edge-centered data is "
-                          "presently supported."
-                       << std::endl);
-        }
-
-        d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
 
         const std::string& phys_bdry_extrap_type = d_transaction_comps[comp_idx].d_phys_bdry_extrap_type;
         if (d_extrap_bc_ops[comp_idx])
@@ -523,9 +583,25 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
         }
     }
 
-    for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
+    if (cache_hit)
     {
-        d_refine_alg->resetSchedule(d_refine_scheds[dst_ln]);
+        IBTK_TIMER_STOP(t_reset_transaction_components_cache_hit);
+    }
+    else
+    {
+        // Setup new refine schedules and cache the new communication
+        // schedules.
+        d_refine_scheds.clear();
+        d_refine_scheds.resize(d_finest_ln + 1);
+        for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+            d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
+        }
+
+        cacheSchedules(cache_key);
+        ++d_schedule_cache_misses;
+        IBTK_TIMER_STOP(t_reset_transaction_components_cache_miss);
     }
 
     IBTK_TIMER_STOP(t_reset_transaction_components);
@@ -559,6 +635,8 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
     d_sc_robin_bc_ops.clear();
 
     // Clear cached communication schedules.
+    d_schedule_cache.clear();
+    d_schedule_cache_use_count = 0;
     d_coarsen_alg.setNull();
     delete d_coarsen_strategy;
     d_coarsen_strategy = nullptr;
@@ -662,10 +740,109 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     return;
 } // fillData
 
+int
+HierarchyGhostCellInterpolation::getNumberOfScheduleCacheHits() const
+{
+    return d_schedule_cache_hits;
+} // getNumberOfScheduleCacheHits
+
+int
+HierarchyGhostCellInterpolation::getNumberOfScheduleCacheMisses() const
+{
+    return d_schedule_cache_misses;
+} // getNumberOfScheduleCacheMisses
+
+unsigned int
+HierarchyGhostCellInterpolation::getMaxScheduleCacheSize()
+{
+    return MAX_SCHEDULE_CACHE_SIZE;
+} // getMaxScheduleCacheSize
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+std::string
+HierarchyGhostCellInterpolation::getScheduleCacheKey(
+    const std::vector<InterpolationTransactionComponent>& transaction_comps)
+{
+    // Fill patterns are typically allocated anew for each transaction
+    // component, so the fill patterns provided by SAMRAI and IBTK are
+    // identified by their types and parameters rather than by their addresses.
+    // Fill patterns of other types are identified by their addresses, which
+    // remain valid for as long as the cached algorithms refer to them.
+    std::ostringstream key;
+    for (const auto& transaction_comp : transaction_comps)
+    {
+        key << transaction_comp.d_dst_data_idx << ':' << transaction_comp.d_src_data_idx << ':'
+            << transaction_comp.d_refine_op_name << ':' << transaction_comp.d_use_cf_bdry_interpolation << ':'
+            << transaction_comp.d_coarsen_op_name << ':' << transaction_comp.d_phys_bdry_extrap_type << ':'
+            << transaction_comp.d_consistent_type_2_bdry << ':';
+        key << getFillPatternKey(transaction_comp.d_fill_pattern) << ';';
+    }
+    return key.str();
+} // getScheduleCacheKey
+
+std::string
+HierarchyGhostCellInterpolation::getFillPatternKey(Pointer<VariableFillPattern<NDIM> > fill_pattern)
+{
+    if (!fill_pattern) return "";
+    Pointer<BoxGeometryFillPattern<NDIM> > box_fill_pattern = fill_pattern;
+    if (box_fill_pattern) return box_fill_pattern->getPatternName();
+    std::ostringstream key;
+    Pointer<CellNoCornersFillPattern> cell_no_corners_fill_pattern = fill_pattern;
+    Pointer<SideNoCornersFillPattern> side_no_corners_fill_pattern = fill_pattern;
+    Pointer<EdgeSynchCopyFillPattern> edge_synch_fill_pattern = fill_pattern;
+    Pointer<NodeSynchCopyFillPattern> node_synch_fill_pattern = fill_pattern;
+    Pointer<FaceSynchCopyFillPattern> face_synch_fill_pattern = fill_pattern;
+    Pointer<SideSynchCopyFillPattern> side_synch_fill_pattern = fill_pattern;
+    if (cell_no_corners_fill_pattern || side_no_corners_fill_pattern || edge_synch_fill_pattern ||
+        node_synch_fill_pattern || face_synch_fill_pattern || side_synch_fill_pattern)
+    {
+        key << fill_pattern->getPatternName() << ':' << fill_pattern->getStencilWidth();
+    }
+    else
+    {
+        key << fill_pattern.getPointer();
+    }
+    if (cell_no_corners_fill_pattern)
+    {
+        key << ':' << cell_no_corners_fill_pattern->getIncludeDstPatchBox() << ':'
+            << cell_no_corners_fill_pattern->getIncludeEdgesOnDstLevel() << ':'
+            << cell_no_corners_fill_pattern->getIncludeEdgesOnSrcLevel();
+    }
+    if (side_no_corners_fill_pattern)
+    {
+        key << ':' << side_no_corners_fill_pattern->getIncludeDstPatchBox() << ':'
+            << side_no_corners_fill_pattern->getIncludeEdgesOnDstLevel() << ':'
+            << side_no_corners_fill_pattern->getIncludeEdgesOnSrcLevel();
+    }
+    if (edge_synch_fill_pattern) key << ':' << edge_synch_fill_pattern->getAxis();
+    if (node_synch_fill_pattern) key << ':' << node_synch_fill_pattern->getAxis();
+    return key.str();
+} // getFillPatternKey
+
+void
+HierarchyGhostCellInterpolation::cacheSchedules(const std::string& cache_key)
+{
+    if (d_schedule_cache.size() >= MAX_SCHEDULE_CACHE_SIZE && !d_schedule_cache.count(cache_key))
+    {
+        auto lru_it = d_schedule_cache.begin();
+        for (auto it = d_schedule_cache.begin(); it != d_schedule_cache.end(); ++it)
+        {
+            if (it->second.last_use < lru_it->second.last_use) lru_it = it;
+        }
+        d_schedule_cache.erase(lru_it);
+    }
+    ScheduleCacheEntry& cache_entry = d_schedule_cache[cache_key];
+    cache_entry.coarsen_alg = d_coarsen_alg;
+    cache_entry.coarsen_scheds = d_coarsen_scheds;
+    cache_entry.refine_alg = d_refine_alg;
+    cache_entry.refine_scheds = d_refine_scheds;
+    cache_entry.last_use = ++d_schedule_cache_use_count;
+    return;
+} // cacheSchedules
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
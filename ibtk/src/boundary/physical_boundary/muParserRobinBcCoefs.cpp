@@ -32,6 +32,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <ostream>
 #include <string>
@@ -304,19 +306,10 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             parser->DefineConst(constant.first, constant.second);
         }
-
-        // Variables.
-        parser->DefineVar("T", &d_parser_time);
-        parser->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            const std::string postfix = std::to_string(d);
-            parser->DefineVar("X" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("X_" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x_" + postfix, d_parser_posn.data() + d);
-        }
     }
+
+    // Define the variables.
+    resizeParserVariables(1);
     return;
 } // muParserRobinBcCoefs
 
@@ -348,29 +341,38 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    // Compute the positions of all of the boundary points and evaluate the
+    // functions at all of these points using muParser's bulk mode.
+    const int num_points = bc_coef_box.size();
+    if (num_points == 0) return;
+    resizeParserVariables(num_points);
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_points, fill_time);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
     {
         const Index<NDIM>& i = b();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             if (d != bdry_normal_axis)
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
             }
             else
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
             }
         }
+    }
+    const std::array<Pointer<ArrayData<NDIM, double> >, 3> coef_data = { { acoef_data, bcoef_data, gcoef_data } };
+    const std::array<mu::Parser*, 3> coef_parsers = { { &d_acoef_parsers[location_index],
+                                                        &d_bcoef_parsers[location_index],
+                                                        &d_gcoef_parsers[location_index] } };
+    for (unsigned int l = 0; l < coef_data.size(); ++l)
+    {
+        if (!coef_data[l]) continue;
         try
         {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
+            coef_parsers[l]->Eval(&d_parser_vals[0], num_points);
         }
         catch (mu::ParserError& e)
         {
@@ -387,6 +389,11 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
             TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
                        << "  unrecognized exception generated by muParser library.\n");
         }
+        k = 0;
+        for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
+        {
+            (*coef_data[l])(b(), 0) = d_parser_vals[k];
+        }
     }
     return;
 } // setBcCoefs
@@ -401,6 +408,37 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::resizeParserVariables(const int num_points) const
+{
+    if (num_points <= static_cast<int>(d_parser_vals.size())) return;
+
+    // In bulk mode, muParser reads the value of each variable at an offset
+    // from the address provided to DefineVar(), so the variables need to be
+    // redefined whenever the underlying arrays are reallocated.
+    const int new_size = std::max(num_points, 2 * static_cast<int>(d_parser_vals.size()));
+    d_parser_time.resize(new_size);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(new_size);
+    d_parser_vals.resize(new_size);
+    for (int loc = 0; loc < 2 * NDIM; ++loc)
+    {
+        for (mu::Parser* parser : { &d_acoef_parsers[loc], &d_bcoef_parsers[loc], &d_gcoef_parsers[loc] })
+        {
+            parser->DefineVar("T", &d_parser_time[0]);
+            parser->DefineVar("t", &d_parser_time[0]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const std::string postfix = std::to_string(d);
+                parser->DefineVar("X" + postfix, &d_parser_posn[d][0]);
+                parser->DefineVar("x" + postfix, &d_parser_posn[d][0]);
+                parser->DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+                parser->DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+            }
+        }
+    }
+    return;
+} // resizeParserVariables
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -50,6 +50,7 @@
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianCellDoubleWeightedAverage.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -197,6 +198,102 @@ collect_unique_elems(std::vector<Elem*>& elems, const ContainerOfContainers& ele
     return;
 } // collect_unique_elems
 
+// A uniform grid of bins over a collection of index space boxes that is used
+// to efficiently determine which of the boxes may intersect a query box.
+class BoxBinGrid
+{
+public:
+    BoxBinGrid(const std::vector<Box<NDIM> >& boxes) : d_boxes(boxes), d_bin_width(1), d_num_bins(0)
+    {
+        if (d_boxes.empty()) return;
+
+        // Use bins whose widths are the average box widths, so that the number
+        // of bins is comparable to the number of boxes.
+        IntVector<NDIM> sum_widths(0);
+        for (const auto& box : d_boxes)
+        {
+            d_bounding_box += box;
+            for (unsigned int d = 0; d < NDIM; ++d) sum_widths(d) += box.numberCells(d);
+        }
+        int num_bins = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_bin_width(d) = std::max(1, sum_widths(d) / static_cast<int>(d_boxes.size()));
+            d_num_bins(d) = (d_bounding_box.numberCells(d) + d_bin_width(d) - 1) / d_bin_width(d);
+            num_bins *= d_num_bins(d);
+        }
+        d_bins.resize(num_bins);
+        for (unsigned int k = 0; k < d_boxes.size(); ++k)
+        {
+            forEachBin(d_boxes[k], [&](const int bin) { d_bins[bin].push_back(k); });
+        }
+        return;
+    } // BoxBinGrid
+
+    // Collect the indices of all boxes that intersect the query box.
+    void getIntersectingBoxes(std::vector<unsigned int>& box_idxs, const Box<NDIM>& query_box) const
+    {
+        box_idxs.clear();
+        if (d_boxes.empty()) return;
+        const Box<NDIM> box = query_box * d_bounding_box;
+        if (box.empty()) return;
+        forEachBin(box,
+                   [&](const int bin) { box_idxs.insert(box_idxs.end(), d_bins[bin].begin(), d_bins[bin].end()); });
+        std::sort(box_idxs.begin(), box_idxs.end());
+        box_idxs.erase(std::unique(box_idxs.begin(), box_idxs.end()), box_idxs.end());
+        box_idxs.erase(std::remove_if(box_idxs.begin(),
+                                      box_idxs.end(),
+                                      [&](const unsigned int k) { return !d_boxes[k].intersects(box); }),
+                       box_idxs.end());
+        return;
+    } // getIntersectingBoxes
+
+private:
+    // Apply the specified function to the index of each bin that overlaps the
+    // specified box, which must be contained in the bounding box.
+    template <class Function>
+    void forEachBin(const Box<NDIM>& box, Function f) const
+    {
+        IntVector<NDIM> bin_lower, bin_upper;
+        int num_bins = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            bin_lower(d) = (box.lower(d) - d_bounding_box.lower(d)) / d_bin_width(d);
+            bin_upper(d) = (box.upper(d) - d_bounding_box.lower(d)) / d_bin_width(d);
+            num_bins *= bin_upper(d) - bin_lower(d) + 1;
+        }
+        for (int n = 0; n < num_bins; ++n)
+        {
+            int bin = 0, offset = 1, r = n;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const int extent = bin_upper(d) - bin_lower(d) + 1;
+                bin += (bin_lower(d) + r % extent) * offset;
+                offset *= d_num_bins(d);
+                r /= extent;
+            }
+            f(bin);
+        }
+        return;
+    } // forEachBin
+
+    std::vector<Box<NDIM> > d_boxes;
+    Box<NDIM> d_bounding_box;
+    IntVector<NDIM> d_bin_width, d_num_bins;
+    std::vector<std::vector<unsigned int> > d_bins;
+};
+
+// Compute the (conservative) index space box on the specified level that
+// covers the specified physical bounding box.
+inline Box<NDIM>
+get_index_box(const std::pair<Point, Point>& bbox,
+              const Pointer<CartesianGridGeometry<NDIM> >& grid_geom,
+              const IntVector<NDIM>& ratio)
+{
+    return Box<NDIM>(IndexUtilities::getCellIndex(bbox.first, grid_geom, ratio),
+                     IndexUtilities::getCellIndex(bbox.second, grid_geom, ratio));
+} // get_index_box
+
 inline short int
 get_dirichlet_bdry_ids(const std::vector<short int>& bdry_ids)
 {
@@ -493,6 +590,7 @@ FEDataManager::reinitElementMappings()
     d_active_patch_elem_map.clear();
     d_active_patch_node_map.clear();
     d_active_patch_ghost_dofs.clear();
+    d_active_elem_bbox_ids.clear();
     d_active_elem_bboxes.clear();
     d_system_ghost_vec.clear();
 
@@ -503,7 +601,7 @@ FEDataManager::reinitElementMappings()
 
     // Reset the mappings between grid patches and active mesh
     // elements. collectActivePatchElements will populate d_active_elem_bboxes
-    // and use it.
+    // (and d_active_elem_bbox_ids) and use them.
     collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
     collectActivePatchNodes(d_active_patch_node_map, d_active_patch_elem_map);
 
@@ -2604,12 +2702,17 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
     return;
 } // updateQuadPointCountData
 
-std::vector<std::pair<Point, Point> >*
-FEDataManager::computeActiveElementBoundingBoxes()
+void
+FEDataManager::computeActiveElementBoundingBoxes(const int level_number, const IntVector<NDIM>& ghost_width)
 {
     // Get the necessary FE data.
     const MeshBase& mesh = d_es->get_mesh();
-    const unsigned int n_elem = mesh.max_elem_id() + 1;
+
+    // The receiving process looks up the elements by id, so every element must
+    // be available on every process.
+#if 1 < LIBMESH_MINOR_VERSION
+    TBOX_ASSERT(mesh.is_replicated());
+#endif
     System& X_system = d_es->get_system(COORDINATES_SYSTEM_NAME);
     const unsigned int X_sys_num = X_system.number();
     NumericVector<double>& X_vec = *X_system.solution;
@@ -2618,19 +2721,17 @@ FEDataManager::computeActiveElementBoundingBoxes()
 
     // Compute the lower and upper bounds of all active local elements in the
     // mesh.  Assumes nodal basis functions.
-    d_active_elem_bboxes.resize(n_elem);
-    std::fill(d_active_elem_bboxes.begin(), d_active_elem_bboxes.end(), std::make_pair(Point::Zero(), Point::Zero()));
+    std::vector<unsigned int> local_elem_ids;
+    std::vector<std::pair<Point, Point> > local_elem_bboxes;
     std::vector<unsigned int> dof_indices;
+    std::vector<double> X_node;
     MeshBase::const_element_iterator el_it = mesh.active_local_elements_begin();
     const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
     for (; el_it != el_end; ++el_it)
     {
         const Elem* const elem = *el_it;
-        const unsigned int elem_id = elem->id();
-        Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
-        Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
-        elem_lower_bound = Point::Constant(std::numeric_limits<double>::max());
-        elem_upper_bound = Point::Constant(-std::numeric_limits<double>::max());
+        Point elem_lower_bound = Point::Constant(std::numeric_limits<double>::max());
+        Point elem_upper_bound = Point::Constant(-std::numeric_limits<double>::max());
 
         const unsigned int n_nodes = elem->n_nodes();
         dof_indices.clear();
@@ -2643,7 +2744,6 @@ FEDataManager::computeActiveElementBoundingBoxes()
                 dof_indices.push_back(node->dof_number(X_sys_num, d, 0));
             }
         }
-        std::vector<double> X_node;
         X_ghost_vec.get(dof_indices, X_node);
         for (unsigned int k = 0; k < n_nodes; ++k)
         {
@@ -2654,30 +2754,106 @@ FEDataManager::computeActiveElementBoundingBoxes()
                 elem_upper_bound[d] = std::max(elem_upper_bound[d], X);
             }
         }
+        local_elem_ids.push_back(elem->id());
+        local_elem_bboxes.push_back(std::make_pair(elem_lower_bound, elem_upper_bound));
     }
 
-    // Parallel sum elem_lower_bound and elem_upper_bound so that each process
-    // has access to the bounding box data for each active element in the mesh.
-    std::vector<double> d_active_elem_bboxes_flattened(2 * NDIM * n_elem);
-    for (unsigned int e = 0; e < n_elem; ++e)
+    // Determine the processes that own a patch that may intersect each local
+    // element bounding box.  The patch boxes are grown by one additional cell
+    // to account for round-off error in converting physical coordinates to
+    // cell indices; the exact intersection test is performed by the receiving
+    // process.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+    std::vector<Box<NDIM> > patch_boxes(level_boxes.getNumberOfBoxes());
+    for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
     {
-        for (unsigned int d = 0; d < NDIM; ++d)
+        patch_boxes[k] = Box<NDIM>::grow(level_boxes[k], ghost_width + 1);
+    }
+    const BoxBinGrid patch_box_grid(patch_boxes);
+
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    static const int BBOX_SIZE = 1 + 2 * NDIM;
+    std::vector<std::vector<double> > send_data(mpi_size);
+    d_active_elem_bbox_ids.clear();
+    d_active_elem_bboxes.clear();
+    std::vector<unsigned int> patch_idxs;
+    std::vector<int> dest_ranks;
+    for (unsigned int e = 0; e < local_elem_ids.size(); ++e)
+    {
+        const std::pair<Point, Point>& bbox = local_elem_bboxes[e];
+        patch_box_grid.getIntersectingBoxes(patch_idxs, get_index_box(bbox, grid_geom, ratio));
+        dest_ranks.clear();
+        for (const unsigned int k : patch_idxs)
         {
-            d_active_elem_bboxes_flattened[2 * e * NDIM + d] = d_active_elem_bboxes[e].first[d];
-            d_active_elem_bboxes_flattened[(2 * e + 1) * NDIM + d] = d_active_elem_bboxes[e].second[d];
+            dest_ranks.push_back(processor_mapping.getProcessorAssignment(k));
+        }
+        std::sort(dest_ranks.begin(), dest_ranks.end());
+        dest_ranks.erase(std::unique(dest_ranks.begin(), dest_ranks.end()), dest_ranks.end());
+        for (const int rank : dest_ranks)
+        {
+            if (rank == mpi_rank)
+            {
+                d_active_elem_bbox_ids.push_back(local_elem_ids[e]);
+                d_active_elem_bboxes.push_back(bbox);
+                continue;
+            }
+            std::vector<double>& buf = send_data[rank];
+            buf.push_back(static_cast<double>(local_elem_ids[e]));
+            buf.insert(buf.end(), bbox.first.data(), bbox.first.data() + NDIM);
+            buf.insert(buf.end(), bbox.second.data(), bbox.second.data() + NDIM);
         }
     }
-    SAMRAI_MPI::sumReduction(&d_active_elem_bboxes_flattened[0],
-                             static_cast<int>(d_active_elem_bboxes_flattened.size()));
-    for (unsigned int e = 0; e < n_elem; ++e)
+
+    // Exchange the bounding boxes.  Only the message sizes are communicated
+    // between all pairs of processes.
+    std::vector<int> send_counts(mpi_size), send_displs(mpi_size + 1, 0);
+    std::vector<int> recv_counts(mpi_size), recv_displs(mpi_size + 1, 0);
+    for (int rank = 0; rank < mpi_size; ++rank)
     {
+        send_counts[rank] = static_cast<int>(send_data[rank].size());
+        send_displs[rank + 1] = send_displs[rank] + send_counts[rank];
+    }
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    int ierr = MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, communicator);
+    TBOX_ASSERT(ierr == 0);
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        recv_displs[rank + 1] = recv_displs[rank] + recv_counts[rank];
+    }
+    std::vector<double> send_buf, recv_buf(recv_displs[mpi_size]);
+    send_buf.reserve(send_displs[mpi_size]);
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        send_buf.insert(send_buf.end(), send_data[rank].begin(), send_data[rank].end());
+        std::vector<double>().swap(send_data[rank]);
+    }
+    ierr = MPI_Alltoallv(send_buf.data(),
+                         send_counts.data(),
+                         send_displs.data(),
+                         MPI_DOUBLE,
+                         recv_buf.data(),
+                         recv_counts.data(),
+                         recv_displs.data(),
+                         MPI_DOUBLE,
+                         communicator);
+    TBOX_ASSERT(ierr == 0);
+    for (unsigned int k = 0; k + BBOX_SIZE <= recv_buf.size(); k += BBOX_SIZE)
+    {
+        Point elem_lower_bound, elem_upper_bound;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            d_active_elem_bboxes[e].first[d] = d_active_elem_bboxes_flattened[2 * e * NDIM + d];
-            d_active_elem_bboxes[e].second[d] = d_active_elem_bboxes_flattened[(2 * e + 1) * NDIM + d];
+            elem_lower_bound[d] = recv_buf[k + 1 + d];
+            elem_upper_bound[d] = recv_buf[k + 1 + NDIM + d];
         }
+        d_active_elem_bbox_ids.push_back(static_cast<unsigned int>(recv_buf[k]));
+        d_active_elem_bboxes.push_back(std::make_pair(elem_lower_bound, elem_upper_bound));
     }
-    return &d_active_elem_bboxes;
+    return;
 } // computeActiveElementBoundingBoxes
 
 void
@@ -2686,7 +2862,7 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
                                           const IntVector<NDIM>& ghost_width)
 {
     // Get the necessary FE data.
-    const MeshBase& mesh = d_es->get_mesh();
+    MeshBase& mesh = d_es->get_mesh();
     const Parallel::Communicator& comm = mesh.comm();
     const unsigned int dim = mesh.mesh_dimension();
     System& X_system = d_es->get_system(COORDINATES_SYSTEM_NAME);
@@ -2718,14 +2894,14 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // specified ghost cell width.
     //
     // NOTE: Following the call to computeActiveElementBoundingBoxes, each
-    // processor will have access to all of the element bounding boxes.  This is
-    // not a scalable approach, but we won't worry about this until it becomes
-    // an actual issue.
-    computeActiveElementBoundingBoxes();
-    int local_patch_num = 0;
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    // processor will have access only to the bounding boxes of those elements
+    // that may intersect one of its local patches.  A bin grid over the local
+    // patch boxes is used to avoid testing each element against each patch.
+    computeActiveElementBoundingBoxes(level_number, ghost_width);
+    std::vector<Box<NDIM> > local_patch_boxes;
+    std::vector<std::pair<Point, Point> > local_patch_extents;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
-        std::set<Elem*>& frontier_elems = frontier_patch_elems[local_patch_num];
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
         const double* const dx = pgeom->getDx();
@@ -2736,15 +2912,21 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
             x_lower[d] = pgeom->getXLower()[d] - dx[d] * ghost_width[d];
             x_upper[d] = pgeom->getXUpper()[d] + dx[d] * ghost_width[d];
         }
-
-        MeshBase::const_element_iterator el_it = mesh.active_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
-        for (; el_it != el_end; ++el_it)
+        local_patch_boxes.push_back(Box<NDIM>::grow(patch->getBox(), ghost_width + 1));
+        local_patch_extents.push_back(std::make_pair(x_lower, x_upper));
+    }
+    const BoxBinGrid local_patch_box_grid(local_patch_boxes);
+    std::vector<unsigned int> patch_idxs;
+    for (unsigned int e = 0; e < d_active_elem_bbox_ids.size(); ++e)
+    {
+        const Point& elem_lower_bound = d_active_elem_bboxes[e].first;
+        const Point& elem_upper_bound = d_active_elem_bboxes[e].second;
+        local_patch_box_grid.getIntersectingBoxes(patch_idxs,
+                                                  get_index_box(d_active_elem_bboxes[e], grid_geom, ratio));
+        for (const unsigned int local_patch_num : patch_idxs)
         {
-            Elem* const elem = *el_it;
-            const unsigned int elem_id = elem->id();
-            const Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
-            const Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
+            const Point& x_lower = local_patch_extents[local_patch_num].first;
+            const Point& x_upper = local_patch_extents[local_patch_num].second;
             bool in_patch = true;
             for (unsigned int d = 0; d < NDIM && in_patch; ++d)
             {
@@ -2753,7 +2935,7 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
             }
             if (in_patch)
             {
-                frontier_elems.insert(elem);
+                frontier_patch_elems[local_patch_num].insert(mesh.elem_ptr(d_active_elem_bbox_ids[e]));
             }
         }
     }
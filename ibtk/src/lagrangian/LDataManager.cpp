@@ -34,6 +34,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -161,6 +162,7 @@ static Timer* t_put_to_database;
 static Timer* t_begin_nonlocal_data_fill;
 static Timer* t_end_nonlocal_data_fill;
 static Timer* t_compute_node_distribution;
+static Timer* t_update_nonlocal_node_distribution;
 static Timer* t_compute_node_offsets;
 
 // Assume max(U)dt/dx <= 2.
@@ -294,6 +296,7 @@ LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_num_nodes.resize(d_finest_ln + 1);
     d_node_offset.resize(d_finest_ln + 1);
     d_local_lag_indices.resize(d_finest_ln + 1);
+    d_local_node_permutation.resize(d_finest_ln + 1);
     d_nonlocal_lag_indices.resize(d_finest_ln + 1);
     d_local_petsc_indices.resize(d_finest_ln + 1);
     d_nonlocal_petsc_indices.resize(d_finest_ln + 1);
@@ -923,42 +926,55 @@ LDataManager::createLData(const std::string& quantity_name,
 
 Point
 LDataManager::computeLagrangianStructureCenterOfMass(const int structure_id, const int level_number)
+{
+    return computeLagrangianStructureCentersOfMass(std::vector<int>(1, structure_id), level_number)[0];
+} // computeLagrangianStructureCenterOfMass
+
+std::vector<Point>
+LDataManager::computeLagrangianStructureCentersOfMass(const std::vector<int>& structure_ids, const int level_number)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
 #endif
-    int node_counter = 0;
-    Point X_com(Point::Zero());
-    std::pair<int, int> lag_idx_range = getLagrangianStructureIndexRange(structure_id, level_number);
+    const int num_structs = static_cast<int>(structure_ids.size());
+    std::map<int, int> struct_id_to_position;
+    for (int k = 0; k < num_structs; ++k) struct_id_to_position[structure_ids[k]] = k;
 
+    // Accumulate the node positions and node counts of all structures in a
+    // single buffer, so that they can be reduced together.
+    std::vector<double> com_data(num_structs * (NDIM + 1), 0.0);
     const boost::multi_array_ref<double, 2>& X_data =
         *d_lag_mesh_data[level_number][POSN_DATA_NAME]->getLocalFormVecArray();
     const Pointer<LMesh> mesh = getLMesh(level_number);
     const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
     for (const auto& node_idx : local_nodes)
     {
-        const int lag_idx = node_idx->getLagrangianIndex();
-        if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+        const int strct_id = getLagrangianStructureID(node_idx->getLagrangianIndex(), level_number);
+        const auto it = struct_id_to_position.find(strct_id);
+        if (it == struct_id_to_position.end()) continue;
+        double* const com = &com_data[it->second * (NDIM + 1)];
+        const int local_idx = node_idx->getLocalPETScIndex();
+        const double* const X = &X_data[local_idx][0];
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            ++node_counter;
-            const int local_idx = node_idx->getLocalPETScIndex();
-            const double* const X = &X_data[local_idx][0];
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_com[d] += X[d];
-            }
+            com[d] += X[d];
         }
+        com[NDIM] += 1.0;
     }
     d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
 
-    SAMRAI_MPI::sumReduction(&X_com[0], NDIM);
-    node_counter = SAMRAI_MPI::sumReduction(node_counter);
-    for (unsigned int d = 0; d < NDIM; ++d)
+    SAMRAI_MPI::sumReduction(com_data.data(), static_cast<int>(com_data.size()));
+    std::vector<Point> X_com(num_structs, Point::Zero());
+    for (int k = 0; k < num_structs; ++k)
     {
-        X_com[d] /= static_cast<double>(node_counter);
+        const double* const com = &com_data[k * (NDIM + 1)];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_com[k][d] = com[d] / com[NDIM];
+        }
     }
     return X_com;
-} // computeLagrangianStructureCenterOfMass
+} // computeLagrangianStructureCentersOfMass
 
 std::pair<Point, Point>
 LDataManager::computeLagrangianStructureBoundingBox(const int structure_id, const int level_number)
@@ -1460,6 +1476,13 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
     // multiple grid cells within the ghost cell region.  We must therefore
     // ensure that nodes passing through periodic boundaries are added to the
     // patch only once.
+    //
+    // When incremental redistribution is enabled, we also keep track of
+    // whether any node changes the patch whose interior contains it.
+    d_redistribution_levels.clear();
+    d_redistribution_levels.resize(finest_ln + 1);
+    d_nodes_changed_patches.clear();
+    d_nodes_changed_patches.resize(finest_ln + 1, true);
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         if (!d_level_contains_lag_data[level_number]) continue;
@@ -1468,6 +1491,8 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
         const IntVector<NDIM>& ratio = level->getRatio();
+        int nodes_changed_patches = 0;
+        std::vector<int> interior_local_idxs;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -1476,6 +1501,17 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
                 new LNodeSetData(current_idx_data->getBox(), current_idx_data->getGhostCellWidth());
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            if (d_use_incremental_redistribution && !nodes_changed_patches)
+            {
+                interior_local_idxs.clear();
+                for (LNodeSetData::DataIterator it = current_idx_data->data_begin(patch_box);
+                     it != current_idx_data->data_end();
+                     ++it)
+                {
+                    interior_local_idxs.push_back((*it)->getLocalPETScIndex());
+                }
+                std::sort(interior_local_idxs.begin(), interior_local_idxs.end());
+            }
             std::set<int> registered_periodic_idx;
             for (LNodeSetData::CellIterator it(Box<NDIM>::grow(patch_box, IntVector<NDIM>(CFL_WIDTH))); it; it++)
             {
@@ -1488,6 +1524,14 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
                         const int local_idx = node_idx->getLocalPETScIndex();
                         double* const X = &X_data[local_idx][0];
                         const CellIndex<NDIM> new_cell_idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+                        if (d_use_incremental_redistribution && !nodes_changed_patches)
+                        {
+                            // NOTE: Periodic images of interior nodes may also
+                            // appear in the ghost cell region of the patch.
+                            const bool old_interior_node = std::binary_search(
+                                interior_local_idxs.begin(), interior_local_idxs.end(), local_idx);
+                            if (old_interior_node != patch_box.contains(new_cell_idx)) nodes_changed_patches = 1;
+                        }
                         if (patch_box.contains(new_cell_idx))
                         {
                             auto it_offset = periodic_offset_data[level_number].find(local_idx);
@@ -1525,6 +1569,11 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
         }
         d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
         d_needs_synch[level_number] = true;
+        if (d_use_incremental_redistribution)
+        {
+            d_redistribution_levels[level_number] = level;
+            d_nodes_changed_patches[level_number] = SAMRAI_MPI::maxReduction(nodes_changed_patches) != 0;
+        }
     }
 
     IBTK_TIMER_STOP(t_begin_data_redistribution);
@@ -1556,6 +1605,29 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
     }
 
+    // Determine which levels may be redistributed incrementally.  This is
+    // possible only if the level was not regenerated since the call to
+    // beginDataRedistribution(), no structures were displaced, and no node has
+    // changed the patch whose interior contains it.
+    //
+    // NOTE: Nodes are never migrated between processes here.  Because regridding
+    // regenerates every level finer than the coarsest level, this shortcut
+    // generally applies only to the coarsest level or to redistributions that
+    // are not accompanied by a regrid.
+    std::vector<bool> redistribute_incrementally(finest_ln + 1, false);
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        if (!d_use_incremental_redistribution || !d_level_contains_lag_data[level_number]) continue;
+        if (level_number >= static_cast<int>(d_redistribution_levels.size())) continue;
+        const Pointer<PatchLevel<NDIM> > old_level = d_redistribution_levels[level_number];
+        redistribute_incrementally[level_number] =
+            old_level && old_level.getPointer() == d_hierarchy->getPatchLevel(level_number).getPointer() &&
+            !d_nodes_changed_patches[level_number] && d_displaced_strct_ids[level_number].empty() &&
+            d_ao[level_number];
+    }
+    d_redistribution_levels.clear();
+    d_nodes_changed_patches.clear();
+
     // Update parallel data structures to account for any displaced nodes.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
@@ -1743,6 +1815,56 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         if (!d_level_contains_lag_data[level_number]) continue;
 
         std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
+
+        // When the level is redistributed incrementally, the local nodes keep
+        // their PETSc indices and only the nonlocal nodes are renumbered.  The
+        // LData objects need to be reallocated only if the set of nonlocal
+        // nodes has changed, and the local values are copied directly.
+        //
+        // NOTE: No permutation is applied to the local nodes in this case, so
+        // the local node permutation of the level is cleared.
+        if (redistribute_incrementally[level_number])
+        {
+            d_local_node_permutation[level_number].clear();
+            const bool nonlocal_nodes_changed = updateNonlocalNodeDistribution(
+                d_nonlocal_lag_indices[level_number], d_nonlocal_petsc_indices[level_number], level_number);
+            num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
+            num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
+            if (!nonlocal_nodes_changed) continue;
+            for (const auto& level_data_pair : level_data)
+            {
+                Pointer<LData> data = level_data_pair.second;
+#if !defined(NDEBUG)
+                TBOX_ASSERT(data);
+#endif
+                const int depth = data->getDepth();
+                Vec new_vec;
+                ierr = VecCreateGhostBlock(
+                    PETSC_COMM_WORLD,
+                    depth,
+                    depth * num_local_nodes[level_number],
+                    PETSC_DECIDE,
+                    num_nonlocal_nodes[level_number],
+                    num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : nullptr,
+                    &new_vec);
+                IBTK_CHKERRQ(ierr);
+                Vec old_vec = data->getVec();
+                const double* old_vals;
+                double* new_vals;
+                ierr = VecGetArrayRead(old_vec, &old_vals);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecGetArray(new_vec, &new_vals);
+                IBTK_CHKERRQ(ierr);
+                std::copy(old_vals, old_vals + depth * num_local_nodes[level_number], new_vals);
+                ierr = VecRestoreArray(new_vec, &new_vals);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecRestoreArrayRead(old_vec, &old_vals);
+                IBTK_CHKERRQ(ierr);
+                data->resetData(new_vec, d_nonlocal_petsc_indices[level_number]);
+            }
+            continue;
+        }
+
         const std::vector<int>::size_type num_data = level_data.size();
         src_vec[level_number].resize(num_data);
         dst_vec[level_number].resize(num_data);
@@ -1879,7 +2001,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_node_ordering != PATCH_LNODE_ORDERING);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1913,7 +2035,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     // contexts.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
-        if (!d_level_contains_lag_data[level_number]) continue;
+        if (!d_level_contains_lag_data[level_number] || redistribute_incrementally[level_number]) continue;
 
         std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
         std::map<std::string, Pointer<LData> >::iterator it;
@@ -1943,12 +2065,15 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     {
         d_needs_synch[level_number] = false;
 
-        if (d_ao[level_number])
+        if (!redistribute_incrementally[level_number])
         {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
+            if (d_ao[level_number])
+            {
+                ierr = AODestroy(&d_ao[level_number]);
+                IBTK_CHKERRQ(ierr);
+            }
+            d_ao[level_number] = new_ao[level_number];
         }
-        d_ao[level_number] = new_ao[level_number];
 
         for (auto& IS : src_IS[level_number])
         {
@@ -2147,6 +2272,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_num_nodes.resize(level_number + 1);
         d_node_offset.resize(level_number + 1);
         d_local_lag_indices.resize(level_number + 1);
+        d_local_node_permutation.resize(level_number + 1);
         d_nonlocal_lag_indices.resize(level_number + 1);
         d_local_petsc_indices.resize(level_number + 1);
         d_nonlocal_petsc_indices.resize(level_number + 1);
@@ -2732,6 +2858,8 @@ LDataManager::LDataManager(std::string object_name,
         t_end_nonlocal_data_fill = TimerManager::getManager()->getTimer("IBTK::LDataManager::endNonlocalDataFill()");
         t_compute_node_distribution =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeDistribution()");
+        t_update_nonlocal_node_distribution =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::updateNonlocalNodeDistribution()");
         t_compute_node_offsets = TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()"););
     return;
 } // LDataManager
@@ -2914,19 +3042,60 @@ LDataManager::computeNodeDistribution(AO& ao,
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
 
     // Collect the local nodes and assign local indices to the local nodes.
+    //
+    // NOTE: The nodes of each patch are numbered contiguously.  Within each
+    // patch, the nodes are optionally sorted along a space-filling curve over
+    // the cell indices of the patch so that nodes that are close in index space
+    // are also close in memory.
     unsigned int local_offset = 0;
     std::map<int, int> lag_idx_to_petsc_idx;
+    std::vector<int>& local_node_permutation = d_local_node_permutation[level_number];
+    local_node_permutation.clear();
 #if 1
+    std::vector<LNode*> patch_nodes;
+    std::vector<std::uint64_t> patch_node_keys;
+    std::vector<int> patch_node_order;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
+        const Index<NDIM>& patch_lower = patch_box.lower();
+        int num_bits = 1;
+        while ((1 << num_bits) < patch_box.numberCells().max()) ++num_bits;
         const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        patch_nodes.clear();
+        patch_node_keys.clear();
         for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
         {
-            LNode* const node_idx = *it;
+            patch_nodes.push_back(*it);
+            switch (d_node_ordering)
+            {
+            case MORTON_LNODE_ORDERING:
+                patch_node_keys.push_back(IndexUtilities::getMortonIndex(it.getCellIndex(), patch_lower));
+                break;
+            case HILBERT_LNODE_ORDERING:
+                patch_node_keys.push_back(IndexUtilities::getHilbertIndex(it.getCellIndex(), patch_lower, num_bits));
+                break;
+            default:
+                patch_node_keys.push_back(0);
+            }
+        }
+        const int num_patch_nodes = static_cast<int>(patch_nodes.size());
+        patch_node_order.resize(num_patch_nodes);
+        std::iota(patch_node_order.begin(), patch_node_order.end(), 0);
+        if (d_node_ordering != PATCH_LNODE_ORDERING)
+        {
+            std::stable_sort(patch_node_order.begin(), patch_node_order.end(), [&patch_node_keys](int a, int b) {
+                return patch_node_keys[a] < patch_node_keys[b];
+            });
+        }
+        const int patch_offset = static_cast<int>(local_offset);
+        for (int k = 0; k < num_patch_nodes; ++k)
+        {
+            LNode* const node_idx = patch_nodes[patch_node_order[k]];
             const int lag_idx = node_idx->getLagrangianIndex();
             local_lag_indices.push_back(lag_idx);
+            local_node_permutation.push_back(patch_offset + patch_node_order[k]);
             const int petsc_idx = local_offset++;
             node_idx->setLocalPETScIndex(petsc_idx);
             lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
@@ -3074,6 +3243,89 @@ LDataManager::computeNodeDistribution(AO& ao,
     return;
 } // computeNodeDistribution
 
+bool
+LDataManager::updateNonlocalNodeDistribution(std::vector<int>& nonlocal_lag_indices,
+                                             std::vector<int>& nonlocal_petsc_indices,
+                                             const int level_number)
+{
+    IBTK_TIMER_START(t_update_nonlocal_node_distribution);
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= d_coarsest_ln && level_number <= d_finest_ln);
+    TBOX_ASSERT(d_ao[level_number]);
+#endif
+
+    // Collect the nodes in the ghost cell regions of the patches.  The interior
+    // nodes of each patch retain their local and global PETSc indices, but the
+    // nodes in the ghost cell regions may have been filled from patches owned
+    // by other processors.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    std::vector<LNode*> ghost_nodes;
+    std::vector<int> ghost_node_petsc_idxs;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        BoxList<NDIM> ghost_boxes = idx_data->getGhostBox();
+        ghost_boxes.removeIntersections(patch_box);
+        for (BoxList<NDIM>::Iterator bl(ghost_boxes); bl; bl++)
+        {
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(bl()); it != idx_data->data_end(); ++it)
+            {
+                LNode* const node_idx = *it;
+                ghost_nodes.push_back(node_idx);
+                ghost_node_petsc_idxs.push_back(node_idx->getLagrangianIndex());
+            }
+        }
+    }
+
+    // Determine the global PETSc indices of the ghost nodes using the existing
+    // application ordering.
+    const int num_ghost_nodes = static_cast<int>(ghost_nodes.size());
+    int ierr = AOApplicationToPetsc(d_ao[level_number],
+                                    (num_ghost_nodes > 0 ? num_ghost_nodes : static_cast<int>(s_ao_dummy.size())),
+                                    (num_ghost_nodes > 0 ? &ghost_node_petsc_idxs[0] : &s_ao_dummy[0]));
+    IBTK_CHKERRQ(ierr);
+
+    // Assign local PETSc indices to the ghost nodes.  Nodes owned by this
+    // processor keep their local indices, and nonlocal nodes are numbered in
+    // the order in which they are first encountered.
+    const int num_local_nodes = static_cast<int>(d_local_lag_indices[level_number].size());
+    const int node_offset = static_cast<int>(d_node_offset[level_number]);
+    const std::vector<int> old_nonlocal_petsc_indices = nonlocal_petsc_indices;
+    nonlocal_lag_indices.clear();
+    nonlocal_petsc_indices.clear();
+    std::map<int, int> nonlocal_petsc_idx_to_local_idx;
+    for (int k = 0; k < num_ghost_nodes; ++k)
+    {
+        LNode* const node_idx = ghost_nodes[k];
+        const int petsc_idx = ghost_node_petsc_idxs[k];
+        node_idx->setGlobalPETScIndex(petsc_idx);
+        if (node_offset <= petsc_idx && petsc_idx < node_offset + num_local_nodes)
+        {
+            node_idx->setLocalPETScIndex(petsc_idx - node_offset);
+            continue;
+        }
+        auto idx_it = nonlocal_petsc_idx_to_local_idx.find(petsc_idx);
+        if (idx_it == nonlocal_petsc_idx_to_local_idx.end())
+        {
+            const int local_idx = num_local_nodes + static_cast<int>(nonlocal_lag_indices.size());
+            nonlocal_lag_indices.push_back(node_idx->getLagrangianIndex());
+            nonlocal_petsc_indices.push_back(petsc_idx);
+            nonlocal_petsc_idx_to_local_idx[petsc_idx] = local_idx;
+            node_idx->setLocalPETScIndex(local_idx);
+        }
+        else
+        {
+            node_idx->setLocalPETScIndex(idx_it->second);
+        }
+    }
+
+    IBTK_TIMER_STOP(t_update_nonlocal_node_distribution);
+    return nonlocal_petsc_indices != old_nonlocal_petsc_indices;
+} // updateNonlocalNodeDistribution
+
 void
 LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, const unsigned int num_local_nodes)
 {
@@ -3138,6 +3390,7 @@ LDataManager::getFromRestart()
     d_num_nodes.resize(d_finest_ln + 1);
     d_node_offset.resize(d_finest_ln + 1);
     d_local_lag_indices.resize(d_finest_ln + 1);
+    d_local_node_permutation.resize(d_finest_ln + 1);
     d_nonlocal_lag_indices.resize(d_finest_ln + 1);
     d_local_petsc_indices.resize(d_finest_ln + 1);
     d_nonlocal_petsc_indices.resize(d_finest_ln + 1);
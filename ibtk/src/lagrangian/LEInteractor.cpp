@@ -35,8 +35,10 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <limits>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Box.h"
@@ -58,6 +60,8 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LEInteractorKernels.h"
+#include "ibtk/LEStencilCache.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
 #include "ibtk/ibtk_utilities.h"
@@ -66,6 +70,10 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC                                                                        \
@@ -1324,14 +1332,221 @@ spread_data(const int stencil_sz,
     }
 #endif
 } // spread_data
+
+// Sort markers into spatial tiles that are at least one stencil width wide and
+// assign each tile one of 2^NDIM colors based on the parity of its tile
+// coordinates.  The stencils of markers that lie in distinct tiles of the same
+// color never overlap, so all tiles of a given color may be processed
+// concurrently.  Within each tile, markers retain their original relative
+// order.
+struct MarkerTiling
+{
+    std::vector<int> indices;
+    std::vector<double> shifts;
+    std::vector<int> tile_offsets;
+    std::array<std::vector<int>, (1 << NDIM)> color_tiles;
+};
+
+void
+build_marker_tiling(MarkerTiling& tiling,
+                    const int stencil_sz,
+                    const double* const X,
+                    const double* const x_lower,
+                    const double* const dx,
+                    const std::vector<int>& local_indices,
+                    const std::vector<double>& periodic_shifts)
+{
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    const double tile_width = static_cast<double>(stencil_sz + 1);
+    std::vector<std::array<int, NDIM> > tile_coords(num_local_indices);
+    std::array<int, NDIM> tile_lower, tile_upper;
+    tile_lower.fill(std::numeric_limits<int>::max());
+    tile_upper.fill(std::numeric_limits<int>::min());
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double X_o_dx = (X[d + s * NDIM] + periodic_shifts[d + l * NDIM] - x_lower[d]) / dx[d];
+            tile_coords[l][d] = static_cast<int>(std::floor(X_o_dx / tile_width));
+            tile_lower[d] = std::min(tile_lower[d], tile_coords[l][d]);
+            tile_upper[d] = std::max(tile_upper[d], tile_coords[l][d]);
+        }
+    }
+
+    // Linearize the tile coordinates and bucket the markers by tile.
+    int num_tiles = 1;
+    std::array<int, NDIM> tile_stride;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        tile_stride[d] = num_tiles;
+        num_tiles *= tile_upper[d] - tile_lower[d] + 1;
+    }
+    std::vector<int> tile_ids(num_local_indices);
+    tiling.tile_offsets.assign(num_tiles + 1, 0);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        int t = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) t += (tile_coords[l][d] - tile_lower[d]) * tile_stride[d];
+        tile_ids[l] = t;
+        ++tiling.tile_offsets[t + 1];
+    }
+    for (int t = 0; t < num_tiles; ++t) tiling.tile_offsets[t + 1] += tiling.tile_offsets[t];
+    std::vector<int> tile_fill(tiling.tile_offsets.begin(), tiling.tile_offsets.end() - 1);
+    tiling.indices.resize(num_local_indices);
+    tiling.shifts.resize(NDIM * num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int k = tile_fill[tile_ids[l]]++;
+        tiling.indices[k] = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d) tiling.shifts[d + k * NDIM] = periodic_shifts[d + l * NDIM];
+    }
+
+    // Color the non-empty tiles.
+    for (auto& tiles : tiling.color_tiles) tiles.clear();
+    for (int t = 0; t < num_tiles; ++t)
+    {
+        if (tiling.tile_offsets[t + 1] == tiling.tile_offsets[t]) continue;
+        int color = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int tile_coord = (t / tile_stride[d]) % (tile_upper[d] - tile_lower[d] + 1);
+            color |= (tile_coord & 1) << d;
+        }
+        tiling.color_tiles[color].push_back(t);
+    }
+    return;
+} // build_marker_tiling
+
+// Partition markers into contiguous ranges of Lagrangian indices so that every
+// entry that refers to a particular index (e.g., periodic images of the same
+// node) is assigned to the same chunk, in its original order.
+void
+partition_markers_by_index(std::vector<int>& chunk_indices,
+                           std::vector<double>& chunk_shifts,
+                           std::vector<int>& chunk_offsets,
+                           const int num_chunks,
+                           const std::vector<int>& local_indices,
+                           const std::vector<double>& periodic_shifts)
+{
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    const auto minmax = std::minmax_element(local_indices.begin(), local_indices.end());
+    const long long s_min = *minmax.first;
+    const long long s_range = static_cast<long long>(*minmax.second) - s_min + 1;
+    std::vector<int> chunk_ids(num_local_indices);
+    chunk_offsets.assign(num_chunks + 1, 0);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        chunk_ids[l] = static_cast<int>(((local_indices[l] - s_min) * num_chunks) / s_range);
+        ++chunk_offsets[chunk_ids[l] + 1];
+    }
+    for (int c = 0; c < num_chunks; ++c) chunk_offsets[c + 1] += chunk_offsets[c];
+    std::vector<int> chunk_fill(chunk_offsets.begin(), chunk_offsets.end() - 1);
+    chunk_indices.resize(num_local_indices);
+    chunk_shifts.resize(NDIM * num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int k = chunk_fill[chunk_ids[l]]++;
+        chunk_indices[k] = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d) chunk_shifts[d + k * NDIM] = periodic_shifts[d + l * NDIM];
+    }
+    return;
+} // partition_markers_by_index
+
+// Split the ghost box into slabs along the last coordinate direction and
+// collect, for each slab, the markers whose stencils may intersect it.  Within
+// each slab, markers retain their original relative order.
+void
+build_marker_slabs(std::vector<Box<NDIM> >& slab_boxes,
+                   std::vector<int>& slab_indices,
+                   std::vector<double>& slab_shifts,
+                   std::vector<int>& slab_offsets,
+                   const int num_slabs,
+                   const int stencil_sz,
+                   const Box<NDIM>& q_data_box,
+                   const IntVector<NDIM>& q_gcw,
+                   const double* const X,
+                   const double* const x_lower,
+                   const double* const dx,
+                   const std::vector<int>& local_indices,
+                   const std::vector<double>& periodic_shifts)
+{
+    static const int D = NDIM - 1;
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+    const int ig_lower = ghost_box.lower()(D);
+    const int num_cells = ghost_box.upper()(D) - ig_lower + 1;
+    const int slab_width = (num_cells + num_slabs - 1) / num_slabs;
+    slab_boxes.assign(num_slabs, ghost_box);
+    for (int k = 0; k < num_slabs; ++k)
+    {
+        slab_boxes[k].lower()(D) = ig_lower + k * slab_width;
+        slab_boxes[k].upper()(D) = std::min(ig_lower + (k + 1) * slab_width - 1, ghost_box.upper()(D));
+    }
+
+    // Determine the (conservatively widened) range of slabs touched by the
+    // stencil of each marker and bucket the markers by slab.
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    std::vector<std::pair<int, int> > slab_ranges(num_local_indices);
+    slab_offsets.assign(num_slabs + 1, 0);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        const double X_o_dx = (X[D + s * NDIM] + periodic_shifts[D + l * NDIM] - x_lower[D]) / dx[D];
+        const int ic = static_cast<int>(std::floor(X_o_dx)) + q_data_box.lower()(D) - ig_lower;
+        const int i_lower = ic - stencil_sz, i_upper = ic + stencil_sz;
+        if (i_upper < 0 || i_lower >= num_cells)
+        {
+            slab_ranges[l] = std::make_pair(0, -1);
+            continue;
+        }
+        slab_ranges[l] = std::make_pair(std::max(i_lower, 0) / slab_width,
+                                        std::min(i_upper, num_cells - 1) / slab_width);
+        for (int k = slab_ranges[l].first; k <= slab_ranges[l].second; ++k) ++slab_offsets[k + 1];
+    }
+    for (int k = 0; k < num_slabs; ++k) slab_offsets[k + 1] += slab_offsets[k];
+    std::vector<int> slab_fill(slab_offsets.begin(), slab_offsets.end() - 1);
+    slab_indices.resize(slab_offsets[num_slabs]);
+    slab_shifts.resize(NDIM * slab_offsets[num_slabs]);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        for (int k = slab_ranges[l].first; k <= slab_ranges[l].second; ++k)
+        {
+            const int j = slab_fill[k]++;
+            slab_indices[j] = local_indices[l];
+            for (unsigned int d = 0; d < NDIM; ++d) slab_shifts[d + j * NDIM] = periodic_shifts[d + l * NDIM];
+        }
+    }
+    return;
+} // build_marker_slabs
 }
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+bool LEInteractor::s_use_threaded_interaction = false;
+bool LEInteractor::s_use_fixed_order_spreading = false;
+bool LEInteractor::s_use_stencil_cache = false;
+bool LEInteractor::s_use_vectorized_kernels = false;
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("use_threaded_interaction"))
+    {
+        s_use_threaded_interaction = db->getBool("use_threaded_interaction");
+    }
+    if (db->keyExists("use_fixed_order_spreading"))
+    {
+        s_use_fixed_order_spreading = db->getBool("use_fixed_order_spreading");
+    }
+    if (db->keyExists("use_stencil_cache"))
+    {
+        s_use_stencil_cache = db->getBool("use_stencil_cache");
+    }
+    if (db->keyExists("use_vectorized_kernels"))
+    {
+        s_use_vectorized_kernels = db->getBool("use_vectorized_kernels");
+    }
     return;
 }
 
@@ -1339,6 +1554,13 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  s_use_threaded_interaction  = " << s_use_threaded_interaction << "\n";
+    os << "  s_use_fixed_order_spreading = " << s_use_fixed_order_spreading << "\n";
+    os << "  s_use_stencil_cache         = " << s_use_stencil_cache << "\n";
+    os << "  s_use_vectorized_kernels    = " << s_use_vectorized_kernels << "\n";
+#ifdef _OPENMP
+    os << "  omp_get_max_threads()       = " << omp_get_max_threads() << "\n";
+#endif
     return;
 }
 
@@ -1567,6 +1789,8 @@ LEInteractor::interpolate(double* const Q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* const stencil_cache = getStencilCache(idx_data, patch, interp_box, interp_fcn, interior_only);
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1585,7 +1809,10 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    interp_fcn,
+                    /*axis*/ 0,
+                    stencil_cache,
+                    interior_only);
     }
     return;
 }
@@ -1631,6 +1858,8 @@ LEInteractor::interpolate(double* const Q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* const stencil_cache = getStencilCache(idx_data, patch, interp_box, interp_fcn, interior_only);
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1655,7 +1884,10 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    interp_fcn,
+                    /*axis*/ 0,
+                    stencil_cache,
+                    interior_only);
     }
     return;
 }
@@ -1708,6 +1940,8 @@ LEInteractor::interpolate(double* const Q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* const stencil_cache = getStencilCache(idx_data, patch, interp_box, interp_fcn, interior_only);
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1739,7 +1973,9 @@ LEInteractor::interpolate(double* const Q_data,
                         local_indices,
                         periodic_shifts,
                         interp_fcn,
-                        axis);
+                        axis,
+                        stencil_cache,
+                        interior_only);
             for (const auto& local_index : local_indices)
             {
                 Q_data[NDIM * local_index + axis] = Q_data_axis[local_index];
@@ -1797,6 +2033,8 @@ LEInteractor::interpolate(double* const Q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* const stencil_cache = getStencilCache(idx_data, patch, interp_box, interp_fcn, interior_only);
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1831,7 +2069,9 @@ LEInteractor::interpolate(double* const Q_data,
                         local_indices,
                         periodic_shifts,
                         interp_fcn,
-                        axis);
+                        axis,
+                        stencil_cache,
+                        interior_only);
             for (const auto& local_index : local_indices)
             {
                 Q_data[NDIM * local_index + axis] = Q_data_axis[local_index];
@@ -2763,6 +3003,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* stencil_cache = getStencilCache(idx_data, patch, spread_box, spread_fcn, interior_only);
+    if (interior_only) stencil_cache = nullptr; // cached stencils are spread from all markers in the ghost box
 
     // Spread.
     if (!local_indices.empty())
@@ -2781,7 +3024,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               stencil_cache);
     }
     return;
 }
@@ -2827,6 +3072,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* stencil_cache = getStencilCache(idx_data, patch, spread_box, spread_fcn, interior_only);
+    if (interior_only) stencil_cache = nullptr; // cached stencils are spread from all markers in the ghost box
 
     // Spread.
     if (!local_indices.empty())
@@ -2851,7 +3099,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               stencil_cache);
     }
     return;
 }
@@ -2904,6 +3154,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* stencil_cache = getStencilCache(idx_data, patch, spread_box, spread_fcn, interior_only);
+    if (interior_only) stencil_cache = nullptr; // cached stencils are spread from all markers in the ghost box
 
     // Spread.
     if (!local_indices.empty())
@@ -2939,7 +3192,8 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   stencil_cache);
         }
     }
     return;
@@ -2993,6 +3247,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    bool interior_only = false;
+    LEStencilCache* stencil_cache = getStencilCache(idx_data, patch, spread_box, spread_fcn, interior_only);
+    if (interior_only) stencil_cache = nullptr; // cached stencils are spread from all markers in the ghost box
 
     // Spread.
     if (!local_indices.empty())
@@ -3031,7 +3288,8 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   stencil_cache);
         }
     }
     return;
@@ -3775,7 +4033,9 @@ LEInteractor::interpolate(double* const Q_data,
                           const std::vector<int>& local_indices,
                           const std::vector<double>& periodic_shifts,
                           const std::string& interp_fcn,
-                          const int axis)
+                          const int axis,
+                          LEStencilCache* const stencil_cache,
+                          const bool interior_only)
 {
     const int stencil_size = getStencilSize(interp_fcn);
     const int min_ghosts = getMinimumGhostWidth(interp_fcn);
@@ -3797,7 +4057,102 @@ LEInteractor::interpolate(double* const Q_data,
                    << "\n");
     }
     if (local_indices.empty()) return;
+    if (stencil_cache)
+    {
+        stencil_cache->interpolate(
+            Q_data, Q_depth, X_data, q_data, q_data_box, q_gcw, q_depth, x_lower, dx, interp_fcn, interior_only);
+        return;
+    }
     const int local_indices_size = static_cast<int>(local_indices.size());
+#ifdef _OPENMP
+    const int num_threads = omp_get_max_threads();
+    if (s_use_threaded_interaction && num_threads > 1 && interp_fcn != "USER_DEFINED")
+    {
+        // Each interpolated value depends only on its own marker, so we only
+        // need to ensure that repeated indices are handled by the same thread.
+        std::vector<int> chunk_indices, chunk_offsets;
+        std::vector<double> chunk_shifts;
+        partition_markers_by_index(
+            chunk_indices, chunk_shifts, chunk_offsets, num_threads, local_indices, periodic_shifts);
+#pragma omp parallel for schedule(static)
+        for (int c = 0; c < num_threads; ++c)
+        {
+            const int offset = chunk_offsets[c];
+            const int num_chunk_indices = chunk_offsets[c + 1] - offset;
+            if (num_chunk_indices == 0) continue;
+            std::array<double, NDIM> x_upper_copy;
+            std::copy(x_upper, x_upper + NDIM, x_upper_copy.begin());
+            interpolateKernel(Q_data,
+                              Q_depth,
+                              X_data,
+                              q_data,
+                              q_data_box,
+                              q_gcw,
+                              q_depth,
+                              x_lower,
+                              x_upper_copy.data(),
+                              dx,
+                              &chunk_indices[offset],
+                              &chunk_shifts[NDIM * offset],
+                              num_chunk_indices,
+                              interp_fcn,
+                              axis);
+        }
+        return;
+    }
+#endif
+    interpolateKernel(Q_data,
+                      Q_depth,
+                      X_data,
+                      q_data,
+                      q_data_box,
+                      q_gcw,
+                      q_depth,
+                      x_lower,
+                      x_upper,
+                      dx,
+                      &local_indices[0],
+                      &periodic_shifts[0],
+                      local_indices_size,
+                      interp_fcn,
+                      axis);
+    return;
+}
+
+void
+LEInteractor::interpolateKernel(double* const Q_data,
+                                const int Q_depth,
+                                const double* const X_data,
+                                const double* const q_data,
+                                const Box<NDIM>& q_data_box,
+                                const IntVector<NDIM>& q_gcw,
+                                const int q_depth,
+                                const double* const x_lower,
+                                const double* const x_upper,
+                                const double* const dx,
+                                const int* const local_indices,
+                                const double* const periodic_shifts,
+                                const int num_local_indices,
+                                const std::string& interp_fcn,
+                                const int axis)
+{
+    if (s_use_vectorized_kernels && LEInteractorKernels::isKernelSupported(interp_fcn))
+    {
+        LEInteractorKernels::interpolate(Q_data,
+                                         Q_depth,
+                                         X_data,
+                                         q_data,
+                                         q_data_box,
+                                         q_gcw,
+                                         q_depth,
+                                         x_lower,
+                                         dx,
+                                         local_indices,
+                                         periodic_shifts,
+                                         num_local_indices,
+                                         interp_fcn);
+        return;
+    }
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (interp_fcn == "PIECEWISE_CONSTANT")
@@ -3826,9 +4181,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                 q_gcw(2),
 #endif
                                                 q_data,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data);
     }
@@ -3859,9 +4214,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data);
     }
@@ -3891,9 +4246,9 @@ LEInteractor::interpolate(double* const Q_data,
                                               q_gcw(2),
 #endif
                                               q_data,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data);
     }
@@ -3923,9 +4278,9 @@ LEInteractor::interpolate(double* const Q_data,
                                              q_gcw(2),
 #endif
                                              q_data,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data);
     }
@@ -3955,9 +4310,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
@@ -3987,9 +4342,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
@@ -4019,9 +4374,9 @@ LEInteractor::interpolate(double* const Q_data,
                                      q_gcw(2),
 #endif
                                      q_data,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data);
     }
@@ -4051,9 +4406,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
@@ -4083,9 +4438,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
@@ -4115,9 +4470,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
@@ -4147,9 +4502,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
@@ -4179,9 +4534,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
@@ -4211,9 +4566,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
@@ -4229,9 +4584,9 @@ LEInteractor::interpolate(double* const Q_data,
                                x_lower,
                                x_upper,
                                dx,
-                               &local_indices[0],
-                               &periodic_shifts[0],
-                               local_indices_size);
+                               local_indices,
+                               periodic_shifts,
+                               num_local_indices);
     }
     else
     {
@@ -4259,7 +4614,8 @@ LEInteractor::spread(double* const q_data,
                      const std::vector<int>& local_indices,
                      const std::vector<double>& periodic_shifts,
                      const std::string& spread_fcn,
-                     const int axis)
+                     const int axis,
+                     LEStencilCache* const stencil_cache)
 {
     const int stencil_size = getStencilSize(spread_fcn);
     const int min_ghosts = getMinimumGhostWidth(spread_fcn);
@@ -4287,7 +4643,216 @@ LEInteractor::spread(double* const q_data,
                    << "\n");
     }
     if (local_indices.empty()) return;
-    const int local_indices_size = static_cast<int>(local_indices.size());
+    if (stencil_cache)
+    {
+        stencil_cache->spread(q_data, q_data_box, q_gcw, q_depth, Q_data, Q_depth, X_data, x_lower, dx, spread_fcn);
+        return;
+    }
+#ifdef _OPENMP
+    const int num_threads = omp_get_max_threads();
+#else
+    const int num_threads = 1;
+#endif
+    const bool use_cxx_kernels = s_use_vectorized_kernels && LEInteractorKernels::isKernelSupported(spread_fcn);
+    if (s_use_threaded_interaction && s_use_fixed_order_spreading &&
+        (use_cxx_kernels || (spread_fcn != "PIECEWISE_CONSTANT" && spread_fcn != "USER_DEFINED")))
+    {
+        // Spread slab-by-slab.  Each thread updates only the values in its own
+        // slab, in the original marker order, so the results are identical to
+        // those of the serial kernel, regardless of the number of threads.
+        std::vector<Box<NDIM> > slab_boxes;
+        std::vector<int> slab_indices, slab_offsets;
+        std::vector<double> slab_shifts;
+        build_marker_slabs(slab_boxes,
+                           slab_indices,
+                           slab_shifts,
+                           slab_offsets,
+                           num_threads,
+                           stencil_size,
+                           q_data_box,
+                           q_gcw,
+                           X_data,
+                           x_lower,
+                           dx,
+                           local_indices,
+                           periodic_shifts);
+        const int num_slabs = static_cast<int>(slab_boxes.size());
+        if (use_cxx_kernels)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+            for (int k = 0; k < num_slabs; ++k)
+            {
+                const int offset = slab_offsets[k];
+                const int num_slab_indices = slab_offsets[k + 1] - offset;
+                if (num_slab_indices == 0) continue;
+                LEInteractorKernels::spread(q_data,
+                                            q_data_box,
+                                            q_gcw,
+                                            q_depth,
+                                            Q_data,
+                                            Q_depth,
+                                            X_data,
+                                            x_lower,
+                                            dx,
+                                            &slab_indices[offset],
+                                            &slab_shifts[NDIM * offset],
+                                            num_slab_indices,
+                                            spread_fcn,
+                                            slab_boxes[k]);
+            }
+            return;
+        }
+
+        // The Fortran kernels clip their stencils to the ghost box implied by
+        // (ilower, iupper, q_gcw), and the interpolation weights depend only
+        // on x_lower and ilower.  We therefore present each slab to the kernel
+        // as a patch with the same lower index but with ghost cell widths
+        // chosen so that the ghost box coincides with the slab.  Because the
+        // kernels interleave the data components, the values are spread one
+        // component at a time.
+        static const int D = NDIM - 1;
+        const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+        const int ghost_box_size = ghost_box.size();
+        int slab_stride = 1;
+        for (unsigned int d = 0; d < D; ++d) slab_stride *= ghost_box.numberCells(d);
+        const int num_markers = *std::max_element(local_indices.begin(), local_indices.end()) + 1;
+        std::vector<double> Q_comp(q_depth > 1 ? num_markers : 0);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            if (q_depth > 1)
+            {
+                for (int s = 0; s < num_markers; ++s) Q_comp[s] = Q_data[d + s * Q_depth];
+            }
+            const double* const Q_comp_data = q_depth > 1 ? Q_comp.data() : Q_data;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+            for (int k = 0; k < num_slabs; ++k)
+            {
+                const int offset = slab_offsets[k];
+                const int num_slab_indices = slab_offsets[k + 1] - offset;
+                if (num_slab_indices == 0) continue;
+                const Box<NDIM>& slab_box = slab_boxes[k];
+                IntVector<NDIM> slab_gcw = q_gcw;
+                slab_gcw(D) = q_data_box.lower()(D) - slab_box.lower()(D);
+                Box<NDIM> slab_data_box = q_data_box;
+                slab_data_box.upper()(D) = slab_box.upper()(D) - slab_gcw(D);
+                double* const slab_q_data =
+                    q_data + d * ghost_box_size + (slab_box.lower()(D) - ghost_box.lower()(D)) * slab_stride;
+                std::array<double, NDIM> x_upper_copy;
+                std::copy(x_upper, x_upper + NDIM, x_upper_copy.begin());
+                spreadKernel(slab_q_data,
+                             slab_data_box,
+                             slab_gcw,
+                             1,
+                             Q_comp_data,
+                             1,
+                             X_data,
+                             x_lower,
+                             x_upper_copy.data(),
+                             dx,
+                             &slab_indices[offset],
+                             &slab_shifts[NDIM * offset],
+                             num_slab_indices,
+                             spread_fcn,
+                             axis);
+            }
+        }
+        return;
+    }
+    if (s_use_threaded_interaction && !s_use_fixed_order_spreading && spread_fcn != "USER_DEFINED")
+    {
+        // Spread tile-by-tile, one color at a time.  The order in which values
+        // are accumulated into each grid cell depends only on the tiling and
+        // not on the number of threads, so the results are reproducible
+        // regardless of the thread count.
+        MarkerTiling tiling;
+        build_marker_tiling(tiling, stencil_size, X_data, x_lower, dx, local_indices, periodic_shifts);
+        for (const auto& tiles : tiling.color_tiles)
+        {
+            const int num_tiles = static_cast<int>(tiles.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int k = 0; k < num_tiles; ++k)
+            {
+                const int t = tiles[k];
+                const int offset = tiling.tile_offsets[t];
+                std::array<double, NDIM> x_upper_copy;
+                std::copy(x_upper, x_upper + NDIM, x_upper_copy.begin());
+                spreadKernel(q_data,
+                             q_data_box,
+                             q_gcw,
+                             q_depth,
+                             Q_data,
+                             Q_depth,
+                             X_data,
+                             x_lower,
+                             x_upper_copy.data(),
+                             dx,
+                             &tiling.indices[offset],
+                             &tiling.shifts[NDIM * offset],
+                             tiling.tile_offsets[t + 1] - offset,
+                             spread_fcn,
+                             axis);
+            }
+        }
+        return;
+    }
+    spreadKernel(q_data,
+                 q_data_box,
+                 q_gcw,
+                 q_depth,
+                 Q_data,
+                 Q_depth,
+                 X_data,
+                 x_lower,
+                 x_upper,
+                 dx,
+                 &local_indices[0],
+                 &periodic_shifts[0],
+                 static_cast<int>(local_indices.size()),
+                 spread_fcn,
+                 axis);
+    return;
+}
+
+void
+LEInteractor::spreadKernel(double* const q_data,
+                           const Box<NDIM>& q_data_box,
+                           const IntVector<NDIM>& q_gcw,
+                           const int q_depth,
+                           const double* const Q_data,
+                           const int Q_depth,
+                           const double* const X_data,
+                           const double* const x_lower,
+                           const double* const x_upper,
+                           const double* const dx,
+                           const int* const local_indices,
+                           const double* const periodic_shifts,
+                           const int num_local_indices,
+                           const std::string& spread_fcn,
+                           const int axis)
+{
+    if (s_use_vectorized_kernels && LEInteractorKernels::isKernelSupported(spread_fcn))
+    {
+        LEInteractorKernels::spread(q_data,
+                                    q_data_box,
+                                    q_gcw,
+                                    q_depth,
+                                    Q_data,
+                                    Q_depth,
+                                    X_data,
+                                    x_lower,
+                                    dx,
+                                    local_indices,
+                                    periodic_shifts,
+                                    num_local_indices,
+                                    spread_fcn);
+        return;
+    }
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (spread_fcn == "PIECEWISE_CONSTANT")
@@ -4296,9 +4861,9 @@ LEInteractor::spread(double* const q_data,
                                                 x_lower,
                                                 x_upper,
                                                 q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data,
 #if (NDIM == 2)
@@ -4329,9 +4894,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -4361,9 +4926,9 @@ LEInteractor::spread(double* const q_data,
                                               x_lower,
                                               x_upper,
                                               q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data,
 #if (NDIM == 2)
@@ -4393,9 +4958,9 @@ LEInteractor::spread(double* const q_data,
                                              x_lower,
                                              x_upper,
                                              q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data,
 #if (NDIM == 2)
@@ -4425,9 +4990,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4457,9 +5022,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4489,9 +5054,9 @@ LEInteractor::spread(double* const q_data,
                                      x_lower,
                                      x_upper,
                                      q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data,
 #if (NDIM == 2)
@@ -4521,9 +5086,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4553,9 +5118,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4585,9 +5150,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4617,9 +5182,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4649,9 +5214,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4681,9 +5246,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4719,9 +5284,9 @@ LEInteractor::spread(double* const q_data,
                           Q_data,
                           Q_depth,
                           X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
-                          local_indices_size);
+                          local_indices,
+                          periodic_shifts,
+                          num_local_indices);
     }
     else
     {
@@ -4733,36 +5298,45 @@ LEInteractor::spread(double* const q_data,
     return;
 }
 
+template <class T>
+LEStencilCache*
+LEInteractor::getStencilCache(const Pointer<LIndexSetData<T> > idx_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& box,
+                              const std::string& kernel_fcn,
+                              bool& interior_only)
+{
+    interior_only = false;
+    if (!s_use_stencil_cache || !LEStencilCache::isKernelSupported(kernel_fcn)) return nullptr;
+    LEStencilCache* const stencil_cache = &idx_data->getStencilCache();
+    if (box == patch->getBox())
+    {
+        interior_only = true;
+        return stencil_cache;
+    }
+    else if (box == idx_data->getGhostBox())
+    {
+        return stencil_cache;
+    }
+    return nullptr;
+} // getStencilCache
+
 template <class T>
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
                                 std::vector<double>& periodic_shifts,
                                 const Box<NDIM>& box,
                                 const Pointer<Patch<NDIM> > patch,
-                                const IntVector<NDIM>& periodic_shift,
+                                const IntVector<NDIM>& /*periodic_shift*/,
                                 const Pointer<LIndexSetData<T> > idx_data)
 {
     local_indices.clear();
     periodic_shifts.clear();
     const size_t upper_bound = idx_data->getLocalPETScIndices().size();
     if (upper_bound == 0) return;
-    local_indices.reserve(upper_bound);
-    periodic_shifts.reserve(NDIM * upper_bound);
 
     const Box<NDIM>& patch_box = patch->getBox();
-    const Index<NDIM>& ilower = patch_box.lower();
-    const Index<NDIM>& iupper = patch_box.upper();
     const Box<NDIM>& ghost_box = idx_data->getGhostBox();
-
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const dx = pgeom->getDx();
-    std::array<bool, NDIM> patch_touches_lower_periodic_bdry, patch_touches_upper_periodic_bdry;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        patch_touches_lower_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 0);
-        patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
-    }
-
     if (box == patch_box)
     {
         local_indices = idx_data->getInteriorLocalPETScIndices();
@@ -4775,38 +5349,23 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
     }
     else
     {
-        for (typename LIndexSetData<T>::SetIterator it(*idx_data); it; it++)
+        // Use the compressed sparse row layout of the cached indices, which
+        // also stores the periodic shift of each cell, so that the indices in
+        // the box are found without traversing the index sets.
+        local_indices.reserve(upper_bound);
+        periodic_shifts.reserve(NDIM * upper_bound);
+        const std::vector<Index<NDIM> >& cell_idxs = idx_data->getOccupiedCellIndices();
+        const std::vector<int>& cell_offsets = idx_data->getCellOffsets();
+        const std::vector<int>& cell_local_petsc_idxs = idx_data->getCellLocalPETScIndices();
+        const std::vector<double>& cell_periodic_shifts = idx_data->getCellPeriodicShifts();
+        for (unsigned int k = 0; k < cell_idxs.size(); ++k)
         {
-            const Index<NDIM>& i = it.getIndex();
-            if (!box.contains(i)) continue;
-
-            std::array<int, NDIM> offset;
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                if (patch_touches_lower_periodic_bdry[d] && i(d) < ilower(d))
-                {
-                    offset[d] = -periodic_shift(d); // X is ABOVE the top    of the patch --- need
-                                                    // to shift DOWN
-                }
-                else if (patch_touches_upper_periodic_bdry[d] && i(d) > iupper(d))
-                {
-                    offset[d] = +periodic_shift(d); // X is BELOW the bottom of the patch ---
-                                                    // need to shift UP
-                }
-                else
-                {
-                    offset[d] = 0;
-                }
-            }
-            const LSet<T>& idx_set = it.getItem();
-            for (auto n = idx_set.begin(); n != idx_set.end(); ++n)
+            if (!box.contains(cell_idxs[k])) continue;
+            const double* const cell_periodic_shift = &cell_periodic_shifts[NDIM * k];
+            for (int n = cell_offsets[k]; n < cell_offsets[k + 1]; ++n)
             {
-                const typename LSet<T>::value_type& idx = *n;
-                local_indices.push_back(idx->getLocalPETScIndex());
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
-                }
+                local_indices.push_back(cell_local_petsc_idxs[n]);
+                periodic_shifts.insert(periodic_shifts.end(), cell_periodic_shift, cell_periodic_shift + NDIM);
             }
         }
     }
@@ -5259,6 +5818,13 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Edg
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template IBTK::LEStencilCache*
+IBTK::LEInteractor::getStencilCache(const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                    const SAMRAI::hier::Box<NDIM>& box,
+                                    const std::string& kernel_fcn,
+                                    bool& interior_only);
+
 template void IBTK::LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
                                                     std::vector<double>& periodic_shifts,
                                                     const SAMRAI::hier::Box<NDIM>& box,
@@ -0,0 +1,773 @@
+// Filename: LEInteractorKernels.cpp
+// Created on 16 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <string>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "ibtk/LEInteractorKernels.h"
+#include "ibtk/LEKernelFunctions.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The number of markers for which the kernel weights are evaluated at once.
+static const int BATCH_SIZE = 64;
+
+// The one-dimensional kernel weights and the (unclipped) lower corners of the
+// stencils for a batch of markers.  The weight associated with stencil index j
+// of marker k along direction d is stored in w[d][j * BATCH_SIZE + k], so that
+// the weights of consecutive markers are contiguous in memory.
+template <class Kernel>
+struct MarkerBatch
+{
+    double w[NDIM][Kernel::stencil_size * BATCH_SIZE];
+    int ic_lower[NDIM][BATCH_SIZE];
+};
+
+// The extents of the ghost box of the patch data and the corresponding array
+// strides, along with the extents of the region in which the data are accessed
+// (by default, the entire ghost box).
+struct GhostBoxLayout
+{
+    int ig_lower[NDIM], ig_upper[NDIM], stride[NDIM];
+    int iu_lower[NDIM], iu_upper[NDIM];
+    int num_cells;
+};
+
+inline void
+init_ghost_box_layout(GhostBoxLayout& layout,
+                      const Box<NDIM>& q_data_box,
+                      const IntVector<NDIM>& q_gcw,
+                      const Box<NDIM>* const update_box = nullptr)
+{
+    layout.num_cells = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        layout.ig_lower[d] = q_data_box.lower()(d) - q_gcw(d);
+        layout.ig_upper[d] = q_data_box.upper()(d) + q_gcw(d);
+        layout.iu_lower[d] = update_box ? std::max(layout.ig_lower[d], update_box->lower()(d)) : layout.ig_lower[d];
+        layout.iu_upper[d] = update_box ? std::min(layout.ig_upper[d], update_box->upper()(d)) : layout.ig_upper[d];
+        layout.stride[d] = layout.num_cells;
+        layout.num_cells *= layout.ig_upper[d] - layout.ig_lower[d] + 1;
+    }
+    return;
+} // init_ghost_box_layout
+
+// Evaluate the kernel weights for a batch of markers.
+template <class Kernel>
+inline void
+compute_batch_weights(MarkerBatch<Kernel>& batch,
+                      const double* const X_data,
+                      const int* const local_indices,
+                      const double* const periodic_shifts,
+                      const int num_markers,
+                      const double* const x_lower,
+                      const double* const dx,
+                      const IntVector<NDIM>& ilower)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        double* const w = batch.w[d];
+        int* const ic_lower = batch.ic_lower[d];
+        const double x_lower_d = x_lower[d];
+        const double dx_d = dx[d];
+        const int ilower_d = ilower(d);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for (int k = 0; k < num_markers; ++k)
+        {
+            const double X_o_dx =
+                (X_data[d + local_indices[k] * NDIM] + periodic_shifts[d + k * NDIM] - x_lower_d) / dx_d;
+            ic_lower[k] = Kernel::computeWeights(X_o_dx, &w[k], BATCH_SIZE) + ilower_d;
+        }
+    }
+    return;
+} // compute_batch_weights
+
+// Extract the weights of a single marker from a batch, determine the portion
+// of its stencil that lies within the region of the ghost box in which data are
+// accessed, and compute the offset of the lower corner of the stencil into the
+// data array.  Returns true if the stencil lies entirely within that region.
+// If the stencil does not intersect the region, istart[d] > istop[d] for some
+// d.
+template <class Kernel>
+inline bool
+get_marker_stencil(const MarkerBatch<Kernel>& batch,
+                   const int k,
+                   const GhostBoxLayout& layout,
+                   double (&w)[NDIM][Kernel::stencil_size],
+                   int* const istart,
+                   int* const istop,
+                   int& offset)
+{
+    static const int W = Kernel::stencil_size;
+    bool full = true;
+    offset = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        for (int j = 0; j < W; ++j)
+        {
+            w[d][j] = batch.w[d][j * BATCH_SIZE + k];
+        }
+        const int ic_lower = batch.ic_lower[d][k];
+        istart[d] = std::max(layout.iu_lower[d] - ic_lower, 0);
+        istop[d] = (W - 1) - std::max(ic_lower + W - 1 - layout.iu_upper[d], 0);
+        full = full && istart[d] == 0 && istop[d] == W - 1;
+        offset += (ic_lower - layout.ig_lower[d]) * layout.stride[d];
+    }
+    return full;
+} // get_marker_stencil
+
+// The number of entries in the tensor product of the one-dimensional weights
+// of a stencil of width W.
+template <int W>
+struct TensorSize
+{
+    static const int value = NDIM == 2 ? W * W : W * W * W;
+};
+
+// Compute the tensor product of the one-dimensional weights of a single
+// marker, divided by the factor fac, in the same order of operations as the
+// Fortran kernels.  The weight associated with stencil index (i0,i1,i2) is
+// stored in wt[i0 + W * (i1 + W * i2)].
+template <int W>
+inline void
+compute_tensor_weights(double* const wt, const double (&w)[NDIM][W], const double fac)
+{
+#if (NDIM == 2)
+    for (int i1 = 0; i1 < W; ++i1)
+    {
+        const double wy = w[1][i1] / fac;
+        for (int i0 = 0; i0 < W; ++i0)
+        {
+            wt[i0 + W * i1] = w[0][i0] * wy;
+        }
+    }
+#endif
+#if (NDIM == 3)
+    for (int i2 = 0; i2 < W; ++i2)
+    {
+        const double wz = w[2][i2] / fac;
+        for (int i1 = 0; i1 < W; ++i1)
+        {
+            const double wyz = w[1][i1] * wz;
+            for (int i0 = 0; i0 < W; ++i0)
+            {
+                wt[i0 + W * (i1 + W * i2)] = w[0][i0] * wyz;
+            }
+        }
+    }
+#endif
+    return;
+} // compute_tensor_weights
+
+// Interpolate all DEPTH components of the data to a single marker.  The
+// innermost loop runs over the contiguous cell index along the first
+// coordinate direction.  When FULL is true, the stencil lies entirely within
+// the ghost box and the stencil loops have fixed trip counts.
+template <int W, int DEPTH, bool FULL>
+inline void
+interpolate_marker(double* const V,
+                   const double* const u,
+                   const GhostBoxLayout& layout,
+                   const double* const wt,
+                   const int* const istart,
+                   const int* const istop)
+{
+    const int num_cells = layout.num_cells;
+    const int i0_start = FULL ? 0 : istart[0], i0_stop = FULL ? W - 1 : istop[0];
+    const int i1_start = FULL ? 0 : istart[1], i1_stop = FULL ? W - 1 : istop[1];
+#if (NDIM == 3)
+    const int i2_start = FULL ? 0 : istart[2], i2_stop = FULL ? W - 1 : istop[2];
+#endif
+    for (int d = 0; d < DEPTH; ++d)
+    {
+        const double* const u_d = u + d * num_cells;
+        double V_d = 0.0;
+#if (NDIM == 3)
+        for (int i2 = i2_start; i2 <= i2_stop; ++i2)
+        {
+#endif
+            for (int i1 = i1_start; i1 <= i1_stop; ++i1)
+            {
+#if (NDIM == 2)
+                const double* const u_i = u_d + i1 * layout.stride[1];
+                const double* const wt_i = wt + W * i1;
+#endif
+#if (NDIM == 3)
+                const double* const u_i = u_d + i1 * layout.stride[1] + i2 * layout.stride[2];
+                const double* const wt_i = wt + W * (i1 + W * i2);
+#endif
+                for (int i0 = i0_start; i0 <= i0_stop; ++i0)
+                {
+                    V_d += wt_i[i0] * u_i[i0];
+                }
+            }
+#if (NDIM == 3)
+        }
+#endif
+        V[d] = V_d;
+    }
+    return;
+} // interpolate_marker
+
+// Spread all DEPTH components of the values associated with a single marker.
+// The innermost loop runs over the contiguous cell index along the first
+// coordinate direction and carries no dependencies between iterations.  When
+// FULL is true, the stencil lies entirely within the ghost box and the stencil
+// loops have fixed trip counts.
+template <int W, int DEPTH, bool FULL>
+inline void
+spread_marker(double* const u,
+              const double* const V,
+              const GhostBoxLayout& layout,
+              const double* const wt,
+              const int* const istart,
+              const int* const istop)
+{
+    const int num_cells = layout.num_cells;
+    const int i0_start = FULL ? 0 : istart[0], i0_stop = FULL ? W - 1 : istop[0];
+    const int i1_start = FULL ? 0 : istart[1], i1_stop = FULL ? W - 1 : istop[1];
+#if (NDIM == 3)
+    const int i2_start = FULL ? 0 : istart[2], i2_stop = FULL ? W - 1 : istop[2];
+#endif
+    for (int d = 0; d < DEPTH; ++d)
+    {
+        double* const u_d = u + d * num_cells;
+        const double V_d = V[d];
+#if (NDIM == 3)
+        for (int i2 = i2_start; i2 <= i2_stop; ++i2)
+        {
+#endif
+            for (int i1 = i1_start; i1 <= i1_stop; ++i1)
+            {
+#if (NDIM == 2)
+                double* const u_i = u_d + i1 * layout.stride[1];
+                const double* const wt_i = wt + W * i1;
+#endif
+#if (NDIM == 3)
+                double* const u_i = u_d + i1 * layout.stride[1] + i2 * layout.stride[2];
+                const double* const wt_i = wt + W * (i1 + W * i2);
+#endif
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for (int i0 = i0_start; i0 <= i0_stop; ++i0)
+                {
+                    u_i[i0] += wt_i[i0] * V_d;
+                }
+            }
+#if (NDIM == 3)
+        }
+#endif
+    }
+    return;
+} // spread_marker
+
+template <class Kernel, int DEPTH>
+void
+interpolate_markers(double* const Q_data,
+                    const int Q_depth,
+                    const double* const X_data,
+                    const double* const q_data,
+                    const GhostBoxLayout& layout,
+                    const IntVector<NDIM>& ilower,
+                    const double* const x_lower,
+                    const double* const dx,
+                    const int* const local_indices,
+                    const double* const periodic_shifts,
+                    const int num_local_indices)
+{
+    static const int W = Kernel::stencil_size;
+    MarkerBatch<Kernel> batch;
+    double w[NDIM][W];
+    double wt[TensorSize<W>::value];
+    int istart[NDIM], istop[NDIM], offset;
+    for (int k_batch = 0; k_batch < num_local_indices; k_batch += BATCH_SIZE)
+    {
+        const int num_markers = std::min(BATCH_SIZE, num_local_indices - k_batch);
+        compute_batch_weights(batch,
+                              X_data,
+                              &local_indices[k_batch],
+                              &periodic_shifts[NDIM * k_batch],
+                              num_markers,
+                              x_lower,
+                              dx,
+                              ilower);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            double V[DEPTH];
+            const bool full = get_marker_stencil(batch, k, layout, w, istart, istop, offset);
+            compute_tensor_weights(wt, w, 1.0);
+            if (full)
+            {
+                interpolate_marker<W, DEPTH, true>(V, q_data + offset, layout, wt, istart, istop);
+            }
+            else
+            {
+                interpolate_marker<W, DEPTH, false>(V, q_data + offset, layout, wt, istart, istop);
+            }
+            const int s = local_indices[k_batch + k];
+            for (int d = 0; d < DEPTH; ++d)
+            {
+                Q_data[d + s * Q_depth] = V[d];
+            }
+        }
+    }
+    return;
+} // interpolate_markers
+
+template <class Kernel, int DEPTH>
+void
+spread_markers(double* const q_data,
+               const GhostBoxLayout& layout,
+               const IntVector<NDIM>& ilower,
+               const double* const Q_data,
+               const int Q_depth,
+               const double* const X_data,
+               const double* const x_lower,
+               const double* const dx,
+               const int* const local_indices,
+               const double* const periodic_shifts,
+               const int num_local_indices)
+{
+    static const int W = Kernel::stencil_size;
+    double cell_volume = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) cell_volume *= dx[d];
+    MarkerBatch<Kernel> batch;
+    double w[NDIM][W];
+    double wt[TensorSize<W>::value];
+    int istart[NDIM], istop[NDIM], offset;
+    for (int k_batch = 0; k_batch < num_local_indices; k_batch += BATCH_SIZE)
+    {
+        const int num_markers = std::min(BATCH_SIZE, num_local_indices - k_batch);
+        compute_batch_weights(batch,
+                              X_data,
+                              &local_indices[k_batch],
+                              &periodic_shifts[NDIM * k_batch],
+                              num_markers,
+                              x_lower,
+                              dx,
+                              ilower);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            const double* const V = &Q_data[local_indices[k_batch + k] * Q_depth];
+            const bool full = get_marker_stencil(batch, k, layout, w, istart, istop, offset);
+            compute_tensor_weights(wt, w, cell_volume);
+            if (full)
+            {
+                spread_marker<W, DEPTH, true>(q_data + offset, V, layout, wt, istart, istop);
+            }
+            else
+            {
+                spread_marker<W, DEPTH, false>(q_data + offset, V, layout, wt, istart, istop);
+            }
+        }
+    }
+    return;
+} // spread_markers
+
+template <class Kernel>
+void
+interpolate_kernel(double* const Q_data,
+                   const int Q_depth,
+                   const double* const X_data,
+                   const double* const q_data,
+                   const Box<NDIM>& q_data_box,
+                   const IntVector<NDIM>& q_gcw,
+                   const int q_depth,
+                   const double* const x_lower,
+                   const double* const dx,
+                   const int* const local_indices,
+                   const double* const periodic_shifts,
+                   const int num_local_indices)
+{
+    GhostBoxLayout layout;
+    init_ghost_box_layout(layout, q_data_box, q_gcw);
+    const IntVector<NDIM>& ilower = q_data_box.lower();
+    switch (q_depth)
+    {
+    case 1:
+        interpolate_markers<Kernel, 1>(Q_data,
+                                       Q_depth,
+                                       X_data,
+                                       q_data,
+                                       layout,
+                                       ilower,
+                                       x_lower,
+                                       dx,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices);
+        break;
+    case 2:
+        interpolate_markers<Kernel, 2>(Q_data,
+                                       Q_depth,
+                                       X_data,
+                                       q_data,
+                                       layout,
+                                       ilower,
+                                       x_lower,
+                                       dx,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices);
+        break;
+    case 3:
+        interpolate_markers<Kernel, 3>(Q_data,
+                                       Q_depth,
+                                       X_data,
+                                       q_data,
+                                       layout,
+                                       ilower,
+                                       x_lower,
+                                       dx,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices);
+        break;
+    default:
+        // Treat each component separately.
+        for (int d = 0; d < q_depth; ++d)
+        {
+            interpolate_markers<Kernel, 1>(Q_data + d,
+                                           Q_depth,
+                                           X_data,
+                                           q_data + d * layout.num_cells,
+                                           layout,
+                                           ilower,
+                                           x_lower,
+                                           dx,
+                                           local_indices,
+                                           periodic_shifts,
+                                           num_local_indices);
+        }
+    }
+    return;
+} // interpolate_kernel
+
+template <class Kernel>
+void
+spread_kernel(double* const q_data,
+              const Box<NDIM>& q_data_box,
+              const IntVector<NDIM>& q_gcw,
+              const int q_depth,
+              const double* const Q_data,
+              const int Q_depth,
+              const double* const X_data,
+              const double* const x_lower,
+              const double* const dx,
+              const int* const local_indices,
+              const double* const periodic_shifts,
+              const int num_local_indices,
+              const Box<NDIM>* const update_box)
+{
+    GhostBoxLayout layout;
+    init_ghost_box_layout(layout, q_data_box, q_gcw, update_box);
+    const IntVector<NDIM>& ilower = q_data_box.lower();
+    switch (q_depth)
+    {
+    case 1:
+        spread_markers<Kernel, 1>(q_data,
+                                  layout,
+                                  ilower,
+                                  Q_data,
+                                  Q_depth,
+                                  X_data,
+                                  x_lower,
+                                  dx,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices);
+        break;
+    case 2:
+        spread_markers<Kernel, 2>(q_data,
+                                  layout,
+                                  ilower,
+                                  Q_data,
+                                  Q_depth,
+                                  X_data,
+                                  x_lower,
+                                  dx,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices);
+        break;
+    case 3:
+        spread_markers<Kernel, 3>(q_data,
+                                  layout,
+                                  ilower,
+                                  Q_data,
+                                  Q_depth,
+                                  X_data,
+                                  x_lower,
+                                  dx,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices);
+        break;
+    default:
+        // Treat each component separately.
+        for (int d = 0; d < q_depth; ++d)
+        {
+            spread_markers<Kernel, 1>(q_data + d * layout.num_cells,
+                                      layout,
+                                      ilower,
+                                      Q_data + d,
+                                      Q_depth,
+                                      X_data,
+                                      x_lower,
+                                      dx,
+                                      local_indices,
+                                      periodic_shifts,
+                                      num_local_indices);
+        }
+    }
+    return;
+} // spread_kernel
+
+using InterpolateFcnPtr = void (*)(double*,
+                                   int,
+                                   const double*,
+                                   const double*,
+                                   const Box<NDIM>&,
+                                   const IntVector<NDIM>&,
+                                   int,
+                                   const double*,
+                                   const double*,
+                                   const int*,
+                                   const double*,
+                                   int);
+
+using SpreadFcnPtr = void (*)(double*,
+                              const Box<NDIM>&,
+                              const IntVector<NDIM>&,
+                              int,
+                              const double*,
+                              int,
+                              const double*,
+                              const double*,
+                              const double*,
+                              const int*,
+                              const double*,
+                              int,
+                              const Box<NDIM>*);
+
+struct KernelFcns
+{
+    InterpolateFcnPtr interpolate;
+    SpreadFcnPtr spread;
+};
+
+template <class Kernel>
+inline KernelFcns
+make_kernel_fcns()
+{
+    KernelFcns fcns;
+    fcns.interpolate = &interpolate_kernel<Kernel>;
+    fcns.spread = &spread_kernel<Kernel>;
+    return fcns;
+} // make_kernel_fcns
+
+bool
+get_kernel_fcns(const std::string& kernel_fcn, KernelFcns& fcns)
+{
+#define IBTK_GET_KERNEL_FCNS(name, Kernel)                                                                             \
+    if (kernel_fcn == name)                                                                                            \
+    {                                                                                                                  \
+        fcns = make_kernel_fcns<LEKernelFunctions::Kernel>();                                                          \
+        return true;                                                                                                   \
+    }
+    IBTK_GET_KERNEL_FCNS("PIECEWISE_CONSTANT", PiecewiseConstant);
+    IBTK_GET_KERNEL_FCNS("PIECEWISE_LINEAR", PiecewiseLinear);
+    IBTK_GET_KERNEL_FCNS("PIECEWISE_CUBIC", PiecewiseCubic);
+    IBTK_GET_KERNEL_FCNS("IB_3", IB3);
+    IBTK_GET_KERNEL_FCNS("IB_4", IB4);
+    IBTK_GET_KERNEL_FCNS("IB_4_W8", IB4W8);
+    IBTK_GET_KERNEL_FCNS("IB_5", IB5);
+    IBTK_GET_KERNEL_FCNS("IB_6", IB6);
+    IBTK_GET_KERNEL_FCNS("BSPLINE_3", BSpline3);
+    IBTK_GET_KERNEL_FCNS("BSPLINE_4", BSpline4);
+    IBTK_GET_KERNEL_FCNS("BSPLINE_5", BSpline5);
+    IBTK_GET_KERNEL_FCNS("BSPLINE_6", BSpline6);
+#undef IBTK_GET_KERNEL_FCNS
+    return false;
+} // get_kernel_fcns
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+bool
+LEInteractorKernels::isKernelSupported(const std::string& kernel_fcn)
+{
+    KernelFcns fcns;
+    return get_kernel_fcns(kernel_fcn, fcns);
+} // isKernelSupported
+
+void
+LEInteractorKernels::interpolate(double* const Q_data,
+                                 const int Q_depth,
+                                 const double* const X_data,
+                                 const double* const q_data,
+                                 const Box<NDIM>& q_data_box,
+                                 const IntVector<NDIM>& q_gcw,
+                                 const int q_depth,
+                                 const double* const x_lower,
+                                 const double* const dx,
+                                 const int* const local_indices,
+                                 const double* const periodic_shifts,
+                                 const int num_local_indices,
+                                 const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_depth == q_depth);
+#endif
+    KernelFcns fcns;
+    if (!get_kernel_fcns(interp_fcn, fcns))
+    {
+        TBOX_ERROR("LEInteractorKernels::interpolate()\n"
+                   << "  unsupported kernel function "
+                   << interp_fcn
+                   << std::endl);
+    }
+    if (num_local_indices == 0) return;
+    fcns.interpolate(Q_data,
+                     Q_depth,
+                     X_data,
+                     q_data,
+                     q_data_box,
+                     q_gcw,
+                     q_depth,
+                     x_lower,
+                     dx,
+                     local_indices,
+                     periodic_shifts,
+                     num_local_indices);
+    return;
+} // interpolate
+
+void
+LEInteractorKernels::spread(double* const q_data,
+                            const Box<NDIM>& q_data_box,
+                            const IntVector<NDIM>& q_gcw,
+                            const int q_depth,
+                            const double* const Q_data,
+                            const int Q_depth,
+                            const double* const X_data,
+                            const double* const x_lower,
+                            const double* const dx,
+                            const int* const local_indices,
+                            const double* const periodic_shifts,
+                            const int num_local_indices,
+                            const std::string& spread_fcn)
+{
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+    spread(q_data,
+           q_data_box,
+           q_gcw,
+           q_depth,
+           Q_data,
+           Q_depth,
+           X_data,
+           x_lower,
+           dx,
+           local_indices,
+           periodic_shifts,
+           num_local_indices,
+           spread_fcn,
+           ghost_box);
+    return;
+} // spread
+
+void
+LEInteractorKernels::spread(double* const q_data,
+                            const Box<NDIM>& q_data_box,
+                            const IntVector<NDIM>& q_gcw,
+                            const int q_depth,
+                            const double* const Q_data,
+                            const int Q_depth,
+                            const double* const X_data,
+                            const double* const x_lower,
+                            const double* const dx,
+                            const int* const local_indices,
+                            const double* const periodic_shifts,
+                            const int num_local_indices,
+                            const std::string& spread_fcn,
+                            const Box<NDIM>& update_box)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_depth == q_depth);
+#endif
+    KernelFcns fcns;
+    if (!get_kernel_fcns(spread_fcn, fcns))
+    {
+        TBOX_ERROR("LEInteractorKernels::spread()\n"
+                   << "  unsupported kernel function "
+                   << spread_fcn
+                   << std::endl);
+    }
+    if (num_local_indices == 0 || update_box.empty()) return;
+    fcns.spread(q_data,
+                q_data_box,
+                q_gcw,
+                q_depth,
+                Q_data,
+                Q_depth,
+                X_data,
+                x_lower,
+                dx,
+                local_indices,
+                periodic_shifts,
+                num_local_indices,
+                &update_box);
+    return;
+} // spread
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,409 @@
+// Filename: LEStencilCache.cpp
+// Created on 16 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "ibtk/LEKernelFunctions.h"
+#include "ibtk/LEStencilCache.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const int MAX_STENCIL_SIZE = 8;
+
+using WeightFcnPtr = int (*)(double, double*, int);
+
+WeightFcnPtr
+get_weight_fcn(const std::string& kernel_fcn, int& stencil_size)
+{
+    stencil_size = 0;
+#define IBTK_GET_WEIGHT_FCN(name, Kernel)                                                                              \
+    if (kernel_fcn == name)                                                                                            \
+    {                                                                                                                  \
+        stencil_size = LEKernelFunctions::Kernel::stencil_size;                                                        \
+        return &LEKernelFunctions::Kernel::computeWeights;                                                             \
+    }
+    IBTK_GET_WEIGHT_FCN("PIECEWISE_LINEAR", PiecewiseLinear);
+    IBTK_GET_WEIGHT_FCN("PIECEWISE_CUBIC", PiecewiseCubic);
+    IBTK_GET_WEIGHT_FCN("IB_3", IB3);
+    IBTK_GET_WEIGHT_FCN("IB_4", IB4);
+    IBTK_GET_WEIGHT_FCN("IB_4_W8", IB4W8);
+    IBTK_GET_WEIGHT_FCN("IB_5", IB5);
+    IBTK_GET_WEIGHT_FCN("IB_6", IB6);
+    IBTK_GET_WEIGHT_FCN("BSPLINE_3", BSpline3);
+    IBTK_GET_WEIGHT_FCN("BSPLINE_4", BSpline4);
+    IBTK_GET_WEIGHT_FCN("BSPLINE_5", BSpline5);
+    IBTK_GET_WEIGHT_FCN("BSPLINE_6", BSpline6);
+#undef IBTK_GET_WEIGHT_FCN
+    return nullptr;
+} // get_weight_fcn
+
+// Determine the portion of the stencil that lies within the ghost box of the
+// patch data and the corresponding offset into the data array.
+inline void
+clip_stencil(const int* const stencil_lower,
+             const int stencil_size,
+             const int* const ig_lower,
+             const int* const ig_upper,
+             const int* const stride,
+             int* const istart,
+             int* const istop,
+             int& offset)
+{
+    offset = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        istart[d] = std::max(ig_lower[d] - stencil_lower[d], 0);
+        istop[d] = (stencil_size - 1) - std::max(stencil_lower[d] + stencil_size - 1 - ig_upper[d], 0);
+        offset += (stencil_lower[d] - ig_lower[d]) * stride[d];
+    }
+    return;
+} // clip_stencil
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+bool
+LEStencilCache::isKernelSupported(const std::string& kernel_fcn)
+{
+    int stencil_size;
+    return get_weight_fcn(kernel_fcn, stencil_size) != nullptr;
+} // isKernelSupported
+
+void
+LEStencilCache::setMarkers(const std::vector<int>& local_indices,
+                           const std::vector<double>& periodic_shifts,
+                           const std::vector<int>& interior_offsets)
+{
+    d_local_indices = local_indices;
+    d_periodic_shifts = periodic_shifts;
+    d_interior_offsets = interior_offsets;
+    d_entries.clear();
+    return;
+} // setMarkers
+
+void
+LEStencilCache::clear()
+{
+    d_local_indices.clear();
+    d_periodic_shifts.clear();
+    d_interior_offsets.clear();
+    d_entries.clear();
+    return;
+} // clear
+
+int
+LEStencilCache::getNumberOfInteriorMarkers() const
+{
+    return static_cast<int>(d_interior_offsets.size());
+} // getNumberOfInteriorMarkers
+
+int
+LEStencilCache::getNumberOfMarkers() const
+{
+    return static_cast<int>(d_local_indices.size());
+} // getNumberOfMarkers
+
+void
+LEStencilCache::interpolate(double* const Q_data,
+                            const int Q_depth,
+                            const double* const X_data,
+                            const double* const q_data,
+                            const Box<NDIM>& q_data_box,
+                            const IntVector<NDIM>& q_gcw,
+                            const int q_depth,
+                            const double* const x_lower,
+                            const double* const dx,
+                            const std::string& interp_fcn,
+                            const bool interior_only)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_depth == q_depth);
+#else
+    NULL_USE(Q_depth);
+#endif
+    const int num_markers = interior_only ? getNumberOfInteriorMarkers() : getNumberOfMarkers();
+    if (num_markers == 0) return;
+    const Entry& entry = getEntry(interp_fcn, X_data, x_lower, dx, q_data_box.lower());
+    const int stencil_size = entry.stencil_size;
+
+    int ig_lower[NDIM], ig_upper[NDIM], stride[NDIM];
+    int num_cells = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ig_lower[d] = q_data_box.lower()(d) - q_gcw(d);
+        ig_upper[d] = q_data_box.upper()(d) + q_gcw(d);
+        stride[d] = num_cells;
+        num_cells *= ig_upper[d] - ig_lower[d] + 1;
+    }
+
+    int istart[NDIM], istop[NDIM], offset;
+    for (int k = 0; k < num_markers; ++k)
+    {
+        const int l = interior_only ? d_interior_offsets[k] : k;
+        const int s = d_local_indices[l];
+        const double* const w0 = &entry.weights[(0 + l * NDIM) * stencil_size];
+        const double* const w1 = &entry.weights[(1 + l * NDIM) * stencil_size];
+#if (NDIM == 3)
+        const double* const w2 = &entry.weights[(2 + l * NDIM) * stencil_size];
+#endif
+        clip_stencil(&entry.stencil_lower[l * NDIM], stencil_size, ig_lower, ig_upper, stride, istart, istop, offset);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            const double* const u = q_data + d * num_cells + offset;
+            double V = 0.0;
+#if (NDIM == 2)
+            for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+            {
+                const double* const u_i1 = u + i1 * stride[1];
+                for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                {
+                    V += (w0[i0] * w1[i1]) * u_i1[i0];
+                }
+            }
+#endif
+#if (NDIM == 3)
+            for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+            {
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    const double wyz = w1[i1] * w2[i2];
+                    const double* const u_i1_i2 = u + i1 * stride[1] + i2 * stride[2];
+                    for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                    {
+                        V += (w0[i0] * wyz) * u_i1_i2[i0];
+                    }
+                }
+            }
+#endif
+            Q_data[d + s * Q_depth] = V;
+        }
+    }
+    return;
+} // interpolate
+
+void
+LEStencilCache::spread(double* const q_data,
+                       const Box<NDIM>& q_data_box,
+                       const IntVector<NDIM>& q_gcw,
+                       const int q_depth,
+                       const double* const Q_data,
+                       const int Q_depth,
+                       const double* const X_data,
+                       const double* const x_lower,
+                       const double* const dx,
+                       const std::string& spread_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_depth == q_depth);
+#else
+    NULL_USE(Q_depth);
+#endif
+    const int num_markers = getNumberOfMarkers();
+    if (num_markers == 0) return;
+    const Entry& entry = getEntry(spread_fcn, X_data, x_lower, dx, q_data_box.lower());
+    const int stencil_size = entry.stencil_size;
+
+    int ig_lower[NDIM], ig_upper[NDIM], stride[NDIM];
+    int num_cells = 1;
+    double cell_volume = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ig_lower[d] = q_data_box.lower()(d) - q_gcw(d);
+        ig_upper[d] = q_data_box.upper()(d) + q_gcw(d);
+        stride[d] = num_cells;
+        num_cells *= ig_upper[d] - ig_lower[d] + 1;
+        cell_volume *= dx[d];
+    }
+
+    int istart[NDIM], istop[NDIM], offset;
+    for (int l = 0; l < num_markers; ++l)
+    {
+        const int s = d_local_indices[l];
+        const double* const w0 = &entry.weights[(0 + l * NDIM) * stencil_size];
+        const double* const w1 = &entry.weights[(1 + l * NDIM) * stencil_size];
+#if (NDIM == 3)
+        const double* const w2 = &entry.weights[(2 + l * NDIM) * stencil_size];
+#endif
+        clip_stencil(&entry.stencil_lower[l * NDIM], stencil_size, ig_lower, ig_upper, stride, istart, istop, offset);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            double* const u = q_data + d * num_cells + offset;
+            const double V = Q_data[d + s * Q_depth];
+#if (NDIM == 2)
+            for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+            {
+                const double wy = w1[i1] / cell_volume;
+                double* const u_i1 = u + i1 * stride[1];
+                for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                {
+                    u_i1[i0] += (w0[i0] * wy) * V;
+                }
+            }
+#endif
+#if (NDIM == 3)
+            for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+            {
+                const double wz = w2[i2] / cell_volume;
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    const double wyz = w1[i1] * wz;
+                    double* const u_i1_i2 = u + i1 * stride[1] + i2 * stride[2];
+                    for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                    {
+                        u_i1_i2[i0] += (w0[i0] * wyz) * V;
+                    }
+                }
+            }
+#endif
+        }
+    }
+    return;
+} // spread
+
+int
+LEStencilCache::getNumberOfHits() const
+{
+    return d_num_hits;
+} // getNumberOfHits
+
+int
+LEStencilCache::getNumberOfMisses() const
+{
+    return d_num_misses;
+} // getNumberOfMisses
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+const LEStencilCache::Entry&
+LEStencilCache::getEntry(const std::string& kernel_fcn,
+                         const double* const X_data,
+                         const double* const x_lower,
+                         const double* const dx,
+                         const IntVector<NDIM>& ilower)
+{
+    // Look for stencils computed for the same kernel and grid centering.
+    auto it = std::find_if(d_entries.begin(), d_entries.end(), [&](const Entry& entry) {
+        return entry.kernel_fcn == kernel_fcn && entry.ilower == ilower &&
+               std::equal(entry.x_lower.begin(), entry.x_lower.end(), x_lower) &&
+               std::equal(entry.dx.begin(), entry.dx.end(), dx);
+    });
+    if (it == d_entries.end())
+    {
+        d_entries.push_back(Entry());
+        it = d_entries.end() - 1;
+        Entry& entry = *it;
+        entry.kernel_fcn = kernel_fcn;
+        entry.ilower = ilower;
+        std::copy(x_lower, x_lower + NDIM, entry.x_lower.begin());
+        std::copy(dx, dx + NDIM, entry.dx.begin());
+        ++d_num_misses;
+        computeEntry(entry, X_data);
+        return entry;
+    }
+
+    // Reuse the stencils only if the marker positions are unchanged.
+    Entry& entry = *it;
+    const int num_markers = getNumberOfMarkers();
+    bool positions_unchanged = true;
+    for (int l = 0; l < num_markers && positions_unchanged; ++l)
+    {
+        const int s = d_local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double X = X_data[d + s * NDIM] + d_periodic_shifts[d + l * NDIM];
+            positions_unchanged = positions_unchanged && (entry.X_shifted[d + l * NDIM] == X);
+        }
+    }
+    if (positions_unchanged)
+    {
+        ++d_num_hits;
+    }
+    else
+    {
+        ++d_num_misses;
+        computeEntry(entry, X_data);
+    }
+    return entry;
+} // getEntry
+
+void
+LEStencilCache::computeEntry(Entry& entry, const double* const X_data) const
+{
+    const WeightFcnPtr weight_fcn = get_weight_fcn(entry.kernel_fcn, entry.stencil_size);
+    if (!weight_fcn)
+    {
+        TBOX_ERROR("LEStencilCache::computeEntry()\n"
+                   << "  unsupported kernel function "
+                   << entry.kernel_fcn
+                   << std::endl);
+    }
+    const int stencil_size = entry.stencil_size;
+    const int num_markers = getNumberOfMarkers();
+    entry.X_shifted.resize(NDIM * num_markers);
+    entry.stencil_lower.resize(NDIM * num_markers);
+    entry.weights.resize(NDIM * stencil_size * num_markers);
+    double w[MAX_STENCIL_SIZE];
+    for (int l = 0; l < num_markers; ++l)
+    {
+        const int s = d_local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double X = X_data[d + s * NDIM] + d_periodic_shifts[d + l * NDIM];
+            entry.X_shifted[d + l * NDIM] = X;
+            const double X_o_dx = (X - entry.x_lower[d]) / entry.dx[d];
+            entry.stencil_lower[d + l * NDIM] = weight_fcn(X_o_dx, w, 1) + entry.ilower(d);
+            std::copy(w, w + stencil_size, &entry.weights[(d + l * NDIM) * stencil_size]);
+        }
+    }
+    return;
+} // computeEntry
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
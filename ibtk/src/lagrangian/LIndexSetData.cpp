@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -41,6 +42,7 @@
 #include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
+#include "ibtk/LEStencilCache.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
 #include "ibtk/LSetData.h"
@@ -70,7 +72,9 @@ LIndexSetData<T>::LIndexSetData(Box<NDIM> box, IntVector<NDIM> ghosts) : LSetDat
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const bool sort_by_local_petsc_index)
 {
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
@@ -84,6 +88,11 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
     d_periodic_shifts.clear();
     d_interior_periodic_shifts.clear();
     d_ghost_periodic_shifts.clear();
+    d_interior_offsets.clear();
+    d_occupied_cell_indices.clear();
+    d_cell_offsets.assign(1, 0);
+    d_cell_local_petsc_indices.clear();
+    d_cell_periodic_shifts.clear();
 
     const Box<NDIM>& patch_box = patch->getBox();
     const Index<NDIM>& ilower = patch_box.lower();
@@ -98,6 +107,13 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
     }
 
+    struct IndexEntry
+    {
+        int lag_idx, global_petsc_idx, local_petsc_idx;
+        std::array<double, NDIM> periodic_shift;
+        bool patch_owns_idx;
+    };
+    std::vector<IndexEntry> entries;
     for (typename LSetData<T>::SetIterator it(*this); it; it++)
     {
         const CellIndex<NDIM>& i = it.getIndex();
@@ -120,41 +136,64 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         }
         const LSet<T>& idx_set = *it;
         const bool patch_owns_idx_set = patch_box.contains(i);
+        std::array<double, NDIM> cell_periodic_shift;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            cell_periodic_shift[d] = static_cast<double>(offset[d]) * dx[d];
+        }
+        d_occupied_cell_indices.push_back(i);
+        d_cell_periodic_shifts.insert(
+            d_cell_periodic_shifts.end(), cell_periodic_shift.begin(), cell_periodic_shift.end());
         for (auto n = idx_set.begin(); n != idx_set.end(); ++n)
         {
             const typename LSet<T>::value_type& idx = *n;
-            const int lag_idx = idx->getLagrangianIndex();
-            const int global_petsc_idx = idx->getGlobalPETScIndex();
-            const int local_petsc_idx = idx->getLocalPETScIndex();
-            d_lag_indices.push_back(lag_idx);
-            d_global_petsc_indices.push_back(global_petsc_idx);
-            d_local_petsc_indices.push_back(local_petsc_idx);
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                d_periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
-            }
-            if (patch_owns_idx_set)
-            {
-                d_interior_lag_indices.push_back(lag_idx);
-                d_interior_global_petsc_indices.push_back(global_petsc_idx);
-                d_interior_local_petsc_indices.push_back(local_petsc_idx);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_interior_periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
-                }
-            }
-            else
-            {
-                d_ghost_lag_indices.push_back(lag_idx);
-                d_ghost_global_petsc_indices.push_back(global_petsc_idx);
-                d_ghost_local_petsc_indices.push_back(local_petsc_idx);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_ghost_periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
-                }
-            }
+            IndexEntry entry;
+            entry.lag_idx = idx->getLagrangianIndex();
+            entry.global_petsc_idx = idx->getGlobalPETScIndex();
+            entry.local_petsc_idx = idx->getLocalPETScIndex();
+            entry.periodic_shift = cell_periodic_shift;
+            entry.patch_owns_idx = patch_owns_idx_set;
+            entries.push_back(entry);
+            d_cell_local_petsc_indices.push_back(entry.local_petsc_idx);
+        }
+        d_cell_offsets.push_back(static_cast<int>(d_cell_local_petsc_indices.size()));
+    }
+
+    if (sort_by_local_petsc_index)
+    {
+        std::stable_sort(entries.begin(), entries.end(), [](const IndexEntry& a, const IndexEntry& b) {
+            return a.local_petsc_idx < b.local_petsc_idx;
+        });
+    }
+
+    for (const auto& entry : entries)
+    {
+        if (entry.patch_owns_idx)
+        {
+            d_interior_offsets.push_back(static_cast<int>(d_local_petsc_indices.size()));
+        }
+        d_lag_indices.push_back(entry.lag_idx);
+        d_global_petsc_indices.push_back(entry.global_petsc_idx);
+        d_local_petsc_indices.push_back(entry.local_petsc_idx);
+        d_periodic_shifts.insert(d_periodic_shifts.end(), entry.periodic_shift.begin(), entry.periodic_shift.end());
+        if (entry.patch_owns_idx)
+        {
+            d_interior_lag_indices.push_back(entry.lag_idx);
+            d_interior_global_petsc_indices.push_back(entry.global_petsc_idx);
+            d_interior_local_petsc_indices.push_back(entry.local_petsc_idx);
+            d_interior_periodic_shifts.insert(
+                d_interior_periodic_shifts.end(), entry.periodic_shift.begin(), entry.periodic_shift.end());
+        }
+        else
+        {
+            d_ghost_lag_indices.push_back(entry.lag_idx);
+            d_ghost_global_petsc_indices.push_back(entry.global_petsc_idx);
+            d_ghost_local_petsc_indices.push_back(entry.local_petsc_idx);
+            d_ghost_periodic_shifts.insert(
+                d_ghost_periodic_shifts.end(), entry.periodic_shift.begin(), entry.periodic_shift.end());
         }
     }
+    d_stencil_cache_is_current = false;
     return;
 } // cacheLocalIndices
 
@@ -86,15 +86,81 @@ static const std::string SILO_SUMMARY_FILE_PREFIX = "lag_data.cycle_";
 static const std::string SILO_SUMMARY_FILE_POSTFIX = ".summary.silo";
 static const std::string SILO_PROCESSOR_FILE_PREFIX = "lag_data.proc_";
 static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
+static const std::string SILO_GROUP_FILE_PREFIX = "lag_data.group_";
+static const std::string SILO_GROUP_FILE_POSTFIX = ".silo";
+static const std::string SILO_PROCESSOR_DIR_PREFIX = "proc_";
 
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
 #if defined(IBTK_HAVE_SILO)
+/*!
+ * \brief The name of the Silo file to which the specified MPI process writes
+ * its data when the processes are divided into groups of the specified size.
+ */
+std::string
+get_processor_file_name(const int proc, const int group_size)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    if (group_size == 1)
+    {
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
+        return SILO_PROCESSOR_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX;
+    }
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc / group_size);
+    return SILO_GROUP_FILE_PREFIX + temp_buf + SILO_GROUP_FILE_POSTFIX;
+} // get_processor_file_name
+
+/*!
+ * \brief The name of the directory within its Silo file to which the specified
+ * MPI process writes its data, or an empty string if the process does not
+ * share its file with other processes.
+ */
+std::string
+get_processor_dir_name(const int proc, const int group_size)
+{
+    if (group_size == 1) return std::string();
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
+    return SILO_PROCESSOR_DIR_PREFIX + temp_buf;
+} // get_processor_dir_name
+
+/*!
+ * \brief The path (relative to the summary file) that prefixes the names of
+ * the local meshes and variables written by the specified MPI process.
+ */
+std::string
+get_processor_block_path(const int proc, const int group_size)
+{
+    const std::string dir_name = get_processor_dir_name(proc, group_size);
+    return get_processor_file_name(proc, group_size) + ":" + (dir_name.empty() ? dir_name : dir_name + "/");
+} // get_processor_block_path
+
+/*!
+ * \brief The Silo data type corresponding to a floating point type.
+ */
+template <class T>
+int silo_datatype();
+
+template <>
+inline int
+silo_datatype<float>()
+{
+    return DB_FLOAT;
+} // silo_datatype
+
+template <>
+inline int
+silo_datatype<double>()
+{
+    return DB_DOUBLE;
+} // silo_datatype
+
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
  * points.
  */
+template <class T>
 void
 build_local_marker_cloud(DBfile* dbfile,
                          std::string& dirname,
@@ -109,8 +175,8 @@ build_local_marker_cloud(DBfile* dbfile,
                          const int time_step,
                          const double simulation_time)
 {
-    std::vector<float> block_X(NDIM * nmarks);
-    std::vector<std::vector<float> > block_varvals(nvars);
+    std::vector<T> block_X(NDIM * nmarks);
+    std::vector<std::vector<T> > block_varvals(nvars);
     for (int v = 0; v < nvars; ++v)
     {
         const int varplotdepth = varplotdepths[v];
@@ -122,7 +188,7 @@ build_local_marker_cloud(DBfile* dbfile,
         // Get the coordinate data.
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            block_X[d * nmarks + i] = static_cast<float>(X[NDIM * i + d]);
+            block_X[d * nmarks + i] = static_cast<T>(X[NDIM * i + d]);
         }
 
         // Get the variable data.
@@ -133,7 +199,7 @@ build_local_marker_cloud(DBfile* dbfile,
             const int vardepth = vardepths[v];
             for (int d = 0; d < varplotdepth; ++d)
             {
-                block_varvals[v][d * nmarks + i] = static_cast<float>(varvals[v][vardepth * i + varstartdepth + d]);
+                block_varvals[v][d * nmarks + i] = static_cast<T>(varvals[v][vardepth * i + varstartdepth + d]);
             }
         }
     }
@@ -159,7 +225,7 @@ build_local_marker_cloud(DBfile* dbfile,
     DBAddOption(optlist, DBOPT_DTIME, &dtime);
 
     const char* meshname = "mesh";
-    std::vector<float*> coords(NDIM);
+    std::vector<T*> coords(NDIM);
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         coords[d] = nmarks > 0 ? &block_X[d * nmarks] : nullptr;
@@ -167,14 +233,14 @@ build_local_marker_cloud(DBfile* dbfile,
 
     int ndims = NDIM;
 
-    DBPutPointmesh(dbfile, meshname, ndims, &coords[0], nmarks, DB_FLOAT, optlist);
+    DBPutPointmesh(dbfile, meshname, ndims, &coords[0], nmarks, silo_datatype<T>(), optlist);
 
     for (int v = 0; v < nvars; ++v)
     {
         const char* varname = varnames[v].c_str();
         const int varplotdepth = varplotdepths[v];
 
-        std::vector<float*> vars(varplotdepth);
+        std::vector<T*> vars(varplotdepth);
         for (int d = 0; d < varplotdepth; ++d)
         {
             vars[d] = nmarks > 0 ? &block_varvals[v][d * nmarks] : nullptr;
@@ -182,11 +248,11 @@ build_local_marker_cloud(DBfile* dbfile,
 
         if (varplotdepth == 1)
         {
-            DBPutPointvar1(dbfile, varname, meshname, vars[0], nmarks, DB_FLOAT, optlist);
+            DBPutPointvar1(dbfile, varname, meshname, vars[0], nmarks, silo_datatype<T>(), optlist);
         }
         else
         {
-            DBPutPointvar(dbfile, varname, meshname, varplotdepth, &vars[0], nmarks, DB_FLOAT, optlist);
+            DBPutPointvar(dbfile, varname, meshname, varplotdepth, &vars[0], nmarks, silo_datatype<T>(), optlist);
         }
     }
 
@@ -207,6 +273,7 @@ build_local_marker_cloud(DBfile* dbfile,
  * \brief Build a local mesh database entry corresponding to a quadrilateral
  * curvilinear block.
  */
+template <class T>
 void
 build_local_curv_block(DBfile* dbfile,
                        std::string& dirname,
@@ -248,8 +315,8 @@ build_local_curv_block(DBfile* dbfile,
 #endif
         ;
 
-    std::vector<float> block_X(NDIM * ntot);
-    std::vector<std::vector<float> > block_varvals(nvars);
+    std::vector<T> block_X(NDIM * ntot);
+    std::vector<std::vector<T> > block_varvals(nvars);
     for (int v = 0; v < nvars; ++v)
     {
         const int varplotdepth = varplotdepths[v];
@@ -279,7 +346,7 @@ build_local_curv_block(DBfile* dbfile,
                 // Get the coordinate data.
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    block_X[d * ntot + offset] = static_cast<float>(X[NDIM * idx + d]);
+                    block_X[d * ntot + offset] = static_cast<T>(X[NDIM * idx + d]);
                 }
 
                 // Get the variable data.
@@ -290,7 +357,7 @@ build_local_curv_block(DBfile* dbfile,
                     const int vardepth = vardepths[v];
                     for (int d = 0; d < varplotdepth; ++d)
                     {
-                        block_varvals[v][d * ntot + offset] = static_cast<float>(varvals[v][vardepth * idx + varstartdepth + d]);
+                        block_varvals[v][d * ntot + offset] = static_cast<T>(varvals[v][vardepth * idx + varstartdepth + d]);
                     }
                 }
 
@@ -326,7 +393,7 @@ build_local_curv_block(DBfile* dbfile,
 
     const char* meshname = "mesh";
     const char* coordnames[3] = { "xcoords", "ycoords", "zcoords" };
-    std::vector<float*> coords(NDIM);
+    std::vector<T*> coords(NDIM);
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         coords[d] = ntot > 0 ? &block_X[d * ntot] : nullptr;
@@ -345,7 +412,7 @@ build_local_curv_block(DBfile* dbfile,
                   &coords[0],
                   &dims[0],
                   ndims,
-                  DB_FLOAT,
+                  silo_datatype<T>(),
                   DB_NONCOLLINEAR,
                   optlist);
 
@@ -360,7 +427,7 @@ build_local_curv_block(DBfile* dbfile,
             compnames[d] = strdup(compname.c_str());
         }
 
-        std::vector<float*> vars(varplotdepth);
+        std::vector<T*> vars(varplotdepth);
         for (int d = 0; d < varplotdepth; ++d)
         {
             vars[d] = ntot > 0 ? &block_varvals[v][d * ntot] : nullptr;
@@ -368,7 +435,17 @@ build_local_curv_block(DBfile* dbfile,
 
         if (varplotdepth == 1)
         {
-            DBPutQuadvar1(dbfile, varname, meshname, vars[0], &dims[0], ndims, nullptr, 0, DB_FLOAT, DB_NODECENT, optlist);
+            DBPutQuadvar1(dbfile,
+                          varname,
+                          meshname,
+                          vars[0],
+                          &dims[0],
+                          ndims,
+                          nullptr,
+                          0,
+                          silo_datatype<T>(),
+                          DB_NODECENT,
+                          optlist);
         }
         else
         {
@@ -382,7 +459,7 @@ build_local_curv_block(DBfile* dbfile,
                          ndims,
                          nullptr,
                          0,
-                         DB_FLOAT,
+                         silo_datatype<T>(),
                          DB_NODECENT,
                          optlist);
         }
@@ -410,6 +487,7 @@ build_local_curv_block(DBfile* dbfile,
  * \brief Build a local mesh database entry corresponding to an unstructured
  * mesh.
  */
+template <class T>
 void
 build_local_ucd_mesh(DBfile* dbfile,
                      std::string& dirname,
@@ -428,8 +506,8 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Rearrange the data into the format required by Silo.
     const int ntot = static_cast<int>(vertices.size());
 
-    std::vector<float> block_X(NDIM * ntot);
-    std::vector<std::vector<float> > block_varvals(nvars);
+    std::vector<T> block_X(NDIM * ntot);
+    std::vector<std::vector<T> > block_varvals(nvars);
     for (int v = 0; v < nvars; ++v)
     {
         const int varplotdepth = varplotdepths[v];
@@ -445,7 +523,7 @@ build_local_ucd_mesh(DBfile* dbfile,
         // Get the coordinate data.
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            block_X[d * ntot + offset] = static_cast<float>(X[NDIM * offset + d]);
+            block_X[d * ntot + offset] = static_cast<T>(X[NDIM * offset + d]);
         }
 
         // Get the variable data.
@@ -456,7 +534,7 @@ build_local_ucd_mesh(DBfile* dbfile,
             const int vardepth = vardepths[v];
             for (int d = 0; d < varplotdepth; ++d)
             {
-                block_varvals[v][d * ntot + offset] = static_cast<float>(varvals[v][vardepth * offset + varstartdepth + d]);
+                block_varvals[v][d * ntot + offset] = static_cast<T>(varvals[v][vardepth * offset + varstartdepth + d]);
             }
         }
 
@@ -513,7 +591,7 @@ build_local_ucd_mesh(DBfile* dbfile,
 
     const char* meshname = "mesh";
     const char* coordnames[3] = { "xcoords", "ycoords", "zcoords" };
-    std::vector<float*> coords(NDIM);
+    std::vector<T*> coords(NDIM);
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         coords[d] = ntot > 0 ? &block_X[d * ntot] : nullptr;
@@ -567,7 +645,7 @@ build_local_ucd_mesh(DBfile* dbfile,
                  nzones,
                  "zonelist",
                  nullptr,
-                 DB_FLOAT,
+                 silo_datatype<T>(),
                  nullptr);
 
     // Write the variables defined on the unstructured mesh.
@@ -582,7 +660,7 @@ build_local_ucd_mesh(DBfile* dbfile,
             compnames[d] = strdup(compname.c_str());
         }
 
-        std::vector<float*> vars(varplotdepth);
+        std::vector<T*> vars(varplotdepth);
         for (int d = 0; d < varplotdepth; ++d)
         {
             vars[d] = ntot > 0 ? &block_varvals[v][d * ntot] : nullptr;
@@ -590,7 +668,8 @@ build_local_ucd_mesh(DBfile* dbfile,
 
         if (varplotdepth == 1)
         {
-            DBPutUcdvar1(dbfile, varname, meshname, vars[0], nnodes, nullptr, 0, DB_FLOAT, DB_NODECENT, optlist);
+            DBPutUcdvar1(
+                dbfile, varname, meshname, vars[0], nnodes, nullptr, 0, silo_datatype<T>(), DB_NODECENT, optlist);
         }
         else
         {
@@ -603,7 +682,7 @@ build_local_ucd_mesh(DBfile* dbfile,
                         nnodes,
                         nullptr,
                         0,
-                        DB_FLOAT,
+                        silo_datatype<T>(),
                         DB_NODECENT,
                         optlist);
         }
@@ -831,6 +910,20 @@ LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
     return;
 } // resetLevels
 
+void
+LSiloDataWriter::setNumberOfFiles(const int num_files)
+{
+    d_num_files = num_files;
+    return;
+} // setNumberOfFiles
+
+void
+LSiloDataWriter::setUseDoublePrecision(const bool use_double_precision)
+{
+    d_use_double_precision = use_double_precision;
+    return;
+} // setUseDoublePrecision
+
 void
 LSiloDataWriter::registerMarkerCloud(const std::string& name,
                                      const int nmarks,
@@ -1280,68 +1373,107 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    // Scatter the data from "global" to "local" form.  The scatters are
+    // collective operations, so all processes must complete them before any
+    // process waits for its turn to write to a shared Silo file below.
+    std::vector<Vec> X_local_vecs(d_finest_ln + 1, nullptr);
+    std::vector<double*> X_local_arrs(d_finest_ln + 1, nullptr);
+    std::vector<std::vector<Vec> > v_local_vecs(d_finest_ln + 1);
+    std::vector<std::vector<double*> > v_local_arrs(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named "
-                                 << current_file_name
-                                 << std::endl);
-    }
+        if (!d_coords_data[ln]) continue;
 
-    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
-    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
+        ierr = VecDuplicate(d_dst_vec[ln][NDIM], &X_local_vecs[ln]);
+        IBTK_CHKERRQ(ierr);
+        Vec global_X_vec = d_coords_data[ln]->getVec();
+        ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, X_local_vecs[ln], INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, X_local_vecs[ln], INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGetArray(X_local_vecs[ln], &X_local_arrs[ln]);
+        IBTK_CHKERRQ(ierr);
 
-    // Set the local data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        if (d_coords_data[ln])
+        v_local_vecs[ln].resize(d_nvars[ln]);
+        v_local_arrs[ln].resize(d_nvars[ln]);
+        for (int v = 0; v < d_nvars[ln]; ++v)
         {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+            const int var_depth = d_var_depths[ln][v];
+            ierr = VecDuplicate(d_dst_vec[ln][var_depth], &v_local_vecs[ln][v]);
             IBTK_CHKERRQ(ierr);
-
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            Vec global_v_vec = d_var_data[ln][v]->getVec();
+            ierr = VecScatterBegin(
+                d_vec_scatter[ln][var_depth], global_v_vec, v_local_vecs[ln][v], INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            ierr = VecScatterEnd(
+                d_vec_scatter[ln][var_depth], global_v_vec, v_local_vecs[ln][v], INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
+            ierr = VecGetArray(v_local_vecs[ln][v], &v_local_arrs[ln][v]);
             IBTK_CHKERRQ(ierr);
+        }
+    }
 
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
-
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
+    // Determine the Silo file to which this process writes its data.  When the
+    // processes are divided into groups that share a file, the processes in
+    // each group write their data in turn: each process waits until the
+    // preceding process in its group has closed the file.  Only Silo calls are
+    // made while a process holds the file.
+    const int group_size =
+        (d_num_files > 0 && d_num_files < mpi_nodes) ? (mpi_nodes + d_num_files - 1) / d_num_files : 1;
+    const int group_rank = mpi_rank % group_size;
+    current_file_name = dump_dirname + "/" + get_processor_file_name(mpi_rank, group_size);
+    if (group_rank == 0)
+    {
+        if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create DBfile named "
+                                     << current_file_name
+                                     << std::endl);
+        }
+    }
+    else
+    {
+        int baton;
+        MPI_Status status;
+        MPI_Recv(&baton, 1, MPI_INT, mpi_rank - 1, SILO_MPI_TAG, SAMRAI_MPI::commWorld, &status);
+        if (!(dbfile = DBOpen(current_file_name.c_str(), DB_PDB, DB_APPEND)))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not open DBfile named "
+                                     << current_file_name
+                                     << std::endl);
+        }
+    }
+    const std::string processor_dir_name = get_processor_dir_name(mpi_rank, group_size);
+    if (!processor_dir_name.empty())
+    {
+        if (DBMkDir(dbfile, processor_dir_name.c_str()) == -1 || DBSetDir(dbfile, processor_dir_name.c_str()) == -1)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create directory named "
+                                     << processor_dir_name
+                                     << std::endl);
+        }
+    }
 
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
+    // Select the precision of the output data.
+    const auto build_marker_cloud =
+        d_use_double_precision ? &build_local_marker_cloud<double> : &build_local_marker_cloud<float>;
+    const auto build_curv_block =
+        d_use_double_precision ? &build_local_curv_block<double> : &build_local_curv_block<float>;
+    const auto build_ucd_mesh = d_use_double_precision ? &build_local_ucd_mesh<double> : &build_local_ucd_mesh<float>;
 
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
+    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
+    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
 
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
-            }
+    // Set the local data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_coords_data[ln])
+        {
+            const double* const local_X_arr = X_local_arrs[ln];
+            const std::vector<double*>& local_v_arrs = v_local_arrs[ln];
 
             // Keep track of the current offset in the local Vec data.
             int offset = 0;
@@ -1368,18 +1500,18 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
                 }
 
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
+                build_marker_cloud(dbfile,
+                                   dirname,
+                                   nmarks,
+                                   X,
+                                   d_nvars[ln],
+                                   d_var_names[ln],
+                                   d_var_start_depths[ln],
+                                   d_var_plot_depths[ln],
+                                   d_var_depths[ln],
+                                   var_vals,
+                                   time_step_number,
+                                   simulation_time);
 
                 offset += nmarks;
             }
@@ -1408,19 +1540,19 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
                 }
 
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
+                build_curv_block(dbfile,
+                                 dirname,
+                                 nelem,
+                                 periodic,
+                                 X,
+                                 d_nvars[ln],
+                                 d_var_names[ln],
+                                 d_var_start_depths[ln],
+                                 d_var_plot_depths[ln],
+                                 d_var_depths[ln],
+                                 var_vals,
+                                 time_step_number,
+                                 simulation_time);
                 meshtype[ln].push_back(DB_QUAD_CURV);
                 vartype[ln].push_back(DB_QUADVAR);
 
@@ -1438,7 +1570,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
                     const int ntot = nelem.getProduct();
 
-                    std::string dirname = "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
+                    std::string dirname = "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" +
+                                          std::to_string(block);
 
                     if (DBMkDir(dbfile, dirname.c_str()) == -1)
                     {
@@ -1455,19 +1588,19 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                         var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
                     }
 
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
+                    build_curv_block(dbfile,
+                                     dirname,
+                                     nelem,
+                                     periodic,
+                                     X,
+                                     d_nvars[ln],
+                                     d_var_names[ln],
+                                     d_var_start_depths[ln],
+                                     d_var_plot_depths[ln],
+                                     d_var_depths[ln],
+                                     var_vals,
+                                     time_step_number,
+                                     simulation_time);
                     multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
                     multivartype[ln][mb].push_back(DB_QUADVAR);
 
@@ -1499,296 +1632,195 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
                 }
 
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
+                build_ucd_mesh(dbfile,
+                               dirname,
+                               vertices,
+                               edge_map,
+                               X,
+                               d_nvars[ln],
+                               d_var_names[ln],
+                               d_var_start_depths[ln],
+                               d_var_plot_depths[ln],
+                               d_var_depths[ln],
+                               var_vals,
+                               time_step_number,
+                               simulation_time);
 
                 offset += ntot;
             }
-
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
-            }
         }
     }
 
     DBClose(dbfile);
-
-    // Send data to the root MPI process required to create the multimesh and
-    // multivar objects.
-    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
-    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
-    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
-    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
-        ucd_mesh_names_per_proc;
-
-    if (mpi_rank == SILO_MPI_ROOT)
+    if (group_rank + 1 < group_size && mpi_rank + 1 < mpi_nodes)
     {
-        nclouds_per_proc.resize(d_finest_ln + 1);
-        nblocks_per_proc.resize(d_finest_ln + 1);
-        nmbs_per_proc.resize(d_finest_ln + 1);
-        nucd_meshes_per_proc.resize(d_finest_ln + 1);
-        meshtypes_per_proc.resize(d_finest_ln + 1);
-        vartypes_per_proc.resize(d_finest_ln + 1);
-        mb_nblocks_per_proc.resize(d_finest_ln + 1);
-        multimeshtypes_per_proc.resize(d_finest_ln + 1);
-        multivartypes_per_proc.resize(d_finest_ln + 1);
-        cloud_names_per_proc.resize(d_finest_ln + 1);
-        block_names_per_proc.resize(d_finest_ln + 1);
-        mb_names_per_proc.resize(d_finest_ln + 1);
-        ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
+        int baton = 0;
+        MPI_Send(&baton, 1, MPI_INT, mpi_rank + 1, SILO_MPI_TAG, SAMRAI_MPI::commWorld);
     }
 
+    // Clean up allocated data.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (mpi_rank == SILO_MPI_ROOT)
+        if (!d_coords_data[ln]) continue;
+        ierr = VecRestoreArray(X_local_vecs[ln], &X_local_arrs[ln]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&X_local_vecs[ln]);
+        IBTK_CHKERRQ(ierr);
+        for (int v = 0; v < d_nvars[ln]; ++v)
         {
-            nclouds_per_proc[ln].resize(mpi_nodes);
-            nblocks_per_proc[ln].resize(mpi_nodes);
-            nmbs_per_proc[ln].resize(mpi_nodes);
-            nucd_meshes_per_proc[ln].resize(mpi_nodes);
-            meshtypes_per_proc[ln].resize(mpi_nodes);
-            vartypes_per_proc[ln].resize(mpi_nodes);
-            mb_nblocks_per_proc[ln].resize(mpi_nodes);
-            multimeshtypes_per_proc[ln].resize(mpi_nodes);
-            multivartypes_per_proc[ln].resize(mpi_nodes);
-            cloud_names_per_proc[ln].resize(mpi_nodes);
-            block_names_per_proc[ln].resize(mpi_nodes);
-            mb_names_per_proc[ln].resize(mpi_nodes);
-            ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
+            ierr = VecRestoreArray(v_local_vecs[ln][v], &v_local_arrs[ln][v]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&v_local_vecs[ln][v]);
+            IBTK_CHKERRQ(ierr);
         }
+    }
 
-        // Set the values for the root process.
-        if (mpi_rank == SILO_MPI_ROOT)
+    // Gather the data required to create the multimesh and multivar objects on
+    // the root MPI process.  The integer data and the names of the local
+    // meshes are packed into contiguous buffers that are gathered collectively.
+    std::vector<int> int_data;
+    std::vector<char> name_data;
+    auto pack_names = [&name_data](const std::vector<std::string>& names, const int num_names) {
+        for (int k = 0; k < num_names; ++k)
         {
-            nclouds_per_proc[ln][mpi_rank] = d_nclouds[ln];
-            nblocks_per_proc[ln][mpi_rank] = d_nblocks[ln];
-            nmbs_per_proc[ln][mpi_rank] = d_nmbs[ln];
-            nucd_meshes_per_proc[ln][mpi_rank] = d_nucd_meshes[ln];
-            meshtypes_per_proc[ln][mpi_rank] = meshtype[ln];
-            vartypes_per_proc[ln][mpi_rank] = vartype[ln];
-            mb_nblocks_per_proc[ln][mpi_rank] = d_mb_nblocks[ln];
-            multimeshtypes_per_proc[ln][mpi_rank] = multimeshtype[ln];
-            multivartypes_per_proc[ln][mpi_rank] = multivartype[ln];
-            cloud_names_per_proc[ln][mpi_rank] = d_cloud_names[ln];
-            block_names_per_proc[ln][mpi_rank] = d_block_names[ln];
-            mb_names_per_proc[ln][mpi_rank] = d_mb_names[ln];
-            ucd_mesh_names_per_proc[ln][mpi_rank] = d_ucd_mesh_names[ln];
+            name_data.insert(name_data.end(), names[k].begin(), names[k].end());
+            name_data.push_back('\0');
         }
+    };
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        meshtype[ln].resize(d_nblocks[ln], DB_QUAD_CURV);
+        vartype[ln].resize(d_nblocks[ln], DB_QUADVAR);
+        multimeshtype[ln].resize(d_nmbs[ln]);
+        multivartype[ln].resize(d_nmbs[ln]);
 
-        // Get the values for the non-root processes.
-        int one = 1;
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            // Skip the root process; we already have those values.
-            if (proc == SILO_MPI_ROOT)
-            {
-                proc += 1;
-                if (proc >= mpi_nodes) break;
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nclouds[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nclouds_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nclouds[ln] > 0)
-            {
-                int num_bytes;
-                for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-                {
-                    num_bytes = static_cast<int>((d_cloud_names[ln][cloud].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_cloud_names[ln][cloud].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nclouds_per_proc[ln][proc] > 0)
-            {
-                cloud_names_per_proc[ln][proc].resize(nclouds_per_proc[ln][proc]);
+        int_data.push_back(d_nclouds[ln]);
+        pack_names(d_cloud_names[ln], d_nclouds[ln]);
 
-                int num_bytes;
-                char* name;
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    cloud_names_per_proc[ln][proc][cloud].assign(name);
-                    delete[] name;
-                }
-            }
+        int_data.push_back(d_nblocks[ln]);
+        int_data.insert(int_data.end(), meshtype[ln].begin(), meshtype[ln].end());
+        int_data.insert(int_data.end(), vartype[ln].begin(), vartype[ln].end());
+        pack_names(d_block_names[ln], d_nblocks[ln]);
 
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nblocks[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nblocks_per_proc[ln][proc], one, proc, false);
-            }
+        int_data.push_back(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            multimeshtype[ln][mb].resize(d_mb_nblocks[ln][mb], DB_QUAD_CURV);
+            multivartype[ln][mb].resize(d_mb_nblocks[ln][mb], DB_QUADVAR);
+            int_data.push_back(d_mb_nblocks[ln][mb]);
+            int_data.insert(int_data.end(), multimeshtype[ln][mb].begin(), multimeshtype[ln][mb].end());
+            int_data.insert(int_data.end(), multivartype[ln][mb].begin(), multivartype[ln][mb].end());
+        }
+        pack_names(d_mb_names[ln], d_nmbs[ln]);
 
-            if (mpi_rank == proc && d_nblocks[ln] > 0)
-            {
-                SAMRAI_MPI::send(&meshtype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-                SAMRAI_MPI::send(&vartype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
+        int_data.push_back(d_nucd_meshes[ln]);
+        pack_names(d_ucd_mesh_names[ln], d_nucd_meshes[ln]);
+    }
 
-                int num_bytes;
-                for (int block = 0; block < d_nblocks[ln]; ++block)
-                {
-                    num_bytes = static_cast<int>((d_block_names[ln][block].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_block_names[ln][block].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nblocks_per_proc[ln][proc] > 0)
-            {
-                meshtypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                vartypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                block_names_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
+    int local_sizes[2] = { static_cast<int>(int_data.size()), static_cast<int>(name_data.size()) };
+    std::vector<int> sizes(mpi_rank == SILO_MPI_ROOT ? 2 * mpi_nodes : 0);
+    MPI_Gather(local_sizes, 2, MPI_INT, sizes.data(), 2, MPI_INT, SILO_MPI_ROOT, SAMRAI_MPI::commWorld);
+    std::vector<int> int_counts, int_displs, name_counts, name_displs;
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        int_counts.resize(mpi_nodes);
+        int_displs.resize(mpi_nodes + 1, 0);
+        name_counts.resize(mpi_nodes);
+        name_displs.resize(mpi_nodes + 1, 0);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            int_counts[proc] = sizes[2 * proc];
+            int_displs[proc + 1] = int_displs[proc] + int_counts[proc];
+            name_counts[proc] = sizes[2 * proc + 1];
+            name_displs[proc + 1] = name_displs[proc] + name_counts[proc];
+        }
+    }
+    std::vector<int> all_int_data(mpi_rank == SILO_MPI_ROOT ? int_displs[mpi_nodes] : 0);
+    std::vector<char> all_name_data(mpi_rank == SILO_MPI_ROOT ? name_displs[mpi_nodes] : 0);
+    MPI_Gatherv(int_data.data(),
+                local_sizes[0],
+                MPI_INT,
+                all_int_data.data(),
+                int_counts.data(),
+                int_displs.data(),
+                MPI_INT,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    MPI_Gatherv(name_data.data(),
+                local_sizes[1],
+                MPI_CHAR,
+                all_name_data.data(),
+                name_counts.data(),
+                name_displs.data(),
+                MPI_CHAR,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+
+    // Unpack the gathered data on the root MPI process.
+    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
+        ucd_mesh_names_per_proc;
 
-                SAMRAI_MPI::recv(&meshtypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-                SAMRAI_MPI::recv(&vartypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        nclouds_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nblocks_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nmbs_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nucd_meshes_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        meshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        vartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        mb_nblocks_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        multimeshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        multivartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        cloud_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        block_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        mb_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        ucd_mesh_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
 
-                int num_bytes;
-                char* name;
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            const int* int_ptr = all_int_data.data() + int_displs[proc];
+            const char* name_ptr = all_name_data.data() + name_displs[proc];
+            auto unpack_ints = [&int_ptr](std::vector<int>& vals, const int num_vals) {
+                vals.assign(int_ptr, int_ptr + num_vals);
+                int_ptr += num_vals;
+            };
+            auto unpack_names = [&name_ptr](std::vector<std::string>& names, const int num_names) {
+                names.resize(num_names);
+                for (int k = 0; k < num_names; ++k)
                 {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    block_names_per_proc[ln][proc][block].assign(name);
-                    delete[] name;
+                    names[k].assign(name_ptr);
+                    name_ptr += names[k].size() + 1;
                 }
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nmbs[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
+            };
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
-                SAMRAI_MPI::recv(&nmbs_per_proc[ln][proc], one, proc, false);
-            }
+                nclouds_per_proc[ln][proc] = *int_ptr++;
+                unpack_names(cloud_names_per_proc[ln][proc], nclouds_per_proc[ln][proc]);
 
-            if (mpi_rank == proc && d_nmbs[ln] > 0)
-            {
-                SAMRAI_MPI::send(&d_mb_nblocks[ln][0], d_nmbs[ln], SILO_MPI_ROOT, false);
+                nblocks_per_proc[ln][proc] = *int_ptr++;
+                unpack_ints(meshtypes_per_proc[ln][proc], nblocks_per_proc[ln][proc]);
+                unpack_ints(vartypes_per_proc[ln][proc], nblocks_per_proc[ln][proc]);
+                unpack_names(block_names_per_proc[ln][proc], nblocks_per_proc[ln][proc]);
 
-                int num_bytes;
-                for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-                {
-                    SAMRAI_MPI::send(&multimeshtype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::send(&multivartype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-
-                    num_bytes = static_cast<int>(d_mb_names[ln][mb].size()) + 1;
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-
-                    const void* mb_name_ptr = d_mb_names[ln][mb].c_str();
-                    MPI_Send(const_cast<void*>(mb_name_ptr),
-                             num_bytes,
-                             MPI_CHAR,
-                             SILO_MPI_ROOT,
-                             SILO_MPI_TAG,
-                             SAMRAI_MPI::commWorld);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateOutgoingStatistics(tree, num_bytes * sizeof(char));
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nmbs_per_proc[ln][proc] > 0)
-            {
+                nmbs_per_proc[ln][proc] = *int_ptr++;
                 mb_nblocks_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
                 multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
                 multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                mb_names_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-
-                SAMRAI_MPI::recv(&mb_nblocks_per_proc[ln][proc][0], nmbs_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                char* name;
                 for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    multimeshtypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-                    multivartypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-
-                    SAMRAI_MPI::recv(
-                        &multimeshtypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-                    SAMRAI_MPI::recv(
-                        &multivartypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes];
-
-                    MPI_Status status;
-                    MPI_Recv(name, num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, SAMRAI_MPI::commWorld, &status);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateIncomingStatistics(tree, num_bytes * sizeof(char));
-
-                    mb_names_per_proc[ln][proc][mb].assign(name);
-                    delete[] name;
+                    const int nblocks = *int_ptr++;
+                    mb_nblocks_per_proc[ln][proc][mb] = nblocks;
+                    unpack_ints(multimeshtypes_per_proc[ln][proc][mb], nblocks);
+                    unpack_ints(multivartypes_per_proc[ln][proc][mb], nblocks);
                 }
-            }
+                unpack_names(mb_names_per_proc[ln][proc], nmbs_per_proc[ln][proc]);
 
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nucd_meshes[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nucd_meshes_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nucd_meshes[ln] > 0)
-            {
-                int num_bytes;
-                for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-                {
-                    num_bytes = static_cast<int>((d_ucd_mesh_names[ln][mesh].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_ucd_mesh_names[ln][mesh].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nucd_meshes_per_proc[ln][proc] > 0)
-            {
-                ucd_mesh_names_per_proc[ln][proc].resize(nucd_meshes_per_proc[ln][proc]);
-                int num_bytes;
-                char* name;
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    ucd_mesh_names_per_proc[ln][proc][mesh].assign(name);
-                    delete[] name;
-                }
+                nucd_meshes_per_proc[ln][proc] = *int_ptr++;
+                unpack_names(ucd_mesh_names_per_proc[ln][proc], nucd_meshes_per_proc[ln][proc]);
             }
-
-            SAMRAI_MPI::barrier();
         }
     }
 
@@ -1819,16 +1851,12 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
         for (int proc = 0; proc < mpi_nodes; ++proc)
         {
+            const std::string block_path = get_processor_block_path(proc, group_size);
             for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
                 for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud) + "/mesh";
+                    std::string meshname = block_path + "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud) + "/mesh";
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_POINTMESH;
 
@@ -1847,12 +1875,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_block_" + std::to_string(block) + "/mesh";
+                    std::string meshname = block_path + "level_" + std::to_string(ln) + "_block_" + std::to_string(block) + "/mesh";
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = meshtypes_per_proc[ln][proc][block];
 
@@ -1871,17 +1894,12 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                     const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                     auto meshnames = new char*[nblocks];
 
                     for (int block = 0; block < nblocks; ++block)
                     {
-                        meshnames[block] = strdup((current_file_name + ":level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh").c_str());
+                        meshnames[block] = strdup((block_path + "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh").c_str());
                     }
 
                     std::string& mb_name = mb_names_per_proc[ln][proc][mb];
@@ -1910,12 +1928,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
+                    std::string meshname = block_path + "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_UCDMESH;
 
@@ -1936,12 +1949,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 {
                     for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud) + "/" + d_var_names[ln][v];
+                        std::string varname = block_path + "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_POINTVAR;
 
@@ -1954,12 +1962,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_block_" + std::to_string(block) + "/" + d_var_names[ln][v];
+                        std::string varname = block_path + "level_" + std::to_string(ln) + "_block_" + std::to_string(block) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = vartypes_per_proc[ln][proc][block];
 
@@ -1972,17 +1975,12 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                         const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                         auto varnames = new char*[nblocks];
 
                         for (int block = 0; block < nblocks; ++block)
                         {
-                            varnames[block] = strdup((current_file_name + ":level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block) + d_var_names[ln][v]).c_str());
+                            varnames[block] = strdup((block_path + "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block) + "/" + d_var_names[ln][v]).c_str());
                         }
 
                         std::string& mb_name = mb_names_per_proc[ln][proc][mb];
@@ -2005,12 +2003,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/" + d_var_names[ln][v];
+                        std::string varname = block_path + "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_UCDVAR;
 
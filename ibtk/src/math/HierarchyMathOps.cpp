@@ -2685,6 +2685,121 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     return;
 } // vc_laplace
 
+void
+HierarchyMathOps::stokes(const int dst1_idx,
+                         const Pointer<SideVariable<NDIM, double> > /*dst1_var*/,
+                         const int dst2_idx,
+                         const Pointer<CellVariable<NDIM, double> > /*dst2_var*/,
+                         const PoissonSpecifications& poisson_spec,
+                         const int src1_idx,
+                         const Pointer<SideVariable<NDIM, double> > src1_var,
+                         const int src2_idx,
+                         const Pointer<CellVariable<NDIM, double> > /*src2_var*/,
+                         const Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                         const double src_ghost_fill_time,
+                         const double gamma,
+                         const int src3_idx,
+                         const Pointer<SideVariable<NDIM, double> > /*src3_var*/)
+{
+    if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
+
+    if (!poisson_spec.dIsConstant() || !(poisson_spec.cIsConstant() || poisson_spec.cIsZero()))
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  fused Stokes operator requires spatially constant scalar-valued "
+                      "diffusivity and damping factor"
+                   << std::endl);
+    }
+    const double alpha = poisson_spec.getDConstant();
+    const double beta = poisson_spec.cIsConstant() ? poisson_spec.getCConstant() : 0.0;
+
+    if (!src1_var->fineBoundaryRepresentsVariable())
+    {
+        TBOX_WARNING("HierarchyMathOps::stokes():\n"
+                     << "  recommended usage for side-centered Stokes operator is\n"
+                     << "  src1_var->fineBoundaryRepresentsVariable() == true"
+                     << std::endl);
+    }
+
+    // Compute dst1 and dst2 independently on each level.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+            Pointer<SideData<NDIM, double> > dst1_data = patch->getPatchData(dst1_idx);
+            Pointer<CellData<NDIM, double> > dst2_data = patch->getPatchData(dst2_idx);
+            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
+            Pointer<CellData<NDIM, double> > src2_data = patch->getPatchData(src2_idx);
+            Pointer<SideData<NDIM, double> > src3_data =
+                (src3_idx >= 0) ? patch->getPatchData(src3_idx) : Pointer<PatchData<NDIM> >();
+
+            d_patch_math_ops.stokes(dst1_data, dst2_data, alpha, beta, src1_data, src2_data, gamma, src3_data, patch);
+        }
+    }
+
+    // Allocate temporary data.
+    for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_os_idx);
+    }
+
+    // Synchronize dst1 along the coarse-fine interface.
+    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+            Pointer<SideData<NDIM, double> > dst1_data = patch->getPatchData(dst1_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*dst1_data);
+        }
+        xeqScheduleOutersideRestriction(dst1_idx, d_os_idx, ln - 1);
+    }
+
+    // Synchronize src1 along the coarse-fine interface and recompute dst2 on
+    // the next coarser level.  The Laplacian must use the unsynchronized values
+    // of src1, so this cannot be folded into the fused sweep.  Only levels that
+    // are overlaid by finer levels are swept a second time.
+    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*src1_data);
+        }
+        xeqScheduleOutersideRestriction(src1_idx, d_os_idx, ln - 1);
+
+        Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(ln - 1);
+        for (PatchLevel<NDIM>::Iterator p(coarser_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = coarser_level->getPatch(p());
+
+            Pointer<CellData<NDIM, double> > dst2_data = patch->getPatchData(dst2_idx);
+            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
+
+            d_patch_math_ops.div(dst2_data, -1.0, src1_data, 0.0, Pointer<CellData<NDIM, double> >(), patch);
+        }
+    }
+
+    // Deallocate temporary data.
+    for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(d_os_idx);
+    }
+    return;
+} // stokes
+
 void
 HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const Pointer<CellVariable<NDIM, double> > /*dst_var*/,
@@ -1445,6 +1445,168 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The strides of a patch data array and the offset of its lower corner, so
+// that the value at index (i0,i1,i2) is stored at i0 + i1*stride[1] +
+// i2*stride[2] - shift.
+struct ArrayLayout
+{
+    std::array<int, NDIM> stride;
+    int shift;
+
+    inline int operator()(const int i0,
+                          const int i1
+#if (NDIM == 3)
+                          ,
+                          const int i2
+#endif
+                          ) const
+    {
+        return i0 + i1 * stride[1]
+#if (NDIM == 3)
+               + i2 * stride[2]
+#endif
+               - shift;
+    }
+};
+
+inline ArrayLayout
+make_array_layout(const Box<NDIM>& box, const int ghosts)
+{
+    ArrayLayout layout;
+    int stride = 1;
+    layout.shift = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        layout.stride[d] = stride;
+        layout.shift += (box.lower(d) - ghosts) * stride;
+        stride *= box.upper(d) - box.lower(d) + 1 + 2 * ghosts;
+    }
+    return layout;
+} // make_array_layout
+
+// The data accessed by the fused Stokes kernel.
+struct StokesKernelData
+{
+    std::array<double*, NDIM> F;
+    std::array<const double*, NDIM> U, V;
+    std::array<ArrayLayout, NDIM> F_layout, U_layout, V_layout;
+    double* D;
+    const double* P;
+    ArrayLayout D_layout, P_layout;
+    std::array<double, NDIM> lap_fac, grad_fac, div_fac;
+    double diag_fac, gamma;
+};
+
+// Computes F_d = alpha L U_d + beta U_d + grad_d P + gamma V_d at the side
+// with linear indices f, u, v (into F_d, U_d, V_d) and p (the cell on the
+// upper side of the face, into P).
+template <bool use_laplacian, bool use_src3>
+inline void
+stokes_side(const StokesKernelData& k, const unsigned int d, const int f, const int u, const int v, const int p)
+{
+    double val = k.grad_fac[d] * (k.P[p] - k.P[p - k.P_layout.stride[d]]);
+    if (use_laplacian)
+    {
+        const double* const U = k.U[d];
+        double lap = k.diag_fac * U[u];
+        for (unsigned int dd = 0; dd < NDIM; ++dd)
+        {
+            const int s = k.U_layout[d].stride[dd];
+            lap += k.lap_fac[dd] * (U[u - s] + U[u + s]);
+        }
+        val += lap;
+    }
+    if (use_src3) val += k.gamma * k.V[d][v];
+    k.F[d][f] = val;
+    return;
+} // stokes_side
+
+#if (NDIM == 2)
+#define STOKES_SIDE(d, i0, i1)                                                                                         \
+    stokes_side<use_laplacian, use_src3>(                                                                              \
+        k, d, k.F_layout[d](i0, i1), k.U_layout[d](i0, i1), use_src3 ? k.V_layout[d](i0, i1) : 0, k.P_layout(i0, i1))
+#endif
+#if (NDIM == 3)
+#define STOKES_SIDE(d, i0, i1, i2)                                                                                     \
+    stokes_side<use_laplacian, use_src3>(k,                                                                            \
+                                         d,                                                                            \
+                                         k.F_layout[d](i0, i1, i2),                                                    \
+                                         k.U_layout[d](i0, i1, i2),                                                    \
+                                         use_src3 ? k.V_layout[d](i0, i1, i2) : 0,                                     \
+                                         k.P_layout(i0, i1, i2))
+#endif
+
+// Computes the action of the Stokes operator on a patch in a single sweep over
+// the cells of the patch.  Each cell updates the divergence in that cell and
+// the lower side of the cell in each direction; the remaining sides along the
+// upper boundary of the patch are updated separately.
+template <bool use_laplacian, bool use_src3>
+void
+stokes_kernel(const StokesKernelData& k, const Box<NDIM>& patch_box)
+{
+    const int ilower0 = patch_box.lower(0), iupper0 = patch_box.upper(0);
+    const int ilower1 = patch_box.lower(1), iupper1 = patch_box.upper(1);
+#if (NDIM == 2)
+    for (int i1 = ilower1; i1 <= iupper1; ++i1)
+    {
+        const int u0 = k.U_layout[0](0, i1), u1 = k.U_layout[1](0, i1);
+        const int u1_up = u1 + k.U_layout[1].stride[1];
+        const int dp = k.D_layout(0, i1);
+        for (int i0 = ilower0; i0 <= iupper0; ++i0)
+        {
+            k.D[dp + i0] = k.div_fac[0] * (k.U[0][u0 + i0 + 1] - k.U[0][u0 + i0]) +
+                          k.div_fac[1] * (k.U[1][u1_up + i0] - k.U[1][u1 + i0]);
+            STOKES_SIDE(0, i0, i1);
+            STOKES_SIDE(1, i0, i1);
+        }
+        STOKES_SIDE(0, iupper0 + 1, i1);
+    }
+    for (int i0 = ilower0; i0 <= iupper0; ++i0)
+    {
+        STOKES_SIDE(1, i0, iupper1 + 1);
+    }
+#endif
+#if (NDIM == 3)
+    const int ilower2 = patch_box.lower(2), iupper2 = patch_box.upper(2);
+    for (int i2 = ilower2; i2 <= iupper2; ++i2)
+    {
+        for (int i1 = ilower1; i1 <= iupper1; ++i1)
+        {
+            const int u0 = k.U_layout[0](0, i1, i2), u1 = k.U_layout[1](0, i1, i2), u2 = k.U_layout[2](0, i1, i2);
+            const int u1_up = u1 + k.U_layout[1].stride[1], u2_up = u2 + k.U_layout[2].stride[2];
+            const int dp = k.D_layout(0, i1, i2);
+            for (int i0 = ilower0; i0 <= iupper0; ++i0)
+            {
+                k.D[dp + i0] = k.div_fac[0] * (k.U[0][u0 + i0 + 1] - k.U[0][u0 + i0]) +
+                              k.div_fac[1] * (k.U[1][u1_up + i0] - k.U[1][u1 + i0]) +
+                              k.div_fac[2] * (k.U[2][u2_up + i0] - k.U[2][u2 + i0]);
+                STOKES_SIDE(0, i0, i1, i2);
+                STOKES_SIDE(1, i0, i1, i2);
+                STOKES_SIDE(2, i0, i1, i2);
+            }
+            STOKES_SIDE(0, iupper0 + 1, i1, i2);
+        }
+        for (int i0 = ilower0; i0 <= iupper0; ++i0)
+        {
+            STOKES_SIDE(1, i0, iupper1 + 1, i2);
+        }
+    }
+    for (int i1 = ilower1; i1 <= iupper1; ++i1)
+    {
+        for (int i0 = ilower0; i0 <= iupper0; ++i0)
+        {
+            STOKES_SIDE(2, i0, i1, iupper2 + 1);
+        }
+    }
+#endif
+    return;
+} // stokes_kernel
+
+#undef STOKES_SIDE
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 void
@@ -6272,6 +6434,116 @@ PatchMathOps::vc_laplace(Pointer<SideData<NDIM, double> > dst,
     return;
 } // vc_laplace
 
+void
+PatchMathOps::stokes(Pointer<SideData<NDIM, double> > dst1,
+                     Pointer<CellData<NDIM, double> > dst2,
+                     const double alpha,
+                     const double beta,
+                     const Pointer<SideData<NDIM, double> > src1,
+                     const Pointer<CellData<NDIM, double> > src2,
+                     const double gamma,
+                     const Pointer<SideData<NDIM, double> > src3,
+                     const Pointer<Patch<NDIM> > patch) const
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    const Box<NDIM>& patch_box = patch->getBox();
+
+    const int F_ghosts = (dst1->getGhostCellWidth()).max();
+    const int D_ghosts = (dst2->getGhostCellWidth()).max();
+    const int U_ghosts = (src1->getGhostCellWidth()).max();
+    const int P_ghosts = (src2->getGhostCellWidth()).max();
+    const bool use_laplacian = (alpha != 0.0 || beta != 0.0);
+    const bool use_src3 = (src3 && gamma != 0.0);
+    const int V_ghosts = use_src3 ? (src3->getGhostCellWidth()).max() : 0;
+
+#if !defined(NDEBUG)
+    if (F_ghosts != (dst1->getGhostCellWidth()).min() || D_ghosts != (dst2->getGhostCellWidth()).min() ||
+        U_ghosts != (src1->getGhostCellWidth()).min() || P_ghosts != (src2->getGhostCellWidth()).min() ||
+        (use_src3 && V_ghosts != (src3->getGhostCellWidth()).min()))
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  patch data do not have uniform ghost cell widths"
+                   << std::endl);
+    }
+
+    if ((use_laplacian && U_ghosts < 1) || P_ghosts < 1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src1 or src2 has insufficient ghost cell width"
+                   << std::endl);
+    }
+
+    if (src1 == dst1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src1 == dst1."
+                   << std::endl);
+    }
+
+    if (patch_box != dst1->getBox() || patch_box != dst2->getBox() || patch_box != src1->getBox() ||
+        patch_box != src2->getBox() || (use_src3 && patch_box != src3->getBox()))
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  dst1, dst2, src1, src2, and src3 must all live on the same patch"
+                   << std::endl);
+    }
+
+    if (dst1->getDepth() != 1 || dst2->getDepth() != 1 || src1->getDepth() != 1 || src2->getDepth() != 1 ||
+        (use_src3 && src3->getDepth() != 1))
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  patch data must be scalar-valued"
+                   << std::endl);
+    }
+#endif
+
+    StokesKernelData k;
+    double lap_fac_sum = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, d);
+        k.F[d] = dst1->getPointer(d);
+        k.F_layout[d] = make_array_layout(side_box, F_ghosts);
+        k.U[d] = src1->getPointer(d);
+        k.U_layout[d] = make_array_layout(side_box, U_ghosts);
+        if (use_src3)
+        {
+            k.V[d] = src3->getPointer(d);
+            k.V_layout[d] = make_array_layout(side_box, V_ghosts);
+        }
+        k.lap_fac[d] = alpha / (dx[d] * dx[d]);
+        k.grad_fac[d] = 1.0 / dx[d];
+        k.div_fac[d] = -1.0 / dx[d];
+        lap_fac_sum += k.lap_fac[d];
+    }
+    k.D = dst2->getPointer();
+    k.D_layout = make_array_layout(patch_box, D_ghosts);
+    k.P = src2->getPointer();
+    k.P_layout = make_array_layout(patch_box, P_ghosts);
+    k.diag_fac = beta - 2.0 * lap_fac_sum;
+    k.gamma = gamma;
+
+    if (use_laplacian && use_src3)
+    {
+        stokes_kernel<true, true>(k, patch_box);
+    }
+    else if (use_laplacian)
+    {
+        stokes_kernel<true, false>(k, patch_box);
+    }
+    else if (use_src3)
+    {
+        stokes_kernel<false, true>(k, patch_box);
+    }
+    else
+    {
+        stokes_kernel<false, false>(k, patch_box);
+    }
+    return;
+} // stokes
+
 void
 PatchMathOps::pointwiseMultiply(Pointer<CellData<NDIM, double> > dst,
                                 const double alpha,
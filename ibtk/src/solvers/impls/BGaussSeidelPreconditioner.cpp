@@ -198,12 +198,10 @@ BGaussSeidelPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRA
         }
     }
 
-    // Clone the right-hand-side vector to avoid modifying it during the
+    // Copy the right-hand-side vector to avoid modifying it during the
     // preconditioning operation.
-    Pointer<SAMRAIVectorReal<NDIM, double> > f = b.cloneVector(b.getName());
-    f->allocateVectorData();
-    f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&b, false), false);
-    std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > f_comps = getComponentVectors(f);
+    d_f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&b, false), false);
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > f_comps = getComponentVectors(d_f);
 
     // Apply the component preconditioners.
     int count = 0;
@@ -236,10 +234,6 @@ BGaussSeidelPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRA
         ret_val = ret_val && ret_val_comp;
     }
 
-    // Free the copied right-hand-side vector data.
-    f->deallocateVectorData();
-    f->freeVectorComponents();
-
     // Deallocate the preconditioner, when necessary.
     if (deallocate_after_solve) deallocateSolverState();
     return ret_val;
@@ -278,6 +272,10 @@ BGaussSeidelPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, d
         d_pc_map[comp]->initializeSolverState(*x_comps[comp], *b_comps[comp]);
     }
 
+    // Setup the scratch copy of the right-hand-side vector.
+    d_f = b.cloneVector(b.getName());
+    d_f->allocateVectorData();
+
     // Indicate that the preconditioner is initialized.
     d_is_initialized = true;
     return;
@@ -288,6 +286,10 @@ BGaussSeidelPreconditioner::deallocateSolverState()
 {
     if (!d_is_initialized) return;
 
+    // Free the scratch copy of the right-hand-side vector.
+    d_f->freeVectorComponents();
+    d_f.setNull();
+
     // Deallocate the component preconditioners.
     for (const auto& linearSolver_pair : d_pc_map)
     {
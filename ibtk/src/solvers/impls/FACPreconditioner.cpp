@@ -142,8 +142,6 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
         TBOX_ASSERT(d_f);
         TBOX_ASSERT(d_r);
 #endif
-        d_f->allocateVectorData();
-        d_r->allocateVectorData();
         d_f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
         d_r->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
         switch (d_cycle_type)
@@ -167,8 +165,6 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
                                      << "."
                                      << std::endl);
         }
-        d_f->deallocateVectorData();
-        d_r->deallocateVectorData();
     }
 
     // Deallocate scratch data.
@@ -201,11 +197,14 @@ FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& s
 #endif
     d_fac_strategy->initializeOperatorState(solution, rhs);
 
-    // Create temporary vectors.
+    // Create temporary vectors.  Their data are allocated here, rather than in
+    // solveSystem(), and are kept until deallocateSolverState().
     if (!(d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0))
     {
         d_f = rhs.cloneVector("");
         d_r = rhs.cloneVector("");
+        d_f->allocateVectorData();
+        d_r->allocateVectorData();
     }
 
     // Indicate the operator is initialized.
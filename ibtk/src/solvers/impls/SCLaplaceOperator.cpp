@@ -153,9 +153,6 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
     }
 #endif
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
-
     // Simultaneously fill ghost cell values for all components.
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
     std::vector<InterpolationTransactionComponent> transaction_comps;
@@ -189,9 +186,6 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
         d_bc_helpers[comp]->copyDataAtDirichletBoundaries(y_idx, x_idx);
     }
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
-
     IBTK_TIMER_STOP(t_apply);
     return;
 } // apply
@@ -209,6 +203,9 @@ SCLaplaceOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>&
     d_x = in.cloneVector(in.getName());
     d_b = out.cloneVector(out.getName());
 
+    // Allocate scratch data.  These data persist until deallocateOperatorState().
+    d_x->allocateVectorData();
+
     // Setup operator state.
     d_hierarchy = in.getPatchHierarchy();
     d_coarsest_ln = in.getCoarsestLevelNumber();
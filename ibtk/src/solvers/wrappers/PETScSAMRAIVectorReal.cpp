@@ -35,10 +35,24 @@
 #include <cmath>
 #include <algorithm>
 #include <ostream>
+#include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
+#include "VariableDatabase.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/NormOps.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
@@ -123,6 +137,243 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// Determine whether the fused multi-vector kernels can be used with the
+// specified vectors, i.e., whether all components are cell- or side-centered
+// and all vectors use the same variables and ghost cell widths.
+inline bool
+supports_fused_ops(const SAMRAIVectorReal<NDIM, PetscScalar>* const x,
+                   const std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*>& y)
+{
+    const int nv = static_cast<int>(y.size());
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = VariableDatabase<NDIM>::getDatabase()->getPatchDescriptor();
+    const int ncomp = x->getNumberOfComponents();
+    for (int k = 0; k < nv; ++k)
+    {
+        const SAMRAIVectorReal<NDIM, PetscScalar>* const y_k = y[k];
+        if (y_k->getNumberOfComponents() != ncomp ||
+            y_k->getPatchHierarchy().getPointer() != x->getPatchHierarchy().getPointer() ||
+            y_k->getCoarsestLevelNumber() != x->getCoarsestLevelNumber() ||
+            y_k->getFinestLevelNumber() != x->getFinestLevelNumber())
+        {
+            return false;
+        }
+    }
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const Pointer<Variable<NDIM> >& comp_var = x->getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = comp_var;
+        Pointer<SideVariable<NDIM, double> > comp_sc_var = comp_var;
+        if (!comp_cc_var && !comp_sc_var) return false;
+        const IntVector<NDIM>& gcw =
+            patch_descriptor->getPatchDataFactory(x->getComponentDescriptorIndex(comp))->getGhostCellWidth();
+        for (int k = 0; k < nv; ++k)
+        {
+            const SAMRAIVectorReal<NDIM, PetscScalar>* const y_k = y[k];
+            if (y_k->getComponentVariable(comp).getPointer() != comp_var.getPointer() ||
+                patch_descriptor->getPatchDataFactory(y_k->getComponentDescriptorIndex(comp))->getGhostCellWidth() !=
+                    gcw)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+} // supports_fused_ops
+
+// Compute the offset of the specified index in the specified array data box.
+inline int
+array_data_offset(const Box<NDIM>& array_box, const Index<NDIM>& i)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - array_box.lower(d)) * stride;
+        stride *= array_box.numberCells(d);
+    }
+    return offset;
+} // array_data_offset
+
+// Accumulate the (optionally control volume weighted) dot products of x with
+// each of the y[k] over the specified box in a single sweep over the data.
+inline void
+mdot_array_data(const ArrayData<NDIM, double>& x_data,
+                const std::vector<const ArrayData<NDIM, double>*>& y_data,
+                const ArrayData<NDIM, double>* const cvol_data,
+                const Box<NDIM>& box,
+                PetscScalar* const val)
+{
+    if (box.empty()) return;
+    const int nv = static_cast<int>(y_data.size());
+    const int n0 = box.numberCells(0);
+    Box<NDIM> line_box = box;
+    line_box.upper(0) = line_box.lower(0);
+    std::vector<const double*> y_line(nv);
+    for (int depth = 0; depth < x_data.getDepth(); ++depth)
+    {
+        for (Box<NDIM>::Iterator b(line_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            const double* const x_line = x_data.getPointer(depth) + array_data_offset(x_data.getBox(), i);
+            for (int k = 0; k < nv; ++k)
+            {
+                y_line[k] = y_data[k]->getPointer(depth) + array_data_offset(y_data[k]->getBox(), i);
+            }
+            if (cvol_data)
+            {
+                const double* const cvol_line = cvol_data->getPointer() + array_data_offset(cvol_data->getBox(), i);
+                for (int i0 = 0; i0 < n0; ++i0)
+                {
+                    const double x_val = x_line[i0] * cvol_line[i0];
+                    for (int k = 0; k < nv; ++k) val[k] += x_val * y_line[k][i0];
+                }
+            }
+            else
+            {
+                for (int i0 = 0; i0 < n0; ++i0)
+                {
+                    const double x_val = x_line[i0];
+                    for (int k = 0; k < nv; ++k) val[k] += x_val * y_line[k][i0];
+                }
+            }
+        }
+    }
+    return;
+} // mdot_array_data
+
+// Compute the local parts of the dot products of x with each of the y[k] in a
+// single sweep over the patch data of x.
+void
+fused_mdot_local(const SAMRAIVectorReal<NDIM, PetscScalar>* const x,
+                 const std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*>& y,
+                 PetscScalar* const val)
+{
+    const int nv = static_cast<int>(y.size());
+    std::fill(val, val + nv, 0.0);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x->getPatchHierarchy();
+    const int coarsest_ln = x->getCoarsestLevelNumber();
+    const int finest_ln = x->getFinestLevelNumber();
+    const int ncomp = x->getNumberOfComponents();
+    std::vector<int> y_idx(nv);
+    std::vector<const ArrayData<NDIM, double>*> y_data(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const int x_idx = x->getComponentDescriptorIndex(comp);
+        for (int k = 0; k < nv; ++k) y_idx[k] = y[k]->getComponentDescriptorIndex(comp);
+        const int cvol_idx = x->getControlVolumeIndex(comp);
+        const bool has_cvol = cvol_idx >= 0;
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = x->getComponentVariable(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (comp_cc_var)
+                {
+                    Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                    for (int k = 0; k < nv; ++k)
+                    {
+                        Pointer<CellData<NDIM, double> > y_k_data = patch->getPatchData(y_idx[k]);
+                        y_data[k] = &y_k_data->getArrayData();
+                    }
+                    Pointer<CellData<NDIM, double> > cvol_data =
+                        (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(nullptr));
+                    mdot_array_data(x_data->getArrayData(),
+                                    y_data,
+                                    cvol_data ? &cvol_data->getArrayData() : nullptr,
+                                    patch_box,
+                                    val);
+                }
+                else
+                {
+                    Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                    Pointer<SideData<NDIM, double> > cvol_data =
+                        (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(nullptr));
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        for (int k = 0; k < nv; ++k)
+                        {
+                            Pointer<SideData<NDIM, double> > y_k_data = patch->getPatchData(y_idx[k]);
+                            y_data[k] = &y_k_data->getArrayData(axis);
+                        }
+                        mdot_array_data(x_data->getArrayData(axis),
+                                        y_data,
+                                        cvol_data ? &cvol_data->getArrayData(axis) : nullptr,
+                                        SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                        val);
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_mdot_local
+
+// Compute y += sum_k alpha[k] x[k] over the entire patch data (including ghost
+// cells) in a single sweep over the patch data of y.
+void
+fused_maxpy(SAMRAIVectorReal<NDIM, PetscScalar>* const y,
+            const PetscScalar* const alpha,
+            const std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*>& x)
+{
+    const int nv = static_cast<int>(x.size());
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y->getPatchHierarchy();
+    const int coarsest_ln = y->getCoarsestLevelNumber();
+    const int finest_ln = y->getFinestLevelNumber();
+    const int ncomp = y->getNumberOfComponents();
+    std::vector<int> x_idx(nv);
+    std::vector<const double*> x_vals(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const int y_idx = y->getComponentDescriptorIndex(comp);
+        for (int k = 0; k < nv; ++k) x_idx[k] = x[k]->getComponentDescriptorIndex(comp);
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = y->getComponentVariable(comp);
+        const int num_arrays = comp_cc_var ? 1 : NDIM;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                for (int array = 0; array < num_arrays; ++array)
+                {
+                    ArrayData<NDIM, double>* y_data;
+                    if (comp_cc_var)
+                    {
+                        Pointer<CellData<NDIM, double> > y_cc_data = patch->getPatchData(y_idx);
+                        y_data = &y_cc_data->getArrayData();
+                        for (int k = 0; k < nv; ++k)
+                        {
+                            Pointer<CellData<NDIM, double> > x_k_data = patch->getPatchData(x_idx[k]);
+                            x_vals[k] = x_k_data->getPointer();
+                        }
+                    }
+                    else
+                    {
+                        Pointer<SideData<NDIM, double> > y_sc_data = patch->getPatchData(y_idx);
+                        y_data = &y_sc_data->getArrayData(array);
+                        for (int k = 0; k < nv; ++k)
+                        {
+                            Pointer<SideData<NDIM, double> > x_k_data = patch->getPatchData(x_idx[k]);
+                            x_vals[k] = x_k_data->getPointer(array);
+                        }
+                    }
+                    double* const y_vals = y_data->getPointer();
+                    const int num_vals = y_data->getDepth() * y_data->getBox().size();
+                    for (int i = 0; i < num_vals; ++i)
+                    {
+                        double y_val = y_vals[i];
+                        for (int k = 0; k < nv; ++k) y_val += alpha[k] * x_vals[k][i];
+                        y_vals[i] = y_val;
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_maxpy
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -326,10 +577,19 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (supports_fused_ops(PSVR_CAST2(x).getPointer(), y_vecs))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        fused_mdot_local(PSVR_CAST2(x).getPointer(), y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
@@ -390,10 +650,19 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (supports_fused_ops(PSVR_CAST2(x).getPointer(), y_vecs))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        fused_mdot_local(PSVR_CAST2(x).getPointer(), y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
@@ -512,6 +781,16 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     IBTK_TIMER_START(t_vec_maxpy);
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> x_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) x_vecs[i] = PSVR_CAST2(x[i]).getPointer();
+    if (supports_fused_ops(PSVR_CAST2(y).getPointer(), x_vecs))
+    {
+        fused_maxpy(PSVR_CAST2(y).getPointer(), alpha, x_vecs);
+        int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+        CHKERRQ(ierr);
+        IBTK_TIMER_STOP(t_vec_maxpy);
+        PetscFunctionReturn(0);
+    }
     static const bool interior_only = false;
     for (PetscInt i = 0; i < nv; ++i)
     {
@@ -743,10 +1022,19 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (supports_fused_ops(PSVR_CAST2(x).getPointer(), y_vecs))
+    {
+        fused_mdot_local(PSVR_CAST2(x).getPointer(), y_vecs, val);
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
@@ -758,10 +1046,19 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (supports_fused_ops(PSVR_CAST2(x).getPointer(), y_vecs))
+    {
+        fused_mdot_local(PSVR_CAST2(x).getPointer(), y_vecs, val);
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
@@ -782,8 +1079,23 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> st_vecs(2);
+    st_vecs[0] = PSVR_CAST2(s).getPointer();
+    st_vecs[1] = PSVR_CAST2(t).getPointer();
+    PetscScalar vals[2];
+    if (supports_fused_ops(PSVR_CAST2(t).getPointer(), st_vecs))
+    {
+        fused_mdot_local(PSVR_CAST2(t).getPointer(), st_vecs, vals);
+    }
+    else
+    {
+        static const bool local_only = true;
+        vals[0] = PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only);
+        vals[1] = PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only);
+    }
+    SAMRAI_MPI::sumReduction(vals, 2);
+    *dp = vals[0];
+    *nm = vals[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
@@ -222,7 +222,9 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         {
             int visit_number_procs_per_file = 1;
             if (main_db->keyExists("visit_number_procs_per_file"))
+            {
                 visit_number_procs_per_file = main_db->getInteger("visit_number_procs_per_file");
+            }
             d_visit_data_writer =
                 new VisItDataWriter<NDIM>("VisItDataWriter", d_viz_dump_dirname, visit_number_procs_per_file);
         }
@@ -230,6 +232,14 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         if (viz_writer == "Silo")
         {
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            if (main_db->keyExists("silo_number_files"))
+            {
+                d_silo_data_writer->setNumberOfFiles(main_db->getInteger("silo_number_files"));
+            }
+            if (main_db->keyExists("silo_use_double_precision"))
+            {
+                d_silo_data_writer->setUseDoublePrecision(main_db->getBool("silo_use_double_precision"));
+            }
         }
 
         if (viz_writer == "ExodusII")
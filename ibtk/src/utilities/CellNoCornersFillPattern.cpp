@@ -234,6 +234,24 @@ CellNoCornersFillPattern::getPatternName() const
     return PATTERN_NAME;
 } // getPatternName
 
+bool
+CellNoCornersFillPattern::getIncludeDstPatchBox() const
+{
+    return d_include_dst_patch_box;
+} // getIncludeDstPatchBox
+
+bool
+CellNoCornersFillPattern::getIncludeEdgesOnDstLevel() const
+{
+    return d_include_edges_on_dst_level;
+} // getIncludeEdgesOnDstLevel
+
+bool
+CellNoCornersFillPattern::getIncludeEdgesOnSrcLevel() const
+{
+    return d_include_edges_on_src_level;
+} // getIncludeEdgesOnSrcLevel
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -129,6 +129,12 @@ EdgeSynchCopyFillPattern::getPatternName() const
     return PATTERN_NAME;
 } // getPatternName
 
+unsigned int
+EdgeSynchCopyFillPattern::getAxis() const
+{
+    return d_axis;
+} // getAxis
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
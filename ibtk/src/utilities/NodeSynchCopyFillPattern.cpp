@@ -125,6 +125,12 @@ NodeSynchCopyFillPattern::getPatternName() const
     return PATTERN_NAME;
 } // getPatternName
 
+unsigned int
+NodeSynchCopyFillPattern::getAxis() const
+{
+    return d_axis;
+} // getAxis
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -32,17 +32,22 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <utility>
 #include <vector>
 
 #include "IntVector.h"
 #include "ibtk/FixedSizedStream.h"
+#include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/ParallelMap.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableManager.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "petscsys.h"
 #include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
@@ -54,12 +59,27 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The MPI tag number used for point-to-point communication.  The value is
+// distinct from the tags used by other point-to-point communication in IBTK,
+// so that messages sent by ParallelMap are never matched by other receives.
+static const int PARALLEL_MAP_MPI_TAG = 1000;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+ParallelMap::ParallelMap(const DistributionType distribution_type) : d_distribution_type(distribution_type)
+{
+    // intentionally blank
+    return;
+} // ParallelMap
+
 ParallelMap& ParallelMap::operator=(const ParallelMap& that)
 {
     if (this != &that)
     {
+        d_distribution_type = that.d_distribution_type;
         d_map = that.d_map;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -83,23 +103,67 @@ ParallelMap::removeItem(const int key)
 
 void
 ParallelMap::communicateData()
+{
+    switch (d_distribution_type)
+    {
+    case REPLICATED:
+        communicateReplicatedData();
+        break;
+    case OWNER_PARTITIONED:
+        communicatePartitionedData();
+        break;
+    default:
+        TBOX_ERROR("ParallelMap::communicateData():\n"
+                   << "  unsupported distribution type: "
+                   << d_distribution_type
+                   << "\n");
+    }
+    return;
+} // communicateData
+
+const std::map<int, SAMRAI::tbox::Pointer<Streamable> >&
+ParallelMap::getMap() const
+{
+    return d_map;
+} // getMap
+
+int
+ParallelMap::getOwnerRank(const int key)
+{
+    const int size = SAMRAI_MPI::getNodes();
+    return (key % size + size) % size;
+} // getOwnerRank
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+ParallelMap::communicateReplicatedData()
 {
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    int ierr;
+
+    // Determine the number of additions and removals registered on each
+    // process.
+    int num_local_updates[2] = { static_cast<int>(d_pending_additions.size()),
+                                 static_cast<int>(d_pending_removals.size()) };
+    std::vector<int> num_updates(2 * size);
+    ierr = MPI_Allgather(num_local_updates, 2, MPI_INT, num_updates.data(), 2, MPI_INT, communicator);
+    TBOX_ASSERT(ierr == 0);
+    int total_num_additions = 0, total_num_removals = 0;
+    for (int proc = 0; proc < size; ++proc)
+    {
+        total_num_additions += num_updates[2 * proc];
+        total_num_removals += num_updates[2 * proc + 1];
+    }
 
     // Add items to the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    if (total_num_additions > 0)
     {
         StreamableManager* streamable_manager = StreamableManager::getManager();
 
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        SAMRAI_MPI::sumReduction(&num_additions[0], size);
-
-        // Get the local values to send and determine the amount of data to be
-        // broadcast by each process.
+        // Pack the local values to send.
         std::vector<int> keys_to_send;
         std::vector<tbox::Pointer<Streamable> > data_items_to_send;
         for (const auto& pending_addition : d_pending_additions)
@@ -107,28 +171,46 @@ ParallelMap::communicateData()
             keys_to_send.push_back(pending_addition.first);
             data_items_to_send.push_back(pending_addition.second);
         }
-        std::vector<int> data_sz(size, 0);
-        data_sz[rank] = static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
-                                         streamable_manager->getDataStreamSize(data_items_to_send));
-        SAMRAI_MPI::sumReduction(&data_sz[0], size);
+        int data_size = 0;
+        std::unique_ptr<FixedSizedStream> stream;
+        if (!keys_to_send.empty())
+        {
+            stream.reset(new FixedSizedStream(
+                static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
+                                 streamable_manager->getDataStreamSize(data_items_to_send))));
+            stream->pack(&keys_to_send[0], static_cast<int>(keys_to_send.size()));
+            streamable_manager->packStream(*stream, data_items_to_send);
+            data_size = stream->getCurrentSize();
+        }
+
+        // Gather the data from all processes.
+        std::vector<int> data_sz(size), data_offset(size + 1, 0);
+        ierr = MPI_Allgather(&data_size, 1, MPI_INT, data_sz.data(), 1, MPI_INT, communicator);
+        TBOX_ASSERT(ierr == 0);
+        for (int proc = 0; proc < size; ++proc)
+        {
+            data_offset[proc + 1] = data_offset[proc] + data_sz[proc];
+        }
+        std::vector<char> buffer(data_offset[size]);
+        ierr = MPI_Allgatherv(stream ? stream->getBufferStart() : nullptr,
+                              data_size,
+                              MPI_CHAR,
+                              buffer.data(),
+                              data_sz.data(),
+                              data_offset.data(),
+                              MPI_CHAR,
+                              communicator);
+        TBOX_ASSERT(ierr == 0);
 
-        // Broadcast data from each process.
+        // Unpack the data in process order, so that an item registered on a
+        // process supersedes any item with the same key registered on a
+        // lower-numbered process.
         for (int sending_proc = 0; sending_proc < size; ++sending_proc)
         {
-            int num_keys = num_additions[sending_proc];
+            const int num_keys = num_updates[2 * sending_proc];
             if (num_keys == 0) continue;
             if (sending_proc == rank)
             {
-                // Pack and broadcast data on process sending_proc.
-                FixedSizedStream stream(data_sz[sending_proc]);
-                stream.pack(&keys_to_send[0], static_cast<int>(keys_to_send.size()));
-                streamable_manager->packStream(stream, data_items_to_send);
-                int data_size = stream.getCurrentSize();
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                SAMRAI_MPI::bcast(static_cast<char*>(stream.getBufferStart()), data_size, sending_proc);
                 for (int k = 0; k < num_keys; ++k)
                 {
                     d_map[keys_to_send[k]] = data_items_to_send[k];
@@ -136,19 +218,12 @@ ParallelMap::communicateData()
             }
             else
             {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<char> buffer(data_sz[sending_proc]);
-                int data_size = data_sz[sending_proc];
-                SAMRAI_MPI::bcast(&buffer[0], data_size, sending_proc);
-#if !defined(NDEBUG)
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                FixedSizedStream stream(&buffer[0], data_size);
+                FixedSizedStream recv_stream(&buffer[data_offset[sending_proc]], data_sz[sending_proc]);
                 std::vector<int> keys_received(num_keys);
-                stream.unpack(&keys_received[0], num_keys);
+                recv_stream.unpack(&keys_received[0], num_keys);
                 std::vector<tbox::Pointer<Streamable> > data_items_received;
                 hier::IntVector<NDIM> offset = 0;
-                streamable_manager->unpackStream(stream, offset, data_items_received);
+                streamable_manager->unpackStream(recv_stream, offset, data_items_received);
 #if !defined(NDEBUG)
                 TBOX_ASSERT(keys_received.size() == data_items_received.size());
 #endif
@@ -164,56 +239,189 @@ ParallelMap::communicateData()
     }
 
     // Remove items from the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    if (total_num_removals > 0)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        SAMRAI_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        std::vector<int> num_removals(size), removal_offset(size + 1, 0);
+        for (int proc = 0; proc < size; ++proc)
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(keys_received[k]);
-                }
-            }
+            num_removals[proc] = num_updates[2 * proc + 1];
+            removal_offset[proc + 1] = removal_offset[proc] + num_removals[proc];
+        }
+        std::vector<int> keys_received(removal_offset[size]);
+        ierr = MPI_Allgatherv(d_pending_removals.data(),
+                              num_removals[rank],
+                              MPI_INT,
+                              keys_received.data(),
+                              num_removals.data(),
+                              removal_offset.data(),
+                              MPI_INT,
+                              communicator);
+        TBOX_ASSERT(ierr == 0);
+        for (const int key : keys_received)
+        {
+            d_map.erase(key);
         }
 
         // Clear the set of pending removals.
         d_pending_removals.clear();
     }
     return;
-} // communicateData
+} // communicateReplicatedData
 
-const std::map<int, SAMRAI::tbox::Pointer<Streamable> >&
-ParallelMap::getMap() const
+void
+ParallelMap::communicatePartitionedData()
 {
-    return d_map;
-} // getMap
+    const int size = SAMRAI_MPI::getNodes();
+    const int rank = SAMRAI_MPI::getRank();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+    int ierr;
 
-/////////////////////////////// PRIVATE //////////////////////////////////////
+    // Sort the pending additions and removals by the ranks of the processes
+    // that own the corresponding keys.
+    std::map<int, std::vector<int> > addition_keys, removal_keys;
+    std::map<int, std::vector<tbox::Pointer<Streamable> > > addition_items;
+    for (const auto& pending_addition : d_pending_additions)
+    {
+        const int owner = getOwnerRank(pending_addition.first);
+        addition_keys[owner].push_back(pending_addition.first);
+        addition_items[owner].push_back(pending_addition.second);
+    }
+    for (const int key : d_pending_removals)
+    {
+        removal_keys[getOwnerRank(key)].push_back(key);
+    }
+    std::vector<PetscMPIInt> dest_ranks;
+    for (int proc = 0; proc < size; ++proc)
+    {
+        if (proc != rank && (addition_keys.count(proc) || removal_keys.count(proc))) dest_ranks.push_back(proc);
+    }
+
+    // Pack one message for each destination process.  Each message consists
+    // of the numbers of additions and removals, the keys and data items to
+    // add, and the keys to remove.
+    std::vector<std::unique_ptr<FixedSizedStream> > send_streams;
+    std::vector<int> send_sizes;
+    for (const int dest : dest_ranks)
+    {
+        std::vector<int>& keys_to_add = addition_keys[dest];
+        std::vector<tbox::Pointer<Streamable> >& items_to_add = addition_items[dest];
+        std::vector<int>& keys_to_remove = removal_keys[dest];
+        int header[2] = { static_cast<int>(keys_to_add.size()), static_cast<int>(keys_to_remove.size()) };
+        send_streams.emplace_back(new FixedSizedStream(
+            static_cast<int>(tbox::AbstractStream::sizeofInt() * (2 + keys_to_add.size() + keys_to_remove.size()) +
+                             streamable_manager->getDataStreamSize(items_to_add))));
+        FixedSizedStream& stream = *send_streams.back();
+        stream.pack(header, 2);
+        if (!keys_to_add.empty()) stream.pack(&keys_to_add[0], header[0]);
+        streamable_manager->packStream(stream, items_to_add);
+        if (!keys_to_remove.empty()) stream.pack(&keys_to_remove[0], header[1]);
+        send_sizes.push_back(stream.getCurrentSize());
+    }
+
+    // Determine which processes will send data to this process, and the
+    // amount of data that each will send, without any all-to-all
+    // communication.
+    PetscMPIInt num_sources;
+    PetscMPIInt* source_ranks;
+    int* recv_sizes;
+    ierr = PetscCommBuildTwoSided(communicator,
+                                  1,
+                                  MPI_INT,
+                                  static_cast<PetscMPIInt>(dest_ranks.size()),
+                                  dest_ranks.data(),
+                                  send_sizes.data(),
+                                  &num_sources,
+                                  &source_ranks,
+                                  &recv_sizes);
+    IBTK_CHKERRQ(ierr);
+
+    // Exchange the messages.
+    std::vector<std::vector<char> > recv_buffers(num_sources);
+    std::vector<MPI_Request> requests;
+    for (int k = 0; k < num_sources; ++k)
+    {
+        recv_buffers[k].resize(recv_sizes[k]);
+        requests.push_back(MPI_REQUEST_NULL);
+        MPI_Irecv(recv_buffers[k].data(),
+                  recv_sizes[k],
+                  MPI_CHAR,
+                  source_ranks[k],
+                  PARALLEL_MAP_MPI_TAG,
+                  communicator,
+                  &requests.back());
+    }
+    for (unsigned int k = 0; k < dest_ranks.size(); ++k)
+    {
+        requests.push_back(MPI_REQUEST_NULL);
+        MPI_Isend(send_streams[k]->getBufferStart(),
+                  send_sizes[k],
+                  MPI_CHAR,
+                  dest_ranks[k],
+                  PARALLEL_MAP_MPI_TAG,
+                  communicator,
+                  &requests.back());
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+
+    // Apply the updates in process order, so that the result is the same as
+    // for a replicated map: all additions are applied before any removals, and
+    // an item registered on a process supersedes any item with the same key
+    // registered on a lower-numbered process.
+    std::map<int, int> source_idx;
+    for (int k = 0; k < num_sources; ++k) source_idx[source_ranks[k]] = k;
+    source_idx[rank] = -1;
+    std::vector<int> keys_received;
+    std::vector<std::vector<int> > removal_keys_received;
+    for (const auto& source : source_idx)
+    {
+        if (source.second < 0)
+        {
+            const std::vector<int>& keys = addition_keys[rank];
+            const std::vector<tbox::Pointer<Streamable> >& items = addition_items[rank];
+            for (unsigned int k = 0; k < keys.size(); ++k)
+            {
+                d_map[keys[k]] = items[k];
+            }
+            removal_keys_received.push_back(removal_keys[rank]);
+            continue;
+        }
+        std::vector<char>& buffer = recv_buffers[source.second];
+        FixedSizedStream stream(buffer.data(), static_cast<int>(buffer.size()));
+        int header[2];
+        stream.unpack(header, 2);
+        keys_received.resize(header[0]);
+        if (header[0] > 0) stream.unpack(&keys_received[0], header[0]);
+        std::vector<tbox::Pointer<Streamable> > data_items_received;
+        hier::IntVector<NDIM> offset = 0;
+        streamable_manager->unpackStream(stream, offset, data_items_received);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(keys_received.size() == data_items_received.size());
+#endif
+        for (int k = 0; k < header[0]; ++k)
+        {
+            d_map[keys_received[k]] = data_items_received[k];
+        }
+        removal_keys_received.push_back(std::vector<int>(header[1]));
+        if (header[1] > 0) stream.unpack(&removal_keys_received.back()[0], header[1]);
+    }
+    for (const auto& keys : removal_keys_received)
+    {
+        for (const int key : keys)
+        {
+            d_map.erase(key);
+        }
+    }
+    ierr = PetscFree(source_ranks);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscFree(recv_sizes);
+    IBTK_CHKERRQ(ierr);
+
+    // Clear the sets of pending additions and removals.
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+    return;
+} // communicatePartitionedData
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
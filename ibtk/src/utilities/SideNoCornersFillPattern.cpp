@@ -241,6 +241,24 @@ SideNoCornersFillPattern::getPatternName() const
     return PATTERN_NAME;
 } // getPatternName
 
+bool
+SideNoCornersFillPattern::getIncludeDstPatchBox() const
+{
+    return d_include_dst_patch_box;
+} // getIncludeDstPatchBox
+
+bool
+SideNoCornersFillPattern::getIncludeEdgesOnDstLevel() const
+{
+    return d_include_edges_on_dst_level;
+} // getIncludeEdgesOnDstLevel
+
+bool
+SideNoCornersFillPattern::getIncludeEdgesOnSrcLevel() const
+{
+    return d_include_edges_on_src_level;
+} // getIncludeEdgesOnSrcLevel
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
@@ -44,17 +45,21 @@
 #include "CellData.h"
 #include "CellIndex.h"
 #include "CellIterator.h"
+#include "EdgeGeometry.h"
 #include "FaceData.h"
+#include "FaceGeometry.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
+#include "NodeGeometry.h"
 #include "NodeIndex.h"
 #include "NodeIterator.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideIndex.h"
 #include "SideIterator.h"
 #include "ibtk/CartGridFunction.h"
@@ -264,17 +269,34 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
         {
             parser.DefineConst(constant.first, constant.second);
         }
+    }
 
-        // Variables.
-        parser.DefineVar("T", &d_parser_time);
-        parser.DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Define the variables and determine whether any of the functions depend
+    // on time.  Time-independent functions do not need to be re-evaluated by
+    // callers when the data time changes.
+    resizeParserVariables(1);
+    d_time_dependent = false;
+    for (const auto& parser : d_parsers)
+    {
+        try
         {
-            const std::string postfix = std::to_string(d);
-            parser.DefineVar("X" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = parser.GetUsedVar();
+            if (used_vars.count("T") || used_vars.count("t")) d_time_dependent = true;
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -283,7 +305,7 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
 bool
 muParserCartGridFunction::isTimeDependent() const
 {
-    return true;
+    return d_time_dependent;
 } // isTimeDependent
 
 void
@@ -294,8 +316,6 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
     const Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -304,6 +324,10 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     const double* const dx = pgeom->getDx();
 
     // Set the data in the patch.
+    //
+    // NOTE: The positions of all of the data points associated with a
+    // particular data centering are computed first, and the functions are then
+    // evaluated at all of these points using muParser's bulk mode.
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
 #if !defined(NDEBUG)
     TBOX_ASSERT(data);
@@ -318,35 +342,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
+        const int num_points = patch_box.size();
+        resizeParserVariables(num_points);
+        int k = 0;
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+        {
+            const CellIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+            }
+        }
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            evaluateParser(function_depth, num_points, data_time);
+            k = 0;
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*cc_data)(ic(), data_depth) = d_parser_vals[k];
             }
         }
     }
@@ -357,67 +371,37 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(fc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(fc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            const int num_points = FaceGeometry<NDIM>::toFaceBox(patch_box, axis).size();
+            resizeParserVariables(num_points);
+            int k = 0;
+            for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int fc_data_depth = fc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == fc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * fc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const FaceIndex<NDIM>& i = ic();
+                const Index<NDIM>& cell_idx = i.toCell(1);
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    if (d == axis)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
                     }
-                    try
+                    else
                     {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        d_parser_posn[d][k] =
+                            XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
                     }
                 }
             }
+            for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
+            {
+                evaluateParser(getFunctionDepth(axis, data_depth, fc_data->getDepth()), num_points, data_time);
+                k = 0;
+                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    (*fc_data)(ic(), data_depth) = d_parser_vals[k];
+                }
+            }
         }
     }
     else if (nc_data)
@@ -425,35 +409,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
+        const int num_points = NodeGeometry<NDIM>::toNodeBox(patch_box).size();
+        resizeParserVariables(num_points);
+        int k = 0;
+        for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+        {
+            const NodeIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+            }
+        }
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            evaluateParser(function_depth, num_points, data_time);
+            k = 0;
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*nc_data)(ic(), data_depth) = d_parser_vals[k];
             }
         }
     }
@@ -464,65 +438,35 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(sc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(sc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            const int num_points = SideGeometry<NDIM>::toSideBox(patch_box, axis).size();
+            resizeParserVariables(num_points);
+            int k = 0;
+            for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int sc_data_depth = sc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == sc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * sc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const SideIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
+                    if (d == axis)
                     {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
                     }
-                    catch (mu::ParserError& e)
+                    else
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
                     }
                 }
             }
+            for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
+            {
+                evaluateParser(getFunctionDepth(axis, data_depth, sc_data->getDepth()), num_points, data_time);
+                k = 0;
+                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    (*sc_data)(ic(), data_depth) = d_parser_vals[k];
+                }
+            }
         }
     }
     else if (ec_data)
@@ -532,65 +476,35 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(ec_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(ec_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < ec_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            const int num_points = EdgeGeometry<NDIM>::toEdgeBox(patch_box, axis).size();
+            resizeParserVariables(num_points);
+            int k = 0;
+            for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int ec_data_depth = ec_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == ec_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * ec_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const EdgeIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const EdgeIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                    }
-                    try
+                    if (d == axis)
                     {
-                        (*ec_data)(i, data_depth) = d_parsers[function_depth].Eval();
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
                     }
-                    catch (mu::ParserError& e)
+                    else
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
                     }
                 }
             }
+            for (int data_depth = 0; data_depth < ec_data->getDepth(); ++data_depth)
+            {
+                evaluateParser(getFunctionDepth(axis, data_depth, ec_data->getDepth()), num_points, data_time);
+                k = 0;
+                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    (*ec_data)(ic(), data_depth) = d_parser_vals[k];
+                }
+            }
         }
     }
     else
@@ -602,6 +516,85 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::resizeParserVariables(const int num_points)
+{
+    if (num_points <= static_cast<int>(d_parser_vals.size())) return;
+
+    // In bulk mode, muParser reads the value of each variable at an offset
+    // from the address provided to DefineVar(), so the variables need to be
+    // redefined whenever the underlying arrays are reallocated.
+    const int new_size = std::max(num_points, 2 * static_cast<int>(d_parser_vals.size()));
+    d_parser_time.resize(new_size);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(new_size);
+    d_parser_vals.resize(new_size);
+    for (auto& parser : d_parsers)
+    {
+        parser.DefineVar("T", &d_parser_time[0]);
+        parser.DefineVar("t", &d_parser_time[0]);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string postfix = std::to_string(d);
+            parser.DefineVar("X" + postfix, &d_parser_posn[d][0]);
+            parser.DefineVar("x" + postfix, &d_parser_posn[d][0]);
+            parser.DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+            parser.DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+        }
+    }
+    return;
+} // resizeParserVariables
+
+int
+muParserCartGridFunction::getFunctionDepth(const unsigned int axis, const int data_depth, const int depth) const
+{
+    const int parsers_size = static_cast<int>(d_parsers.size());
+    if (parsers_size == 1)
+    {
+        return 0;
+    }
+    else if (parsers_size == NDIM)
+    {
+        return axis;
+    }
+    else if (parsers_size == depth)
+    {
+        return data_depth;
+    }
+    else if (parsers_size == NDIM * depth)
+    {
+        return NDIM * data_depth + axis;
+    }
+    return -1;
+} // getFunctionDepth
+
+void
+muParserCartGridFunction::evaluateParser(const int function_depth, const int num_points, const double data_time)
+{
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_points, data_time);
+    try
+    {
+        d_parsers[function_depth].Eval(&d_parser_vals[0], num_points);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateParser
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -396,6 +396,21 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank) override;
 
+    // \see CIBStrategy::applyMobilityMatrix() method.
+    /*!
+     * \brief Apply the mobility matrix of all of the structures to a force
+     * vector without forming the dense matrix.
+     */
+    void applyMobilityMatrix(MobilityMatrixType mat_type,
+                             Vec F,
+                             Vec U,
+                             const double* grid_dx,
+                             double mu,
+                             double f_periodic_corr,
+                             double mac_theta,
+                             int interp_degree,
+                             const int managing_rank) override;
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
@@ -518,6 +518,43 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Apply the mobility matrix of all of the structures to a force
+     * vector without forming the dense matrix.
+     * \note A default implementation that raises an error is provided in
+     * this class. The derived class provides the actual implementation.
+     *
+     * \param mat_type Mobility matrix type. Only RPY is supported.
+     *
+     * \param F Vector of nodal forces.
+     *
+     * \param U Vector of resulting nodal velocities.
+     *
+     * \param grid_dx NDIM vector of grid spacing of structure level.
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param f_periodic_corr Periodic correction subtracted from each
+     * diagonal entry of the mobility matrix.
+     *
+     * \param mac_theta Multipole acceptance parameter of the treecode used to
+     * sum the interactions. Set it to zero to sum them directly.
+     *
+     * \param interp_degree Degree of the Chebyshev interpolation used by the
+     * treecode.
+     *
+     * \param managing_rank Rank of the processor that sums the interactions.
+     */
+    virtual void applyMobilityMatrix(MobilityMatrixType mat_type,
+                                     Vec F,
+                                     Vec U,
+                                     const double* grid_dx,
+                                     double mu,
+                                     double f_periodic_corr,
+                                     double mac_theta,
+                                     int interp_degree,
+                                     const int managing_rank);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
@@ -65,6 +65,24 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * In addition to the dense LAPACK factorizations, the HODLR inverse type
+ * approximates a mobility matrix by a hierarchical off-diagonal low-rank
+ * (HODLR) matrix.  The markers are recursively bisected into clusters of
+ * strongly coupled markers, which are found from the entries of the matrix
+ * itself, so that no geometric information is needed.  The off-diagonal
+ * blocks of each bisection are compressed by adaptive cross approximation
+ * (ACA) to the relative tolerance given by the key <code>aca_tolerance</code>
+ * of the input database <code>HODLR</code> (default 1e-8).  Bisection stops
+ * at blocks with at most <code>leaf_size</code> rows (default 256), which are
+ * factorized densely.  The approximation is factorized recursively with the
+ * Sherman-Morrison-Woodbury formula, which requires O(N k^2 log^2 N) work for
+ * blocks of rank k instead of O(N^3), and O(N k log N) work per solve.  If
+ * <code>reuse_cluster_tree</code> is TRUE (default FALSE), the clusters found
+ * for the first factorization of a matrix are reused when the matrix is
+ * recomputed, which is appropriate if the bodies move only slightly between
+ * recomputations.  HODLR is only supported for mobility matrices; body
+ * mobility matrices are small enough to be factorized densely.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -223,6 +241,34 @@ public:
 
     /////////////////////////////// PRIVATE //////////////////////////////////////
 private:
+    /*!
+     * \brief A node of the bisection tree of a HODLR matrix.
+     *
+     * A leaf stores the LU factorization of its diagonal block in \a mat.
+     * Otherwise, the off-diagonal blocks are A12 = U1 V1^T and A21 = U2 V2^T,
+     * and the node stores V1, V2, Z1 = inv(A11) U1, Z2 = inv(A22) U2, and the
+     * LU factorization of the capacitance matrix I + [0 V1^T; V2^T 0] Z in
+     * \a mat.
+     */
+    struct HODLRNode
+    {
+        int begin, end, child = -1;
+        int rank1 = 0, rank2 = 0;
+        std::vector<double> V1, V2, Z1, Z2, mat;
+        std::vector<int> ipiv;
+    };
+
+    /*!
+     * \brief A HODLR matrix. Row and column i of the HODLR matrix are row
+     * and column perm[i] of the original matrix. The children of a node are
+     * stored consecutively, and the root is the first node.
+     */
+    struct HODLRMatrix
+    {
+        std::vector<int> perm;
+        std::vector<HODLRNode> nodes;
+    };
+
     /*!
      * \brief Get input options.
      */
@@ -250,13 +296,63 @@ private:
                               const int mat_size,
                               const MobilityMatrixInverseType& inv_type,
                               int* ipiv,
+                              HODLRMatrix* hodlr_mat,
                               const std::string& mat_name,
                               const std::string& err_msg);
 
+    /*!
+     * \brief Build and factorize the HODLR approximation of a dense
+     * column-major mobility matrix.
+     */
+    void factorizeHODLRMatrix(const double* mat_data,
+                              const int mat_size,
+                              HODLRMatrix& hodlr_mat,
+                              const std::string& mat_name,
+                              const std::string& err_msg);
+
+    /*!
+     * \brief Build the cluster tree of a HODLR approximation of a dense
+     * column-major mobility matrix.
+     */
+    void buildHODLRClusterTree(const double* mat_data, const int mat_size, HODLRMatrix& hodlr_mat);
+
+    /*!
+     * \brief Factorize the subtree rooted at node \a n of a HODLR matrix.
+     *
+     * \return The LAPACK error code of the first failed factorization, or
+     * zero.
+     */
+    int factorizeHODLRNode(const double* mat_data, const int mat_size, HODLRMatrix& hodlr_mat, const int n);
+
+    /*!
+     * \brief Apply the inverse of the subtree rooted at node \a n of a HODLR
+     * matrix to the \a nrhs right-hand sides stored in \a rhs with leading
+     * dimension \a ld, starting at the first row of the node.
+     */
+    static void
+    solveHODLRNode(const std::vector<HODLRNode>& nodes, const int n, double* rhs, const int ld, const int nrhs);
+
+    /*!
+     * \brief Apply the inverse of a HODLR matrix to the \a nrhs right-hand
+     * sides stored contiguously in \a rhs.
+     */
+    static void solveHODLRMatrix(const HODLRMatrix& hodlr_mat, double* rhs, const int nrhs);
+
     /*!
      * \brief Compute solution and store in the rhs vector.
+     *
+     * \param hodlr_mat HODLR factorization of the matrix, if \a inv_type is
+     * HODLR.
+     *
+     * \param nrhs Number of right-hand sides stored contiguously (column-major)
+     * in \a rhs.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat,
+                         const MobilityMatrixInverseType& inv_type,
+                         int* ipiv,
+                         const HODLRMatrix* hodlr_mat,
+                         double* rhs,
+                         const int nrhs = 1);
 
     // Solver stuff
     std::string d_object_name;
@@ -278,6 +374,7 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<std::vector<int>, std::vector<int> > > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, HODLRMatrix> d_hodlr_map;
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
@@ -292,6 +389,9 @@ private:
     double d_f_periodic_corr = 0.0;
     bool d_recompute_mob_mat = false;
     double d_svd_replace_value, d_svd_eps;
+    double d_hodlr_aca_tol = 1.0e-8;
+    int d_hodlr_leaf_size = 256;
+    bool d_hodlr_reuse_cluster_tree = false;
 
 }; // DirectMobilitySolver
 
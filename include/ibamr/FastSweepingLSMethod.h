@@ -73,6 +73,20 @@ namespace IBAMR
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
  *
+ * \note When the input key <tt>use_hyperplane_sweep</tt> is set to TRUE, each Gauss-Seidel
+ * sweep visits the cells of a patch one hyperplane \f$ \sum_k s_k i_k = \mbox{const} \f$ at a
+ * time, in which \f$ s_k = \pm 1 \f$ is the sweep direction along axis \f$ k \f$. Cells
+ * within a hyperplane do not depend on one another, so they are updated concurrently when
+ * IBAMR is compiled with OpenMP. The result is identical to the lexicographic sweep.
+ *
+ * \warning The sweeps are Gauss-Seidel iterations within each patch, but values are only
+ * exchanged between patches when the ghost cells are filled before each outer iteration.
+ * The number of outer iterations needed to reach the tolerance, and the solution obtained
+ * before convergence, therefore depend on the patch boxes. Because the load balancer may
+ * split the patch boxes differently for different numbers of MPI processes, the
+ * convergence history is not independent of the number of processes. This holds with or
+ * without <tt>use_hyperplane_sweep</tt>, which only parallelizes the work within a patch.
+ *
  * References
  * Zhao, H., <A HREF="http://www.ams.org/journals/mcom/2005-74-250/S0025-5718-04-01678-3/">
  * A Fast Sweeping Method For Eikonal Equations</A>
@@ -105,6 +119,7 @@ protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall = false;
     int d_wall_location_idx[2 * NDIM];
+    bool d_use_hyperplane_sweep = false;
 
 private:
     /*!
@@ -67,6 +67,13 @@ namespace IBAMR
  * \brief Class IBKirchhoffRodForceGen computes the forces and torques generated
  * by a collection of linear elements based on Kirchhoff rod theory.
  *
+ * When the input database entry \p use_threaded_force_computation is set to
+ * \p TRUE (default is \p FALSE), the forces and torques generated by the
+ * individual rods are computed in parallel by multiple threads when IBAMR is
+ * compiled with OpenMP support.  Each rod stores its contributions separately,
+ * and the contributions are added to the nodal forces and torques afterwards,
+ * so the results do not depend on the number of threads.
+ *
  * \note Class IBKirchhoffRodForceGen DOES NOT correct for periodic
  * displacements of IB points.
  */
@@ -146,6 +153,11 @@ private:
     std::vector<std::vector<std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > > d_material_params;
     std::vector<bool> d_is_initialized;
     //\}
+
+    /*!
+     * \brief Whether to compute the rod forces using multiple threads.
+     */
+    bool d_use_threaded_force_computation = false;
 };
 } // namespace IBAMR
 
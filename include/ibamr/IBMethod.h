@@ -50,6 +50,7 @@
 #include "ibamr/IBMethodPostProcessStrategy.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -536,6 +537,8 @@ protected:
     std::string d_interp_kernel_fcn = "IB_4", d_spread_kernel_fcn = "IB_4";
     bool d_error_if_points_leave_domain = false;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
+    IBTK::LNodeOrderingType d_lnode_ordering = IBTK::PATCH_LNODE_ORDERING;
+    bool d_incremental_lag_redistribution = false;
 
     /*
      * Lagrangian variables.
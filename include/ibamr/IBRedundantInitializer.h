@@ -80,6 +80,16 @@ namespace IBAMR
  * initializes the configuration of one or more Lagrangian structures from input
  * files.
  *
+ * By default, the complete structure data are stored on every MPI process.  If
+ * the input database entry <TT>distribute_structure_data</TT> is
+ * <TT>TRUE</TT>, each MPI process instead retains only the data associated with
+ * a contiguous block of the vertices of each structure, along with any
+ * connectivity data that involve those vertices.  When the patch hierarchy is
+ * initialized, the data associated with each vertex are sent to the MPI process
+ * that owns the patch that contains that vertex.  In this mode, connectivity
+ * data are not registered with the Lagrangian Silo data writer, and a warning
+ * is emitted when a Silo data writer is registered.
+ *
  * \todo Document input database entries.
  *
  */
@@ -638,6 +648,36 @@ protected:
      */
     int getVertexSourceIndices(const std::pair<int, int>& point_index, int level_number) const;
 
+    /*!
+     * \return The range [first,last) of the indices of the vertices of the
+     * specified structure whose data are stored on this MPI process when
+     * structure data are distributed.
+     */
+    std::pair<int, int> getLocalVertexRange(int level_number, int j) const;
+
+    /*!
+     * \return The MPI process that stores the data associated with the
+     * specified vertex when structure data are distributed.
+     */
+    int getVertexOwner(int level_number, int j, int k) const;
+
+    /*!
+     * \return The index of the specified vertex within the per-vertex data
+     * stored on this MPI process.
+     */
+    int getLocalVertexIndex(const std::pair<int, int>& point_index, int level_number) const;
+
+    /*!
+     * \brief Discard the structure data that are not stored on this MPI
+     * process.
+     *
+     * Per-vertex data are retained only for the vertices in the local vertex
+     * range of each structure, and connectivity data are retained only if they
+     * involve at least one of those vertices.  Per-vertex data that are already
+     * restricted to the local vertex range are left unchanged.
+     */
+    void distributeStructureData();
+
     /*!
      * \return The specification objects associated with the specified vertex.
      */
@@ -766,7 +806,45 @@ protected:
      */
     bool d_data_processed = false;
 
+    /*
+     * Whether structure data are distributed among the MPI processes instead
+     * of being replicated on every process.
+     */
+    bool d_distribute_structure_data = false;
+
+    /*
+     * The index of the first locally stored vertex of each structure when
+     * structure data are distributed.
+     */
+    std::vector<std::vector<int> > d_local_vertex_begin;
+
 private:
+    /*!
+     * \brief The indices and packed data of the vertices located in each local
+     * patch, indexed by patch number.
+     */
+    using PatchVertexData = std::map<int, std::vector<std::pair<std::pair<int, int>, std::vector<char> > > >;
+
+    /*!
+     * \brief The function used to pack the data associated with a vertex.
+     */
+    using VertexDataPacker = std::function<void(const std::pair<int, int>& point_index, std::vector<char>& buffer)>;
+
+    /*!
+     * \brief Send the data packed by pack_vertex_data for each locally stored
+     * vertex associated with level vertex_level_number to the MPI process that
+     * owns the patch of level level_number that contains that vertex.
+     *
+     * On return, patch_vertex_data maps the number of each local patch to the
+     * indices and packed data of the vertices located in that patch, in
+     * canonical order.  This is a collective operation.
+     */
+    void exchangePatchVertexData(PatchVertexData& patch_vertex_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                 int level_number,
+                                 int vertex_level_number,
+                                 const VertexDataPacker& pack_vertex_data) const;
+
     /*
      * Functions used to initialize structures programmatically.
      */
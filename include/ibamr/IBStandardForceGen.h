@@ -78,6 +78,15 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * When the input database entry \p use_threaded_force_computation is set to
+ * \p TRUE (default is \p FALSE), the spring, beam, and target point forces
+ * are computed in parallel by multiple threads when IBAMR is compiled with
+ * OpenMP support.  In this case, the forces generated by the individual springs
+ * and beams are first stored, and then the forces on each node are summed by a
+ * single thread in a fixed order that is determined when the level data are
+ * initialized.  The results therefore do not depend on the number of threads.
+ * User-registered spring force functions must be thread safe in this case.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -194,6 +203,28 @@ private:
      * \name Data maintained separately for each level of the patch hierarchy.
      */
     //\{
+    /*
+     * The contributions to the forces on the nodes from a collection of force
+     * generating elements (e.g., springs or beams), stored in compressed row
+     * form.  The force on node node_idxs[i] is the sum over j in [offsets[i],
+     * offsets[i+1]) of weights[j] times the force stored at element_force_idxs[j]
+     * in the array of element forces.
+     */
+    struct ForceGatherList
+    {
+        std::vector<int> node_idxs, offsets, element_force_idxs;
+        std::vector<double> weights;
+    };
+
+    /*
+     * Springs are grouped by force function.  Springs that use
+     * default_spring_force() with zero resting lengths come first, followed by
+     * the remaining springs that use default_spring_force(), followed by all
+     * springs that use other force functions.  The stiffnesses and resting
+     * lengths of the springs that use the default force function are gathered
+     * into contiguous arrays each time that the forces are computed, so that
+     * changes made to the force specifications are respected.
+     */
     struct SpringData
     {
         std::vector<int> lag_mastr_node_idxs, lag_slave_node_idxs;
@@ -202,15 +233,27 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+        int num_zero_rest_length_springs = 0, num_default_springs = 0;
+        std::vector<double> stiffnesses, rest_lengths;
+        ForceGatherList gather_list;
+        std::vector<double> forces;
     };
     std::vector<SpringData> d_spring_data;
 
+    /*
+     * The bending rigidities and curvatures of the beams, and the stiffnesses,
+     * damping factors, and positions of the target points, are gathered into
+     * contiguous arrays each time that the forces are computed.
+     */
     struct BeamData
     {
         std::vector<int> petsc_mastr_node_idxs, petsc_next_node_idxs, petsc_prev_node_idxs;
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_next_node_idxs, petsc_global_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+        std::vector<double> rigidity_values, curvature_values;
+        ForceGatherList gather_list;
+        std::vector<double> forces;
     };
     std::vector<BeamData> d_beam_data;
 
@@ -219,6 +262,7 @@ private:
         std::vector<int> petsc_node_idxs, petsc_global_node_idxs;
         std::vector<const double *> kappa, eta;
         std::vector<const IBTK::Point*> X0;
+        std::vector<double> kappa_values, eta_values, X0_values;
     };
     std::vector<TargetPointData> d_target_point_data;
 
@@ -226,6 +270,19 @@ private:
     std::vector<bool> d_is_initialized;
     //\}
 
+    /*!
+     * Routines to accumulate the forces generated by a collection of elements
+     * when the force computations are multithreaded.
+     *
+     * The element with index k contributes node_weights[j] times its force to
+     * the node with index (*element_node_idxs[j])[k].
+     */
+    static void buildForceGatherList(ForceGatherList& gather_list,
+                                     const std::vector<const std::vector<int>*>& element_node_idxs,
+                                     const std::vector<double>& node_weights);
+    static void
+    accumulateForces(double* F_node, const std::vector<double>& element_forces, const ForceGatherList& gather_list);
+
     /*!
      * Spring force routines.
      */
@@ -285,6 +342,11 @@ private:
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements = false;
+
+    /*!
+     * \brief Whether to compute the forces using multiple threads.
+     */
+    bool d_use_threaded_force_computation = false;
 };
 } // namespace IBAMR
 
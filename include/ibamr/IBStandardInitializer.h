@@ -422,6 +422,57 @@ namespace IBAMR
  D2_x_2   D2_y_2   D2_z_2  # coordinates of director D2 associated with vertex 2
  ...
  \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Binary structure file format</B>
+ *
+ * If the input database entry <TT>use_binary_structure_files</TT> is
+ * <TT>TRUE</TT>, vertex, spring, beam, and target point data are read from
+ * binary files named by appending <TT>".bin"</TT> to the corresponding ASCII
+ * file name (e.g., <TT>"structure.vertex.bin"</TT>) whenever such a file
+ * exists.  Otherwise, the ASCII file is read.  Each binary file is read by a
+ * single MPI process and its records are broadcast to all other processes, so
+ * that no process waits for any other process to parse a file.  File batons
+ * are not used for binary files.
+ *
+ * If the input database entry <TT>distribute_structure_data</TT> is also
+ * <TT>TRUE</TT> (see IBRedundantInitializer), the records of binary files are
+ * instead read in contiguous blocks by all MPI processes and each record is
+ * sent only to the MPI process that stores the vertex it is associated with,
+ * so that no process ever holds a complete copy of the structure.  ASCII
+ * files are still read in full by each process and are pruned once all files
+ * have been read, so binary files should be used for very large structures.
+ *
+ * Binary files consist of a fixed-size header followed by two arrays:
+ \verbatim
+ char[8]   "IBSTRUCT"          # file signature
+ int32     1                   # byte order marker
+ int32     1                   # format version
+ char[8]   record_type         # "vertex", "spring", "beam", or "target"
+ int32     ndim                # spatial dimension
+ int32     num_int_fields      # number of integer fields per record
+ int32     num_double_fields   # number of floating point fields per record
+ int32     0                   # padding
+ int64     num_records         # number of records
+ int32     ints[num_records][num_int_fields]
+ float64   doubles[num_records][num_double_fields]
+ \endverbatim
+ * The byte order marker is used to detect files that were written on a system
+ * with a different byte order, which are converted as they are read.  Each
+ * file must contain at least one record.  The record fields are the same values
+ * that appear on each line of the corresponding ASCII file:
+ *
+ * - vertex: no integer fields; the NDIM coordinates.
+ * - spring: the two vertex indices and the force function index; the spring
+ *   constant, the rest length, and any additional force function parameters.
+ * - beam: the previous, current, and next vertex indices; the bending
+ *   rigidity and the NDIM components of the mesh-dependent curvature.
+ * - target: the vertex index; the penalty spring constant and the damping
+ *   factor.
+ *
+ * The script <TT>scripts/convert_structure_to_binary.py</TT> converts ASCII
+ * structure files to this format.
 */
 class IBStandardInitializer : public IBAMR::IBRedundantInitializer
 {
@@ -480,6 +531,18 @@ private:
      */
     void readSpringFiles(const std::string& file_extension, bool input_uses_global_idxs);
 
+    /*!
+     * \brief Add a spring that has been read from an input file.
+     */
+    void addSpring(int ln,
+                   unsigned int j,
+                   Edge e,
+                   std::vector<double> parameters,
+                   int force_fcn_idx,
+                   bool input_uses_global_idxs,
+                   const std::string& spring_filename,
+                   bool& warned);
+
     /*!
      * \brief Read the crosslink spring ("x-spring") data from one or more input
      * files.
@@ -491,6 +554,20 @@ private:
      */
     void readBeamFiles(const std::string& file_extension, bool input_uses_global_idxs);
 
+    /*!
+     * \brief Add a beam that has been read from an input file.
+     */
+    void addBeam(int ln,
+                 unsigned int j,
+                 int prev_idx,
+                 int curr_idx,
+                 int next_idx,
+                 double bend,
+                 IBTK::Vector curv,
+                 bool input_uses_global_idxs,
+                 const std::string& beam_filename,
+                 bool& warned);
+
     /*!
      * \brief Read the rod data from one or more input files.
      */
@@ -526,6 +603,13 @@ private:
      */
     void readSourceFiles(const std::string& file_extension);
 
+    /*!
+     * \return The MPI process that stores the data associated with the
+     * specified vertex when structure data are distributed, or this process if
+     * the vertex index is out of range.
+     */
+    int getInputVertexOwner(int ln, unsigned int j, int idx, bool input_uses_global_idxs) const;
+
     /*!
      * \return The specification objects associated with the specified vertex.
      */
@@ -547,6 +631,12 @@ private:
      */
     bool d_use_file_batons = true;
 
+    /*
+     * The boolean value determines whether vertex, spring, beam, and target
+     * point data are read from binary structure files, when they exist.
+     */
+    bool d_use_binary_structure_files = false;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
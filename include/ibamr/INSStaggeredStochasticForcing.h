@@ -184,6 +184,12 @@ private:
     int d_num_rand_vals = 0;
     std::vector<SAMRAI::tbox::Array<double> > d_weights;
 
+    /*!
+     * Random number generation options (see RNG).
+     */
+    bool d_use_counter_based_rng = false;
+    int d_rng_seed = 0;
+
     /*!
      * Boundary condition scalings.
      */
@@ -71,6 +71,16 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * If the input key <code>mobility_operator_type</code> is set to
+ * <code>"RPY"</code>, \f$ J L^{-1} S \f$ is replaced by the Rotne-Prager-Yamakawa
+ * mobility matrix, which is applied matrix-free by a treecode (see
+ * MobilityFunctions::applyRPYMobilityMatrix()).  The treecode is controlled
+ * by the keys <code>rpy_mac_theta</code> (default 0.7; zero sums all
+ * interactions directly) and <code>rpy_interp_degree</code> (default 4), and
+ * the periodic correction of the matrix is set by
+ * <code>f_periodic_correction</code> (default 0). The default value
+ * <code>"FLUID"</code> solves the Stokes system in each application of the
+ * operator.
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -351,6 +361,11 @@ private:
 
     // Scaling parameters and force normalization of the problem.
     double d_scale_interp = 1.0, d_scale_spread = 1.0, d_reg_mob_factor = 0.0, d_normalize_spread_force;
+
+    // Matrix-free approximation of the mobility operator.
+    std::string d_mobility_operator_type = "FLUID";
+    double d_f_periodic_corr = 0.0, d_rpy_mac_theta = 0.7;
+    int d_rpy_interp_degree = 4;
 };
 } // namespace IBAMR
 
@@ -87,7 +87,7 @@ public:
                                                  double* mm);
 
     /*!
-     * \brief Construct the mobility matrix from Rotne-Pragner-Yamakawa tensor.
+     * \brief Construct the mobility matrix from Rotne-Prager-Yamakawa tensor.
      *
      * \param kernel_name IB kernel function.
      * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
@@ -114,6 +114,55 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Compute the product of the Rotne-Prager-Yamakawa mobility matrix
+     * with a force vector without forming the matrix.
+     *
+     * If \a mac_theta is zero, all pairwise interactions are summed directly,
+     * and the result is identical to multiplying the matrix generated by
+     * constructRPYMobilityMatrix() with \a F.  Otherwise, the interactions
+     * with well-separated clusters of markers are approximated by a
+     * barycentric Lagrange treecode, which requires O(N log N) work.  Small
+     * systems are always summed directly.  In either case, only O(N) storage
+     * is required.
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param F Array of forces applied to the IB markers.
+     *
+     * \param U Array of resulting marker velocities.
+     *
+     * \param mac_theta Multipole acceptance parameter of the treecode.  A
+     * cluster of markers is approximated if its radius is less than \a
+     * mac_theta times its distance from the marker.  Set it to zero to sum
+     * all interactions directly.
+     *
+     * \param interp_degree Degree of the Chebyshev interpolation used by the
+     * treecode in each coordinate direction.
+     */
+    static void applyRPYMobilityMatrix(const char* kernel_name,
+                                       const double mu,
+                                       const double dx,
+                                       const double* X,
+                                       const int num_nodes,
+                                       const double periodic_correction,
+                                       const double* F,
+                                       double* U,
+                                       const double mac_theta = 0.0,
+                                       const int interp_degree = 4);
 }; // MobilityFunctions
 
 } // namespace IBAMR
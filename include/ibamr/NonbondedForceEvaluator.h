@@ -35,6 +35,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 #include "tbox/Array.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
@@ -45,6 +47,28 @@
 
 namespace IBAMR
 {
+/*!
+ * \brief Class NonbondedForceEvaluator computes pairwise short-range forces
+ * between the Lagrangian nodes on a patch level.
+ *
+ * Candidate pairs are found by searching the cells within
+ * <tt>interaction_radius + 2*regrid_alpha</tt> cells of each node.  When the
+ * optional input key <tt>verlet_skin</tt> (in units of mesh cells, default 0)
+ * is positive, the pairs found within <tt>interaction_radius +
+ * verlet_skin</tt> cells of each other are stored in a Verlet list that is
+ * reused until some node has moved more than half of the skin since the list
+ * was built, or until the Lagrangian data are redistributed.  In that case,
+ * the force function must vanish for separations larger than
+ * <tt>interaction_radius</tt> cells.  With the default skin of zero, the list
+ * is rebuilt every time forces are computed and no pairs are discarded.
+ *
+ * Pairs of locally owned nodes are found from a half shell of neighboring
+ * cells, so that each such pair is found and evaluated once.  Forces are only
+ * accumulated on locally owned nodes: pairs coupling a local node to a ghost
+ * node are evaluated by each process that owns one of the two nodes.  The
+ * ghost cell width of the Lagrangian data must be at least
+ * <tt>ceil(interaction_radius + 2*regrid_alpha + verlet_skin)</tt>.
+ */
 class NonbondedForceEvaluator : public IBLagrangianForceStrategy
 {
 public:
@@ -65,9 +89,16 @@ public:
     void evaluateForces(int mstr_petsc_idx,
                         int search_petsc_idx,
                         SAMRAI::tbox::Pointer<IBTK::LData> X_data,
-                        std::vector<int> cell_offset,
+                        const std::vector<int>& cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
+    // Implementation of initializeLevelData; invalidates the Verlet list.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager) override;
+
     // Implementation of computeLagrangianForce.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
@@ -80,6 +111,9 @@ public:
     // Register the force function used
     void registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr);
 
+    // Return the number of times that the Verlet list has been built.
+    int getNumberOfVerletListBuilds() const;
+
 private:
     // Default constructor, not implemented.
     NonbondedForceEvaluator() = delete;
@@ -90,6 +124,18 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that) = delete;
 
+    // Determine whether the Verlet list can be reused for the given positions.
+    bool verletListIsValid(const double* X_node, int num_ghosted_nodes, const double* dx) const;
+
+    // Build the Verlet list from the nodes stored in each cell of the level.
+    void buildVerletList(const double* X_node,
+                         int num_local_nodes,
+                         int num_ghosted_nodes,
+                         const double* dx,
+                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                         int level_number,
+                         IBTK::LDataManager* l_data_manager);
+
     // type of force to use:
     int d_force_type;
 
@@ -108,6 +154,25 @@ private:
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
     NonBddForceFcnPtr d_force_fcn_ptr;
+
+    // Verlet list skin, in units of mesh cells:
+    double d_verlet_skin = 0.0;
+
+    // Verlet list data.  Pairs are stored as local PETSc indices, with the
+    // periodic shift to subtract from the separation vector.  The first
+    // d_num_local_pairs pairs couple two locally owned nodes; the remaining
+    // pairs couple a locally owned "master" node to a ghost node.
+    bool d_verlet_list_valid = false;
+    int d_num_verlet_list_builds = 0;
+    int d_num_local_pairs = 0;
+    std::vector<int> d_pair_mstr_idxs, d_pair_search_idxs;
+    std::vector<double> d_pair_shifts;
+
+    // Positions of the local and ghost nodes when the Verlet list was built.
+    std::vector<double> d_X_verlet;
+
+    // Scratch storage for the batched pair kernel.
+    std::vector<double> d_D_pairs, d_F_pairs;
 };
 } // namespace IBAMR
 
@@ -1,11 +1,24 @@
 #ifndef included_IBAMR_RNG
 #define included_IBAMR_RNG
 
+#include <cstdint>
+#include <vector>
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "Index.h"
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * In addition to the (stateful) Mersenne Twister generator, a counter-based
+ * generator is provided.  Counter-based random numbers are a deterministic
+ * function of a key and a counter, so that each value may be generated
+ * independently of all others, e.g., by whichever MPI process or thread owns
+ * the corresponding grid cell.
  */
 class RNG
 {
@@ -18,12 +31,109 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Apply the Philox-4x32-10 bijection to the specified counter
+     * using the specified key.
+     */
+    static void philox4x32(std::uint32_t ctr[4], const std::uint32_t key[2]);
+
+    /*!
+     * \brief Generate normally distributed random numbers using a
+     * counter-based generator.
+     *
+     * The value stored in result[m] depends only on the key and on the counter
+     * (ctr[0] + m, ctr[1], ctr[2], ctr[3]).
+     */
+    static void genrandn(double* result, int n, const std::uint32_t key[2], const std::uint32_t ctr[4]);
+
+    /*!
+     * \brief Fill the specified box of the array data with normally
+     * distributed random numbers using the Mersenne Twister generator.
+     */
+    template <int DIM>
+    static void genrandn(SAMRAI::pdat::ArrayData<DIM, double>& data, const SAMRAI::hier::Box<DIM>& box);
+
+    /*!
+     * \brief Fill the specified box of the array data with normally
+     * distributed random numbers using the counter-based generator.
+     *
+     * The value assigned to each index depends only on the key, the stream
+     * (see getStream()), the depth, and the index itself, and not on the
+     * patch that contains the index or on the process that owns the patch.
+     */
+    template <int DIM>
+    static void genrandn(SAMRAI::pdat::ArrayData<DIM, double>& data,
+                         const SAMRAI::hier::Box<DIM>& box,
+                         const std::uint32_t key[2],
+                         std::uint32_t stream);
+
+    /*!
+     * \brief Return the counter-based generator stream used for the specified
+     * patch level, random value number, and data component.
+     */
+    static std::uint32_t getStream(int level_num, int rand_val_num, int component);
+
 private:
     RNG() = delete;
     RNG(RNG&) = delete;
     ~RNG() = delete;
     RNG& operator=(RNG&) = delete;
 };
+
+template <int DIM>
+void
+RNG::genrandn(SAMRAI::pdat::ArrayData<DIM, double>& data, const SAMRAI::hier::Box<DIM>& box)
+{
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+        for (typename SAMRAI::hier::Box<DIM>::Iterator i(box); i; i++)
+        {
+            genrandn(&data(i(), depth));
+        }
+    }
+    return;
+} // genrandn
+
+template <int DIM>
+void
+RNG::genrandn(SAMRAI::pdat::ArrayData<DIM, double>& data,
+              const SAMRAI::hier::Box<DIM>& box,
+              const std::uint32_t key[2],
+              const std::uint32_t stream)
+{
+    // Fill each row of the box (i.e., each set of indices that vary only in
+    // the first coordinate direction) independently.
+    if (box.empty()) return;
+    const int row_size = box.numberCells(0);
+    const int num_rows = box.size() / row_size;
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int row = 0; row < num_rows; ++row)
+        {
+            SAMRAI::hier::Index<DIM> i = box.lower();
+            int r = row;
+            for (int d = 1; d < DIM; ++d)
+            {
+                i(d) += r % box.numberCells(d);
+                r /= box.numberCells(d);
+            }
+            const std::uint32_t ctr[4] = { static_cast<std::uint32_t>(i(0)),
+                                           static_cast<std::uint32_t>(i(1)),
+                                           DIM > 2 ? static_cast<std::uint32_t>(i(DIM - 1)) : 0,
+                                           (stream << 8) | static_cast<std::uint32_t>(depth) };
+            std::vector<double> vals(row_size);
+            genrandn(&vals[0], row_size, key, ctr);
+            for (int m = 0; m < row_size; ++m, ++i(0))
+            {
+                data(i, depth) = vals[m];
+            }
+        }
+    }
+    return;
+} // genrandn
 } // namespace IBAMR
 
 #endif //#ifndef included_IBAMR_RNG
@@ -40,9 +40,6 @@
 #include <vector>
 
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
 #include "tbox/Pointer.h"
 
 namespace SAMRAI
@@ -50,8 +47,17 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class Box;
+template <int DIM>
 class BoxList;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+template <int DIM, class TYPE>
+class SideData;
+} // namespace pdat
 namespace solv
 {
 template <int DIM, class TYPE>
@@ -71,6 +77,17 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * The smoother solves the local Stokes problem associated with each grid cell
+ * using a closed-form inverse of the single-cell box operator that is computed
+ * once per level.  Each local solution is damped by the factor given by the key
+ * <code>smoother_damping_factor</code> of the input database (default 0.65).
+ *
+ * If <code>smoother_use_multicolor_ordering</code> is TRUE (the default), cells
+ * are visited in a multicolor order so that the local solves for cells of the
+ * same color are independent and may be performed concurrently.  Otherwise,
+ * cells are visited sequentially in lexicographic order, which is the order
+ * used by the original implementation of this smoother.
 */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -157,12 +174,39 @@ private:
      */
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that) = delete;
 
+    /*!
+     * \brief Closed-form inverse of the single-cell box operator.
+     *
+     * The velocity block of the box operator is diagonalized by the sum and
+     * difference of the velocities on the lower and upper faces of the cell,
+     * and the pressure Schur complement of the box operator is a scalar.
+     */
+    struct BoxInverse
+    {
+        std::array<double, NDIM> dx, D_over_dx_sq, sum_inv, diff_inv;
+        double schur_inv;
+    };
+
+    /*!
+     * \brief Perform a single damped box relaxation sweep on a patch.
+     */
+    void smoothPatch(SAMRAI::pdat::SideData<NDIM, double>& U_error_data,
+                     SAMRAI::pdat::CellData<NDIM, double>& P_error_data,
+                     const SAMRAI::pdat::SideData<NDIM, double>& U_residual_data,
+                     const SAMRAI::pdat::CellData<NDIM, double>& P_residual_data,
+                     const SAMRAI::hier::Box<NDIM>& patch_box,
+                     const BoxInverse& box_inv) const;
+
     /*
      * Box operator data.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    std::vector<BoxInverse> d_box_inv;
+
+    /*
+     * Smoother parameters.
+     */
+    double d_smoother_damping_factor = 0.65;
+    bool d_smoother_use_multicolor_ordering = true;
 
     /*
      * Mappings from patch indices to patch operators.
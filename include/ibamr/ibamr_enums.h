@@ -416,12 +416,16 @@ enum_to_string<MobilityMatrixType>(MobilityMatrixType val)
 /*!
  * \brief Enumerated type for different direct methods for dense mobility
  *  matrix inversion.
+ *
+ * HODLR approximates the matrix by a hierarchical off-diagonal low-rank
+ * matrix and factorizes that approximation.
  */
 enum MobilityMatrixInverseType
 {
     LAPACK_CHOLESKY,
     LAPACK_LU,
     LAPACK_SVD,
+    HODLR,
     UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE = -1
 };
 
@@ -432,6 +436,7 @@ string_to_enum<MobilityMatrixInverseType>(const std::string& val)
     if (strcasecmp(val.c_str(), "LAPACK_CHOLESKY") == 0) return LAPACK_CHOLESKY;
     if (strcasecmp(val.c_str(), "LAPACK_LU") == 0) return LAPACK_LU;
     if (strcasecmp(val.c_str(), "LAPACK_SVD") == 0) return LAPACK_SVD;
+    if (strcasecmp(val.c_str(), "HODLR") == 0) return HODLR;
     return UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE;
 } // string_to_enum
 
@@ -442,6 +447,7 @@ enum_to_string<MobilityMatrixInverseType>(MobilityMatrixInverseType val)
     if (val == LAPACK_CHOLESKY) return "LAPACK_CHOLESKY";
     if (val == LAPACK_LU) return "LAPACK_LU";
     if (val == LAPACK_SVD) return "LAPACK_SVD";
+    if (val == HODLR) return "HODLR";
     return "UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE";
 } // enum_to_string
 
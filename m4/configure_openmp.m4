@@ -0,0 +1,49 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "======================================="
+echo "Configuring optional support for OpenMP"
+echo "======================================="
+
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable multithreading via OpenMP @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+AM_CONDITIONAL([OPENMP_ENABLED],[test "$OPENMP_ENABLED" = yes])
+
+if test "$OPENMP_ENABLED" = yes; then
+  dnl AC_OPENMP declares its own --disable-openmp option, which would make
+  dnl OpenMP support the default; suppress it in favor of --enable-openmp.
+  m4_pushdef([AC_ARG_ENABLE],[])dnl
+  AC_LANG_PUSH([C++])
+  AC_OPENMP
+  AC_LANG_POP([C++])
+  AC_LANG_PUSH([Fortran])
+  AC_OPENMP
+  AC_LANG_POP([Fortran])
+  m4_popdef([AC_ARG_ENABLE])dnl
+  if test "$ac_cv_prog_cxx_openmp" = unsupported ; then
+    AC_MSG_ERROR([--enable-openmp is specified, but the C++ compiler does not support OpenMP])
+  fi
+  if test "$ac_cv_prog_fc_openmp" = unsupported ; then
+    AC_MSG_ERROR([--enable-openmp is specified, but the Fortran compiler does not support OpenMP])
+  fi
+
+  dnl The Fortran interaction kernels are called from within threaded regions,
+  dnl so they must also be compiled with the OpenMP flags (which ensures that
+  dnl local arrays are not statically allocated).  FFLAGS has already been set
+  dnl from FCFLAGS, so it is updated directly.
+  PACKAGE_CXXFLAGS_APPEND($OPENMP_CXXFLAGS)
+  PACKAGE_FCFLAGS_APPEND($OPENMP_FCFLAGS)
+  PACKAGE_LIBS_APPEND($OPENMP_CXXFLAGS)
+  FFLAGS="$FFLAGS $OPENMP_FCFLAGS"
+else
+  AC_MSG_NOTICE([Optional support for OpenMP is DISABLED])
+fi
+
+])
@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Convert IBStandardInitializer ASCII structure files (.vertex, .spring, .beam,
+# and .target) into the binary format documented in IBStandardInitializer.h.
+# The binary file is written next to the input file with ".bin" appended.
+#
+# usage: convert_structure_to_binary.py [--ndim N] file [file ...]
+
+import argparse
+import re
+import struct
+import sys
+
+
+def discard_comments(line):
+    return re.split('[!#%]', line, maxsplit=1)[0]
+
+
+def read_records(filename):
+    with open(filename) as f:
+        lines = [discard_comments(l).split() for l in f]
+    if not lines or not lines[0]:
+        sys.exit('invalid number of records in input file ' + filename)
+    num_records = int(lines[0][0])
+    if num_records <= 0:
+        # IBStandardInitializer rejects structure files without any records.
+        sys.exit('invalid number of records in input file ' + filename)
+    records = lines[1:num_records + 1]
+    if len(records) != num_records:
+        sys.exit('premature end to input file ' + filename)
+    return records
+
+
+def convert_vertex(records, ndim):
+    return [([], [float(x) for x in r[:ndim]]) for r in records]
+
+
+def convert_spring(records, ndim):
+    # idx0 idx1 kappa rest_length [fcn_idx [parameters ...]]
+    out = []
+    for r in records:
+        rest_length = float(r[3]) if len(r) > 3 else 0.0
+        fcn_idx = int(r[4]) if len(r) > 4 else 0
+        out.append(([int(r[0]), int(r[1]), fcn_idx], [float(r[2]), rest_length] + [float(x) for x in r[5:]]))
+    num_doubles = max(len(d) for i, d in out)
+    for i, d in out:
+        if len(d) != num_doubles:
+            sys.exit('all springs must have the same number of parameters')
+    return out
+
+
+def convert_beam(records, ndim):
+    # prev curr next bend [curvature]
+    out = []
+    for r in records:
+        curv = [float(x) for x in r[4:4 + ndim]] if len(r) > 4 else [0.0] * ndim
+        out.append(([int(x) for x in r[:3]], [float(r[3])] + curv))
+    return out
+
+
+def convert_target(records, ndim):
+    # idx kappa [damping]
+    return [([int(r[0])], [float(r[1]), float(r[2]) if len(r) > 2 else 0.0]) for r in records]
+
+
+CONVERTERS = {
+    'vertex': convert_vertex,
+    'spring': convert_spring,
+    'beam': convert_beam,
+    'target': convert_target,
+}
+
+
+def write_binary(filename, record_type, ndim, records):
+    # The file is always written in little-endian byte order.  The byte order
+    # marker (1) allows IBStandardInitializer to detect and convert files that
+    # are read on big-endian systems.
+    num_ints = len(records[0][0]) if records else 0
+    num_doubles = len(records[0][1]) if records else 0
+    with open(filename, 'wb') as f:
+        f.write(struct.pack('<8sii8siiiiq', b'IBSTRUCT', 1, 1, record_type.encode(), ndim, num_ints, num_doubles, 0,
+                            len(records)))
+        for ints, doubles in records:
+            f.write(struct.pack('<%di' % num_ints, *ints))
+        for ints, doubles in records:
+            f.write(struct.pack('<%dd' % num_doubles, *doubles))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert IBAMR structure files to binary format.')
+    parser.add_argument('--ndim', type=int, default=3, help='spatial dimension (default: 3)')
+    parser.add_argument('files', nargs='+')
+    args = parser.parse_args()
+    for filename in args.files:
+        record_type = filename.rsplit('.', 1)[-1]
+        if record_type not in CONVERTERS:
+            sys.exit('unsupported file type: ' + filename)
+        records = CONVERTERS[record_type](read_records(filename), args.ndim)
+        write_binary(filename + '.bin', record_type, args.ndim, records)
+
+
+if __name__ == '__main__':
+    main()
@@ -1465,6 +1465,68 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::applyMobilityMatrix(MobilityMatrixType mat_type,
+                               Vec F,
+                               Vec U,
+                               const double* grid_dx,
+                               double mu,
+                               double f_periodic_corr,
+                               double mac_theta,
+                               int interp_degree,
+                               const int managing_rank)
+{
+    if (mat_type != RPY)
+    {
+        TBOX_ERROR("CIBMethod::applyMobilityMatrix(): Only the RPY mobility matrix can be applied matrix-free."
+                   << std::endl);
+    }
+    const int struct_ln = getStructuresLevelNumber();
+    const char* ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction().c_str();
+    const int rank = SAMRAI_MPI::getRank();
+
+    // Collect the data of all of the structures on the managing rank.
+    std::vector<unsigned> struct_ids(d_num_rigid_parts);
+    unsigned num_nodes = 0;
+    for (unsigned struct_no = 0; struct_no < d_num_rigid_parts; ++struct_no)
+    {
+        struct_ids[struct_no] = struct_no;
+        num_nodes += getNumberOfNodes(struct_no);
+    }
+    const int size = num_nodes * NDIM;
+    std::vector<double> XW, FW, UW;
+    if (rank == managing_rank)
+    {
+        XW.resize(size);
+        FW.resize(size);
+        UW.resize(size);
+    }
+    std::vector<Pointer<LData> >* X_half_data;
+    bool* X_half_needs_ghost_fill;
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    copyVecToArray((*X_half_data)[struct_ln]->getVec(), XW.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+    copyVecToArray(F, FW.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+
+    // Sum the interactions.
+    if (rank == managing_rank)
+    {
+        MobilityFunctions::applyRPYMobilityMatrix(ib_kernel,
+                                                  mu,
+                                                  grid_dx[0],
+                                                  XW.data(),
+                                                  num_nodes,
+                                                  f_periodic_corr,
+                                                  FW.data(),
+                                                  UW.data(),
+                                                  mac_theta,
+                                                  interp_degree);
+    }
+    VecZeroEntries(U);
+    copyArrayToVec(U, UW.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+
+    return;
+} // applyMobilityMatrix
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
@@ -1767,9 +1829,17 @@ CIBMethod::computeCOMOfStructures(IBTK::EigenAlignedVector<Eigen::Vector3d>& cen
             for (unsigned int d = 0; d < NDIM; ++d) center_of_mass[struct_handle][d] += X[d];
         }
 
+        // Sum the contributions to all centers of mass with a single
+        // reduction.
+        std::vector<double> com_buffer(structs_on_this_ln * NDIM);
+        for (unsigned struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d) com_buffer[struct_no * NDIM + d] = center_of_mass[struct_no][d];
+        }
+        SAMRAI_MPI::sumReduction(com_buffer.data(), static_cast<int>(com_buffer.size()));
         for (unsigned struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
         {
-            SAMRAI_MPI::sumReduction(&center_of_mass[struct_no][0], NDIM);
+            for (unsigned int d = 0; d < NDIM; ++d) center_of_mass[struct_no][d] = com_buffer[struct_no * NDIM + d];
             const int total_nodes = getNumberOfNodes(struct_no);
             center_of_mass[struct_no] /= total_nodes;
         }
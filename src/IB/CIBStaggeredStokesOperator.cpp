@@ -114,9 +114,6 @@ CIBStaggeredStokesOperator::apply(Vec x, Vec y)
 {
     IBAMR_TIMER_START(t_apply);
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
-
     const double half_time = 0.5 * (d_new_time + d_current_time);
     Pointer<IBStrategy> ib_method_ops = d_cib_strategy;
 
@@ -243,9 +240,6 @@ CIBStaggeredStokesOperator::apply(Vec x, Vec y)
     // Delete temporary vectors.
     VecDestroy(&Vrigid);
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
-
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vy[0], &vy0);
 
@@ -265,6 +259,9 @@ CIBStaggeredStokesOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM,
     d_x = in.cloneVector(in.getName());
     d_b = out.cloneVector(out.getName());
 
+    // Allocate scratch data.  These data persist until deallocateOperatorState().
+    d_x->allocateVectorData();
+
     // Setup the interpolation transaction information.
     d_U_fill_pattern = nullptr;
     d_P_fill_pattern = nullptr;
@@ -834,6 +834,22 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::applyMobilityMatrix(MobilityMatrixType /*mat_type*/,
+                                 Vec /*F*/,
+                                 Vec /*U*/,
+                                 const double* /*grid_dx*/,
+                                 double /*mu*/,
+                                 double /*f_periodic_corr*/,
+                                 double /*mac_theta*/,
+                                 int /*interp_degree*/,
+                                 const int /*managing_rank*/)
+{
+    TBOX_ERROR("CIBStrategy::applyMobilityMatrix(): Not implemented for this CIBStrategy." << std::endl);
+
+    return;
+} // applyMobilityMatrix
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
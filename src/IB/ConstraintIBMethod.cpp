@@ -159,6 +159,27 @@ solveSystemOfEqns(std::vector<double>& ang_mom, const Eigen::Matrix3d& inertiaTe
     return;
 }
 #endif
+
+// Sum the given per-structure arrays over all processes using a single
+// collective reduction.
+inline void
+sum_reduce_structure_data(const std::vector<std::pair<double*, int> >& data)
+{
+    int size = 0;
+    for (const auto& array : data) size += array.second;
+    if (size == 0) return;
+    std::vector<double> buffer;
+    buffer.reserve(size);
+    for (const auto& array : data) buffer.insert(buffer.end(), array.first, array.first + array.second);
+    SAMRAI_MPI::sumReduction(buffer.data(), size);
+    auto it = buffer.begin();
+    for (const auto& array : data)
+    {
+        std::copy(it, it + array.second, array.first);
+        it += array.second;
+    }
+    return;
+} // sum_reduce_structure_data
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -940,14 +961,20 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_data.emplace_back(&d_center_of_mass_current[struct_no][0], NDIM);
+        reduction_data.emplace_back(&d_center_of_mass_new[struct_no][0], NDIM);
+        reduction_data.emplace_back(&tagged_position[struct_no][0], 3);
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_current[struct_no][0], NDIM);
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_new[struct_no][0], NDIM);
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
@@ -957,7 +984,6 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -1059,15 +1085,17 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > moi_reduction_data;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            moi_reduction_data.emplace_back(&d_moment_of_inertia_current[struct_no](0, 0), 9);
+            moi_reduction_data.emplace_back(&d_moment_of_inertia_new[struct_no](0, 0), 9);
         }
     }
+    sum_reduce_structure_data(moi_reduction_data);
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1483,12 +1511,22 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            reduction_data.emplace_back(&d_rigid_trans_vel_new[struct_no][0], NDIM);
+        }
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_trans_vel_new[struct_no][0], NDIM);
             Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1587,12 +1625,22 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            reduction_data.emplace_back(&d_rigid_rot_vel_new[struct_no][0], 3);
+        }
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -2430,10 +2478,16 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_data.emplace_back(&inertia_force[struct_no][0], 3);
+        reduction_data.emplace_back(&constraint_force[struct_no][0], 3);
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2540,10 +2594,16 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_data.emplace_back(&inertia_torque[struct_no][0], 3);
+        reduction_data.emplace_back(&constraint_torque[struct_no][0], 3);
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2622,10 +2682,16 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_data.emplace_back(&inertia_power[struct_no][0], 3);
+        reduction_data.emplace_back(&constraint_power[struct_no][0], 3);
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2692,9 +2758,15 @@ ConstraintIBMethod::calculateStructureMomentum()
         d_l_data_U_new[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_data.emplace_back(&d_structure_mom[struct_no][0], 3);
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             d_structure_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -2771,9 +2843,15 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::pair<double*, int> > reduction_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_data.emplace_back(&d_structure_rotational_mom[struct_no][0], 3);
+    }
+    sum_reduce_structure_data(reduction_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             d_structure_rotational_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -77,6 +77,21 @@ extern "C"
                 const int& ldb,
                 int& info);
 
+    // BLAS function to compute a matrix-matrix product.
+    void dgemm_(const char* transa,
+                const char* transb,
+                const int& m,
+                const int& n,
+                const int& k,
+                const double& alpha,
+                const double* a,
+                const int& lda,
+                const double* b,
+                const int& ldb,
+                const double& beta,
+                double* c,
+                const int& ldc);
+
     // LAPACK function to do SVD factorization.
     void dsyevr_(const char* jobz,
                  const char* range,
@@ -112,6 +127,88 @@ static Timer* t_solve_system;
 static Timer* t_solve_body_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Compress the m x n block of the column-major matrix P^T A P whose upper
+// left entry is (P^T A P)(row0, col0) by adaptive cross approximation with
+// partial pivoting, so that the block is approximately U V^T.  Here, P is
+// the permutation with (P^T A P)(i, j) = A(perm[i], perm[j]).  U (m x rank)
+// and V (n x rank) are stored in column-major order, and the rank is
+// returned.
+int
+compute_aca(const double* const A,
+            const int lda,
+            const int* const perm,
+            const int row0,
+            const int col0,
+            const int m,
+            const int n,
+            const double tol,
+            std::vector<double>& U,
+            std::vector<double>& V)
+{
+    U.clear();
+    V.clear();
+    std::vector<bool> used_row(m, false);
+    std::vector<double> row(n), col(m);
+    int rank = 0, num_used_rows = 0, i_piv = 0;
+    double approx_norm_sq = 0.0;
+    while (rank < std::min(m, n) && num_used_rows < m)
+    {
+        used_row[i_piv] = true;
+        ++num_used_rows;
+
+        // Compute the residual of the pivot row and find its largest entry.
+        int j_piv = 0;
+        for (int j = 0; j < n; ++j)
+        {
+            row[j] = A[perm[col0 + j] * lda + perm[row0 + i_piv]];
+            for (int l = 0; l < rank; ++l) row[j] -= U[l * m + i_piv] * V[l * n + j];
+            if (std::abs(row[j]) > std::abs(row[j_piv])) j_piv = j;
+        }
+        if (row[j_piv] == 0.0)
+        {
+            // The residual of this row vanishes; try the next unused row.
+            i_piv = static_cast<int>(std::find(used_row.begin(), used_row.end(), false) - used_row.begin());
+            continue;
+        }
+        const double pivot = row[j_piv];
+        for (int j = 0; j < n; ++j) row[j] /= pivot;
+
+        // Compute the residual of the pivot column.
+        for (int i = 0; i < m; ++i)
+        {
+            col[i] = A[perm[col0 + j_piv] * lda + perm[row0 + i]];
+            for (int l = 0; l < rank; ++l) col[i] -= V[l * n + j_piv] * U[l * m + i];
+        }
+
+        // Update the estimate of the Frobenius norm of the approximation.
+        double u_sq = 0.0, v_sq = 0.0;
+        for (int i = 0; i < m; ++i) u_sq += col[i] * col[i];
+        for (int j = 0; j < n; ++j) v_sq += row[j] * row[j];
+        for (int l = 0; l < rank; ++l)
+        {
+            double u_dot = 0.0, v_dot = 0.0;
+            for (int i = 0; i < m; ++i) u_dot += U[l * m + i] * col[i];
+            for (int j = 0; j < n; ++j) v_dot += V[l * n + j] * row[j];
+            approx_norm_sq += 2.0 * u_dot * v_dot;
+        }
+        approx_norm_sq += u_sq * v_sq;
+        U.insert(U.end(), col.begin(), col.end());
+        V.insert(V.end(), row.begin(), row.end());
+        ++rank;
+        if (std::sqrt(u_sq * v_sq) <= tol * std::sqrt(approx_norm_sq)) break;
+
+        // The next pivot row is the unused row with the largest entry in the
+        // new column.
+        i_piv = -1;
+        for (int i = 0; i < m; ++i)
+        {
+            if (!used_row[i] && (i_piv < 0 || std::abs(col[i]) > std::abs(col[i_piv]))) i_piv = i;
+        }
+        if (i_piv < 0) break;
+    }
+    return rank;
+} // compute_aca
 } // namespace
 
 ////////////////////////////// PUBLIC ////////////////////////////////////////
@@ -197,6 +294,11 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     TBOX_ASSERT(inv_type.first != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
     TBOX_ASSERT(inv_type.second != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
 #endif
+    if (inv_type.second == HODLR)
+    {
+        TBOX_ERROR("DirectMobilitySolver::registerMobilityMat(): HODLR is not supported for the body mobility matrix "
+                   << "with handle " << mat_name << std::endl);
+    }
 
     unsigned int num_nodes = 0;
     for (const auto& prototype_struct_id : prototype_struct_ids)
@@ -216,6 +318,7 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     d_mat_map[mat_name] = { {}, {} };
     d_geometric_mat_map[mat_name] = {};
     d_ipiv_map[mat_name] = { {}, {} };
+    d_hodlr_map[mat_name] = HODLRMatrix();
     d_petsc_mat_map[mat_name] = { nullptr, nullptr };
     d_petsc_geometric_mat_map[mat_name] = nullptr;
 
@@ -333,29 +436,40 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
         const int num_structs = static_cast<int>(struct_ids.size());
 
+        // Gather the right-hand sides of all structures associated with this
+        // matrix, so that they can be solved for together.
+        std::vector<double> rhs;
+        if (rank == managing_proc) rhs.resize(mat_size * num_structs);
         for (int k = 0; k < num_structs; ++k)
         {
-            std::vector<double> rhs;
-            if (rank == managing_proc) rhs.resize(mat_size);
-            d_cib_strategy->copyVecToArray(b, rhs.data(), struct_ids[k], data_depth, managing_proc);
+            double* const rhs_k = rhs.data() + (rank == managing_proc ? k * mat_size : 0);
+            d_cib_strategy->copyVecToArray(b, rhs_k, struct_ids[k], data_depth, managing_proc);
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ true,
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data());
+        }
+        if (rank == managing_proc)
+        {
+            computeSolution(
+                mat, inv_type, d_ipiv_map[mat_name].first.data(), &d_hodlr_map[mat_name], rhs.data(), num_structs);
+        }
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* const rhs_k = rhs.data() + (rank == managing_proc ? k * mat_size : 0);
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ false,
                                             managing_proc,
                                             data_depth);
             }
-            d_cib_strategy->copyArrayToVec(x, rhs.data(), struct_ids[k], data_depth, managing_proc);
+            d_cib_strategy->copyArrayToVec(x, rhs_k, struct_ids[k], data_depth, managing_proc);
         }
     }
 
@@ -386,29 +500,40 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
         const int managing_proc = d_mat_proc_map[mat_name];
         const int num_structs = static_cast<int>(struct_ids.size());
 
+        // Gather the right-hand sides of all structures associated with this
+        // matrix, so that they can be solved for together.
+        std::vector<double> rhs;
+        if (rank == managing_proc) rhs.resize(mat_size * num_structs);
         for (int k = 0; k < num_structs; ++k)
         {
-            std::vector<double> rhs;
-            if (rank == managing_proc) rhs.resize(mat_size);
-            d_cib_strategy->copyFreeDOFsVecToArray(b, rhs.data(), struct_ids[k], managing_proc);
+            double* const rhs_k = rhs.data() + (rank == managing_proc ? k * mat_size : 0);
+            d_cib_strategy->copyFreeDOFsVecToArray(b, rhs_k, struct_ids[k], managing_proc);
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ true,
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second.data(), rhs.data());
+        }
+        if (rank == managing_proc)
+        {
+            computeSolution(
+                mat, inv_type, d_ipiv_map[mat_name].second.data(), /*hodlr_mat*/ nullptr, rhs.data(), num_structs);
+        }
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* const rhs_k = rhs.data() + (rank == managing_proc ? k * mat_size : 0);
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ false,
                                             managing_proc,
                                             data_depth);
             }
-            d_cib_strategy->copyFreeDOFsArrayToVec(x, rhs.data(), struct_ids[k], managing_proc);
+            d_cib_strategy->copyFreeDOFsArrayToVec(x, rhs_k, struct_ids[k], managing_proc);
         }
     }
 
@@ -553,6 +678,14 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
         d_svd_eps = comp_db->getDouble("min_eigenvalue_threshold");
     }
 
+    comp_db = input_db->isDatabase("HODLR") ? input_db->getDatabase("HODLR") : Pointer<Database>(nullptr);
+    if (comp_db)
+    {
+        d_hodlr_aca_tol = comp_db->getDoubleWithDefault("aca_tolerance", d_hodlr_aca_tol);
+        d_hodlr_leaf_size = comp_db->getIntegerWithDefault("leaf_size", d_hodlr_leaf_size);
+        d_hodlr_reuse_cluster_tree = comp_db->getBoolWithDefault("reuse_cluster_tree", d_hodlr_reuse_cluster_tree);
+    }
+
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
@@ -574,7 +707,13 @@ DirectMobilitySolver::factorizeMobilityMatrix()
         const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
         double* mat_data = nullptr;
         MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first.data(), mat_name, "Mobility");
+        factorizeDenseMatrix(mat_data,
+                             mat_size,
+                             inv_type,
+                             d_ipiv_map[mat_name].first.data(),
+                             &d_hodlr_map[mat_name],
+                             mat_name,
+                             "Mobility");
         MatDenseRestoreArray(mat, &mat_data);
     }
     return;
@@ -605,14 +744,16 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data.data(), &product_mat);
         MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
 
-        for (int col = 0; col < col_size; ++col)
-        {
-            double* col_data;
-            MatDenseGetArray(product_mat, &col_data);
-            computeSolution(
-                mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), &col_data[col * row_size]);
-            MatDenseRestoreArray(product_mat, &col_data);
-        }
+        // Solve for all columns at once.
+        double* col_data;
+        MatDenseGetArray(product_mat, &col_data);
+        computeSolution(mobility_mat,
+                        mobility_inv_type,
+                        d_ipiv_map[mat_name].first.data(),
+                        &d_hodlr_map[mat_name],
+                        col_data,
+                        col_size);
+        MatDenseRestoreArray(product_mat, &col_data);
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
 
         MatDestroy(&product_mat);
@@ -636,8 +777,13 @@ DirectMobilitySolver::factorizeBodyMobilityMatrix()
 
         double* mat_data = nullptr;
         MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(
-            mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second.data(), mat_name, "Body Mobility");
+        factorizeDenseMatrix(mat_data,
+                             mat_size,
+                             inv_type,
+                             d_ipiv_map[mat_name].second.data(),
+                             /*hodlr_mat*/ nullptr,
+                             mat_name,
+                             "Body Mobility");
         MatDenseRestoreArray(mat, &mat_data);
     }
     return;
@@ -649,6 +795,7 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
                                            const int mat_size,
                                            const MobilityMatrixInverseType& inv_type,
                                            int* ipiv,
+                                           HODLRMatrix* hodlr_mat,
                                            const std::string& mat_name,
                                            const std::string& err_msg)
 {
@@ -790,6 +937,10 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
              << " eigenvalues for dense matrix with handle " << mat_name
              << "have been changed. Number of zero eigenvalues placed are " << counter_zero << std::endl;
     }
+    else if (inv_type == HODLR)
+    {
+        factorizeHODLRMatrix(mat_data, mat_size, *hodlr_mat, mat_name, err_msg);
+    }
     else
     {
         TBOX_ERROR("DirectMobilityMatrix::factorizeDenseMatrix(): Unsupported dense "
@@ -800,7 +951,275 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::factorizeHODLRMatrix(const double* mat_data,
+                                           const int mat_size,
+                                           HODLRMatrix& hodlr_mat,
+                                           const std::string& mat_name,
+                                           const std::string& err_msg)
+{
+    if (!d_hodlr_reuse_cluster_tree || hodlr_mat.perm.size() != static_cast<std::size_t>(mat_size))
+    {
+        buildHODLRClusterTree(mat_data, mat_size, hodlr_mat);
+    }
+
+    const int err = factorizeHODLRNode(mat_data, mat_size, hodlr_mat, 0);
+    if (err)
+    {
+        TBOX_ERROR("DirectMobilityMatrix::factorizeHODLRMatrix(). "
+                   << err_msg << " matrix factorization "
+                   << "failed for matrix handle " << mat_name << " with error code " << err << " using HODLR."
+                   << std::endl);
+    }
+
+    int max_rank = 0;
+    std::size_t num_entries = 0;
+    for (const auto& node : hodlr_mat.nodes)
+    {
+        max_rank = std::max(max_rank, std::max(node.rank1, node.rank2));
+        num_entries += node.V1.size() + node.V2.size() + node.Z1.size() + node.Z2.size() + node.mat.size();
+    }
+    plog << "DirectMobilityMatrix::factorizeHODLRMatrix(): For " << err_msg << " matrix with handle " << mat_name
+         << ": maximum off-diagonal rank is " << max_rank << " and the factorization stores " << num_entries
+         << " entries instead of " << static_cast<std::size_t>(mat_size) * mat_size << std::endl;
+
+    return;
+} // factorizeHODLRMatrix
+
+void
+DirectMobilitySolver::buildHODLRClusterTree(const double* mat_data, const int mat_size, HODLRMatrix& hodlr_mat)
+{
+    // The coupling of two markers is the squared Frobenius norm of their NDIM
+    // x NDIM block of the mobility matrix, which decreases with the distance
+    // between the markers.
+    auto coupling = [mat_data, mat_size](const int i, const int j) {
+        double c = 0.0;
+        for (int e = 0; e < NDIM; ++e)
+        {
+            for (int d = 0; d < NDIM; ++d)
+            {
+                const double m = mat_data[(j * NDIM + e) * mat_size + i * NDIM + d];
+                c += m * m;
+            }
+        }
+        return c;
+    };
+
+    // Recursively bisect the markers. Each cluster is split along the axis
+    // through two weakly coupled (i.e., distant) markers a and b, by sorting
+    // its markers by how much more strongly they are coupled to a than to b.
+    const int num_markers = mat_size / NDIM;
+    std::vector<int> markers(num_markers);
+    for (int k = 0; k < num_markers; ++k) markers[k] = k;
+    std::vector<double> key(num_markers);
+    std::vector<HODLRNode>& nodes = hodlr_mat.nodes;
+    nodes.assign(1, HODLRNode());
+    nodes[0].begin = 0;
+    nodes[0].end = mat_size;
+    for (unsigned int n = 0; n < nodes.size(); ++n)
+    {
+        const int begin = nodes[n].begin / NDIM, end = nodes[n].end / NDIM;
+        if ((end - begin) * NDIM <= d_hodlr_leaf_size || end - begin < 2) continue;
+
+        int a = markers[begin], b = markers[begin];
+        for (int k = begin; k < end; ++k)
+        {
+            if (coupling(markers[begin], markers[k]) < coupling(markers[begin], a)) a = markers[k];
+        }
+        for (int k = begin; k < end; ++k)
+        {
+            if (coupling(a, markers[k]) < coupling(a, b)) b = markers[k];
+        }
+        for (int k = begin; k < end; ++k) key[markers[k]] = coupling(markers[k], a) - coupling(markers[k], b);
+        const int mid = (begin + end) / 2;
+        std::nth_element(markers.begin() + begin,
+                         markers.begin() + mid,
+                         markers.begin() + end,
+                         [&key](const int i, const int j) { return key[i] > key[j]; });
+
+        nodes[n].child = static_cast<int>(nodes.size());
+        HODLRNode child;
+        child.begin = begin * NDIM;
+        child.end = mid * NDIM;
+        nodes.push_back(child);
+        child.begin = mid * NDIM;
+        child.end = end * NDIM;
+        nodes.push_back(child);
+    }
+
+    hodlr_mat.perm.resize(mat_size);
+    for (int k = 0; k < num_markers; ++k)
+    {
+        for (int d = 0; d < NDIM; ++d) hodlr_mat.perm[k * NDIM + d] = markers[k] * NDIM + d;
+    }
+    return;
+} // buildHODLRClusterTree
+
+int
+DirectMobilitySolver::factorizeHODLRNode(const double* mat_data,
+                                         const int mat_size,
+                                         HODLRMatrix& hodlr_mat,
+                                         const int n)
+{
+    const int* const perm = hodlr_mat.perm.data();
+    std::vector<HODLRNode>& nodes = hodlr_mat.nodes;
+    HODLRNode& node = nodes[n];
+    int err = 0;
+    if (node.child < 0)
+    {
+        // Factorize the diagonal block densely.
+        const int m = node.end - node.begin;
+        node.mat.resize(m * m);
+        for (int j = 0; j < m; ++j)
+        {
+            for (int i = 0; i < m; ++i)
+            {
+                node.mat[j * m + i] = mat_data[perm[node.begin + j] * mat_size + perm[node.begin + i]];
+            }
+        }
+        node.ipiv.resize(m);
+        dgetrf_(m, m, node.mat.data(), m, node.ipiv.data(), err);
+        return err;
+    }
+
+    const HODLRNode& child1 = nodes[node.child];
+    const HODLRNode& child2 = nodes[node.child + 1];
+    const int n1 = child1.end - child1.begin, n2 = child2.end - child2.begin;
+    err = factorizeHODLRNode(mat_data, mat_size, hodlr_mat, node.child);
+    if (!err) err = factorizeHODLRNode(mat_data, mat_size, hodlr_mat, node.child + 1);
+    if (err) return err;
+
+    // Compress the off-diagonal blocks, A12 = U1 V1^T and A21 = U2 V2^T, and
+    // compute Z1 = inv(A11) U1 and Z2 = inv(A22) U2.
+    node.rank1 =
+        compute_aca(mat_data, mat_size, perm, child1.begin, child2.begin, n1, n2, d_hodlr_aca_tol, node.Z1, node.V1);
+    node.rank2 =
+        compute_aca(mat_data, mat_size, perm, child2.begin, child1.begin, n2, n1, d_hodlr_aca_tol, node.Z2, node.V2);
+    const int k1 = node.rank1, k2 = node.rank2, k = k1 + k2;
+    if (k1 > 0) solveHODLRNode(nodes, node.child, node.Z1.data(), n1, k1);
+    if (k2 > 0) solveHODLRNode(nodes, node.child + 1, node.Z2.data(), n2, k2);
+    if (k == 0) return err;
+
+    // Factorize the capacitance matrix S = I + [0 V1^T Z2; V2^T Z1 0].
+    node.mat.assign(k * k, 0.0);
+    for (int i = 0; i < k; ++i) node.mat[i * k + i] = 1.0;
+    if (k1 > 0 && k2 > 0)
+    {
+        const double one = 1.0;
+        dgemm_((char*)"T",
+               (char*)"N",
+               k1,
+               k2,
+               n2,
+               one,
+               node.V1.data(),
+               n2,
+               node.Z2.data(),
+               n2,
+               one,
+               node.mat.data() + k1 * k,
+               k);
+        dgemm_((char*)"T",
+               (char*)"N",
+               k2,
+               k1,
+               n1,
+               one,
+               node.V2.data(),
+               n1,
+               node.Z1.data(),
+               n1,
+               one,
+               node.mat.data() + k1,
+               k);
+    }
+    node.ipiv.resize(k);
+    dgetrf_(k, k, node.mat.data(), k, node.ipiv.data(), err);
+    return err;
+} // factorizeHODLRNode
+
+void
+DirectMobilitySolver::solveHODLRNode(const std::vector<HODLRNode>& nodes,
+                                     const int n,
+                                     double* rhs,
+                                     const int ld,
+                                     const int nrhs)
+{
+    const HODLRNode& node = nodes[n];
+    int err = 0;
+    if (node.child < 0)
+    {
+        const int m = node.end - node.begin;
+        dgetrs_((char*)"N", m, nrhs, node.mat.data(), m, node.ipiv.data(), rhs, ld, err);
+        if (err)
+        {
+            TBOX_ERROR("DirectMobilitySolver::solveHODLRNode(). Solution failed using "
+                       << "HODLR with error code " << err << std::endl);
+        }
+        return;
+    }
+
+    // Apply the inverse of the block diagonal part, y = inv(D) b.
+    const int n1 = nodes[node.child].end - nodes[node.child].begin;
+    const int n2 = nodes[node.child + 1].end - nodes[node.child + 1].begin;
+    solveHODLRNode(nodes, node.child, rhs, ld, nrhs);
+    solveHODLRNode(nodes, node.child + 1, rhs + n1, ld, nrhs);
+
+    // Apply the Sherman-Morrison-Woodbury correction, x = y - Z inv(S) W y,
+    // with W y = [V1^T y2; V2^T y1].
+    const int k1 = node.rank1, k2 = node.rank2, k = k1 + k2;
+    if (k == 0) return;
+    const double one = 1.0, zero = 0.0, minus_one = -1.0;
+    std::vector<double> t(k * nrhs);
+    if (k1 > 0)
+    {
+        dgemm_((char*)"T", (char*)"N", k1, nrhs, n2, one, node.V1.data(), n2, rhs + n1, ld, zero, t.data(), k);
+    }
+    if (k2 > 0)
+    {
+        dgemm_((char*)"T", (char*)"N", k2, nrhs, n1, one, node.V2.data(), n1, rhs, ld, zero, t.data() + k1, k);
+    }
+    dgetrs_((char*)"N", k, nrhs, node.mat.data(), k, node.ipiv.data(), t.data(), k, err);
+    if (err)
+    {
+        TBOX_ERROR("DirectMobilitySolver::solveHODLRNode(). Solution failed using "
+                   << "HODLR with error code " << err << std::endl);
+    }
+    if (k1 > 0)
+    {
+        dgemm_((char*)"N", (char*)"N", n1, nrhs, k1, minus_one, node.Z1.data(), n1, t.data(), k, one, rhs, ld);
+    }
+    if (k2 > 0)
+    {
+        dgemm_(
+            (char*)"N", (char*)"N", n2, nrhs, k2, minus_one, node.Z2.data(), n2, t.data() + k1, k, one, rhs + n1, ld);
+    }
+    return;
+} // solveHODLRNode
+
+void
+DirectMobilitySolver::solveHODLRMatrix(const HODLRMatrix& hodlr_mat, double* rhs, const int nrhs)
+{
+    const int mat_size = static_cast<int>(hodlr_mat.perm.size());
+    std::vector<double> permuted_rhs(mat_size * nrhs);
+    for (int k = 0; k < nrhs; ++k)
+    {
+        for (int i = 0; i < mat_size; ++i) permuted_rhs[k * mat_size + i] = rhs[k * mat_size + hodlr_mat.perm[i]];
+    }
+    solveHODLRNode(hodlr_mat.nodes, 0, permuted_rhs.data(), mat_size, nrhs);
+    for (int k = 0; k < nrhs; ++k)
+    {
+        for (int i = 0; i < mat_size; ++i) rhs[k * mat_size + hodlr_mat.perm[i]] = permuted_rhs[k * mat_size + i];
+    }
+    return;
+} // solveHODLRMatrix
+
+void
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      const HODLRMatrix* hodlr_mat,
+                                      double* rhs,
+                                      const int nrhs)
 {
     // Get pointer to matrix.
     int mat_size;
@@ -811,7 +1230,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
-        dpotrs_((char*)"L", mat_size, 1, mat_data, mat_size, rhs, mat_size, err);
+        dpotrs_((char*)"L", mat_size, nrhs, mat_data, mat_size, rhs, mat_size, err);
         if (err)
         {
             TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
@@ -820,7 +1239,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_LU)
     {
-        dgetrs_((char*)"N", mat_size, 1, mat_data, mat_size, ipiv, rhs, mat_size, err);
+        dgetrs_((char*)"N", mat_size, nrhs, mat_data, mat_size, ipiv, rhs, mat_size, err);
 
         if (err)
         {
@@ -830,24 +1249,40 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_SVD)
     {
-        std::vector<double> temp(mat_size);
-        for (int i = 0; i < mat_size; ++i)
-        {
-            temp[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                temp[i] += mat_data[i * mat_size + j] * rhs[j];
-            }
-        }
-
-        for (int i = 0; i < mat_size; ++i)
-        {
-            rhs[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                rhs[i] += mat_data[j * mat_size + i] * temp[j];
-            }
-        }
+        // Apply the factored inverse V*W^{-1/2} * (V*W^{-1/2})^T to all
+        // right-hand sides with two matrix-matrix products.
+        const double one = 1.0, zero = 0.0;
+        std::vector<double> temp(mat_size * nrhs);
+        dgemm_((char*)"T",
+               (char*)"N",
+               mat_size,
+               nrhs,
+               mat_size,
+               one,
+               mat_data,
+               mat_size,
+               rhs,
+               mat_size,
+               zero,
+               temp.data(),
+               mat_size);
+        dgemm_((char*)"N",
+               (char*)"N",
+               mat_size,
+               nrhs,
+               mat_size,
+               one,
+               mat_data,
+               mat_size,
+               temp.data(),
+               mat_size,
+               zero,
+               rhs,
+               mat_size);
+    }
+    else if (inv_type == HODLR)
+    {
+        solveHODLRMatrix(*hodlr_mat, rhs, nrhs);
     }
     else
     {
@@ -396,7 +396,13 @@ IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_data,
     std::vector<double> F_next_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> N_next_node_vals(NDIM * local_sz, 0.0);
 
-    for (unsigned int k = 0; k < local_sz; ++k)
+    // NOTE: Each rod writes only to its own entries of the temporary arrays, so
+    // the rods may be processed concurrently.
+    const int num_rods = static_cast<int>(local_sz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (d_use_threaded_force_computation)
+#endif
+    for (int k = 0; k < num_rods; ++k)
     {
         // Compute the forces applied by the rod to the "current" and "next"
         // nodes.
@@ -533,7 +539,8 @@ IBKirchhoffRodForceGen::getFromInput(Pointer<Database> db)
 {
     if (db)
     {
-        // intentionally blank
+        if (db->keyExists("use_threaded_force_computation"))
+            d_use_threaded_force_computation = db->getBool("use_threaded_force_computation");
     }
     return;
 } // getFromInput
@@ -87,6 +87,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/PETScMatUtilities.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -177,6 +178,8 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setNodeOrdering(d_lnode_ordering);
+    d_l_data_manager->setUseIncrementalRedistribution(d_incremental_lag_redistribution);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -2024,6 +2027,21 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("lnode_ordering"))
+    {
+        d_lnode_ordering = string_to_enum<LNodeOrderingType>(db->getString("lnode_ordering"));
+        if (d_lnode_ordering == UNKNOWN_LNODE_ORDERING_TYPE)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  unsupported Lagrangian node ordering: "
+                                     << db->getString("lnode_ordering")
+                                     << "\n"
+                                     << "  valid choices are: PATCH, MORTON, HILBERT\n");
+        }
+    }
+    if (db->keyExists("incremental_lag_redistribution"))
+        d_incremental_lag_redistribution = db->getBool("incremental_lag_redistribution");
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
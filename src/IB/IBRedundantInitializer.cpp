@@ -35,6 +35,9 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -48,6 +51,7 @@
 #include <vector>
 
 #include "Box.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -56,6 +60,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "boost/math/special_functions/round.hpp"
 #include "boost/multi_array.hpp"
 #include "ibamr/IBAnchorPointSpec.h"
@@ -68,6 +73,8 @@
 #include "ibamr/IBStandardSourceGen.h"
 #include "ibamr/IBTargetPointForceSpec.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/FixedSizedStream.h"
+#include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
 #include "ibtk/LIndexSetData.h"
@@ -76,7 +83,12 @@
 #include "ibtk/LNodeSetData.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/Streamable.h"
+#include "ibtk/StreamableManager.h"
 #include "ibtk/ibtk_utilities.h"
+#include "mpi.h"
+#include "petscsys.h"
+#include "tbox/AbstractStream.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -94,6 +106,86 @@ class LDataManager;
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The MPI tag number used to exchange distributed vertex data.  The value is
+// distinct from the tags used by the Lagrangian data writers.
+static const int VERTEX_DATA_MPI_TAG = 1001;
+
+// Append values to a byte buffer.
+template <typename T>
+inline void
+pack_values(std::vector<char>& buffer, const T* const data, const int n)
+{
+    const char* const bytes = reinterpret_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + n * sizeof(T));
+    return;
+} // pack_values
+
+// Extract values from a byte buffer and return the position following them.
+template <typename T>
+inline const char*
+unpack_values(const char* const buffer, T* const data, const int n)
+{
+    std::memcpy(data, buffer, n * sizeof(T));
+    return buffer + n * sizeof(T);
+} // unpack_values
+
+// Restrict per-vertex data to the range of locally stored vertices, unless the
+// data have already been restricted.
+template <typename T>
+inline void
+restrict_to_local_range(std::vector<T>& data, const int num_vertex, const std::pair<int, int>& range)
+{
+    if (static_cast<int>(data.size()) != num_vertex) return;
+    std::vector<T>(data.begin() + range.first, data.begin() + range.second).swap(data);
+    return;
+} // restrict_to_local_range
+
+// Shift a position into the physical domain along periodic directions.
+inline Point
+shift_vertex_posn(Point X,
+                  const double* const domain_x_lower,
+                  const double* const domain_x_upper,
+                  const IntVector<NDIM>& periodic_shift)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift[d])
+        {
+            double domain_length = domain_x_upper[d] - domain_x_lower[d];
+            while (X[d] < domain_x_lower[d]) X[d] += domain_length;
+            while (X[d] >= domain_x_upper[d]) X[d] -= domain_length;
+            TBOX_ASSERT(X[d] >= domain_x_lower[d] && X[d] < domain_x_upper[d]);
+            X[d] = std::max(X[d], domain_x_lower[d]);
+            X[d] = std::min(X[d], domain_x_upper[d] - std::numeric_limits<double>::epsilon());
+        }
+    }
+    return X;
+} // shift_vertex_posn
+
+// Remove the entries of a map for which the predicate is true.
+template <typename Map, typename Predicate>
+inline void
+erase_if(Map& map, const Predicate& pred)
+{
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (pred(*it))
+        {
+            it = map.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return;
+} // erase_if
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBRedundantInitializer::IBRedundantInitializer(std::string object_name, Pointer<Database> input_db)
@@ -190,6 +282,24 @@ IBRedundantInitializer::computeLocalNodeCountOnPatchLevel(const Pointer<PatchHie
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_data_processed);
 #endif
+    // When structure data are distributed, count the vertices sent to this
+    // process.
+    if (d_distribute_structure_data)
+    {
+        PatchVertexData patch_vertex_data;
+        exchangePatchVertexData(patch_vertex_data,
+                                hierarchy,
+                                level_number,
+                                level_number,
+                                [](const std::pair<int, int>& /*point_index*/, std::vector<char>& /*buffer*/) {});
+        int local_node_count = 0;
+        for (const auto& patch_data : patch_vertex_data)
+        {
+            local_node_count += patch_data.second.size();
+        }
+        return local_node_count;
+    }
+
     // Determine the extents of the physical domain.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
 
@@ -960,6 +1070,30 @@ IBRedundantInitializer::initializeDataOnPatchLevel(const int lag_node_index_idx,
     // indices that have already been initialized on the specified level.
     d_global_index_offset[level_number] = global_index_offset;
 
+    // When structure data are distributed, send the position and specification
+    // objects of each vertex to the process that will own it.
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+    PatchVertexData patch_vertex_data;
+    if (d_distribute_structure_data)
+    {
+        exchangePatchVertexData(
+            patch_vertex_data,
+            hierarchy,
+            level_number,
+            level_number,
+            [&](const std::pair<int, int>& point_index, std::vector<char>& buffer) {
+                const Point X_real = getVertexPosn(point_index, level_number);
+                std::vector<Pointer<Streamable> > node_data =
+                    initializeNodeData(point_index, global_index_offset, level_number);
+                FixedSizedStream stream(static_cast<int>(AbstractStream::sizeofDouble() * NDIM +
+                                                         streamable_manager->getDataStreamSize(node_data)));
+                stream.pack(X_real.data(), NDIM);
+                streamable_manager->packStream(stream, node_data);
+                const char* const bytes = static_cast<const char*>(stream.getBufferStart());
+                buffer.insert(buffer.end(), bytes, bytes + stream.getCurrentSize());
+            });
+    }
+
     // Loop over all patches in the specified level of the patch level and
     // initialize the local vertices.
     boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
@@ -977,20 +1111,47 @@ IBRedundantInitializer::initializeDataOnPatchLevel(const int lag_node_index_idx,
 
         Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
 
+        // Determine the vertices whose initial locations will be within the
+        // given patch, along with their positions and specification objects.
+        std::vector<std::pair<int, int> > patch_vertices;
+        std::vector<Point> patch_vertex_posns;
+        std::vector<std::vector<Pointer<Streamable> > > patch_node_data;
+        if (d_distribute_structure_data)
+        {
+            for (const auto& vertex_data : patch_vertex_data[p()])
+            {
+                patch_vertices.push_back(vertex_data.first);
+                FixedSizedStream stream(vertex_data.second.data(), static_cast<int>(vertex_data.second.size()));
+                Point X_real;
+                stream.unpack(X_real.data(), NDIM);
+                patch_vertex_posns.push_back(X_real);
+                patch_node_data.push_back(std::vector<Pointer<Streamable> >());
+                streamable_manager->unpackStream(stream, IntVector<NDIM>(0), patch_node_data.back());
+            }
+        }
+        else
+        {
+            getPatchVertices(patch_vertices, patch, hierarchy);
+            for (const auto& point_idx : patch_vertices)
+            {
+                patch_vertex_posns.push_back(getVertexPosn(point_idx, level_number));
+                patch_node_data.push_back(initializeNodeData(point_idx, global_index_offset, level_number));
+            }
+        }
+
         // Initialize the vertices whose initial locations will be within the
         // given patch.
-        std::vector<std::pair<int, int> > patch_vertices;
-        getPatchVertices(patch_vertices, patch, hierarchy);
         local_node_count += patch_vertices.size();
-        for (const auto& point_idx : patch_vertices)
+        for (unsigned int v = 0; v < patch_vertices.size(); ++v)
         {
+            const std::pair<int, int>& point_idx = patch_vertices[v];
             const int lagrangian_idx = getCanonicalLagrangianIndex(point_idx, level_number) + global_index_offset;
             const int local_petsc_idx = ++local_idx + local_index_offset;
             const int global_petsc_idx = local_petsc_idx + global_index_offset;
 
             // Get the coordinates and periodic shifters of the present vertex.
-            Point X_real = getVertexPosn(point_idx, level_number);
-            Point X = getShiftedVertexPosn(point_idx, level_number, domain_x_lower, domain_x_upper, periodic_shift);
+            const Point& X_real = patch_vertex_posns[v];
+            Point X = shift_vertex_posn(X_real, domain_x_lower, domain_x_upper, periodic_shift);
             Vector periodic_displacement = X_real - X;
             IntVector<NDIM> periodic_offset;
             for (int d = 0; d < NDIM; ++d)
@@ -1033,8 +1194,7 @@ IBRedundantInitializer::initializeDataOnPatchLevel(const int lag_node_index_idx,
 
             // Initialize the specification objects associated with the present
             // vertex.
-            std::vector<Pointer<Streamable> > node_data =
-                initializeNodeData(point_idx, global_index_offset, level_number);
+            const std::vector<Pointer<Streamable> >& node_data = patch_node_data[v];
             for (const auto& node : node_data)
             {
                 node->registerPeriodicShift(periodic_offset, periodic_displacement);
@@ -1094,6 +1254,22 @@ IBRedundantInitializer::initializeMassDataOnPatchLevel(const unsigned int /*glob
     // Determine the extents of the physical domain.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
 
+    // When structure data are distributed, send the mass data of each vertex
+    // to the process that owns it.
+    PatchVertexData patch_vertex_data;
+    if (d_distribute_structure_data)
+    {
+        exchangePatchVertexData(patch_vertex_data,
+                                hierarchy,
+                                level_number,
+                                level_number,
+                                [&](const std::pair<int, int>& point_index, std::vector<char>& buffer) {
+                                    const BdryMassSpec& spec = getVertexBdryMassSpec(point_index, level_number);
+                                    const double data[2] = { spec.bdry_mass, spec.stiffness };
+                                    pack_values(buffer, data, 2);
+                                });
+    }
+
     // Loop over all patches in the specified level of the patch level and
     // initialize the local vertices.
     boost::multi_array_ref<double, 1>& M_array = *M_data->getLocalFormArray();
@@ -1105,18 +1281,40 @@ IBRedundantInitializer::initializeMassDataOnPatchLevel(const unsigned int /*glob
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
 
+        // Determine the mass data of the vertices whose initial locations will
+        // be within the given patch.
+        std::vector<BdryMassSpec> patch_specs;
+        if (d_distribute_structure_data)
+        {
+            for (const auto& vertex_data : patch_vertex_data[p()])
+            {
+                double data[2];
+                unpack_values(vertex_data.second.data(), data, 2);
+                BdryMassSpec spec;
+                spec.bdry_mass = data[0];
+                spec.stiffness = data[1];
+                patch_specs.push_back(spec);
+            }
+        }
+        else
+        {
+            std::vector<std::pair<int, int> > patch_vertices;
+            getPatchVertices(patch_vertices, patch, hierarchy);
+            for (const auto& point_idx : patch_vertices)
+            {
+                patch_specs.push_back(getVertexBdryMassSpec(point_idx, level_number));
+            }
+        }
+
         // Initialize the vertices whose initial locations will be within the
         // given patch.
-        std::vector<std::pair<int, int> > patch_vertices;
-        getPatchVertices(patch_vertices, patch, hierarchy);
-        local_node_count += patch_vertices.size();
-        for (const auto& point_idx : patch_vertices)
+        local_node_count += patch_specs.size();
+        for (const auto& spec : patch_specs)
         {
             const int local_petsc_idx = ++local_idx + local_index_offset;
 
             // Initialize the mass and penalty stiffness coefficient
             // corresponding to the present vertex.
-            const BdryMassSpec& spec = getVertexBdryMassSpec(point_idx, level_number);
             const double M = spec.bdry_mass;
             const double K = spec.stiffness;
 
@@ -1156,6 +1354,20 @@ IBRedundantInitializer::initializeDirectorDataOnPatchLevel(const unsigned int /*
     // Determine the extents of the physical domain.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
 
+    // When structure data are distributed, send the directors of each vertex
+    // to the process that owns it.
+    PatchVertexData patch_vertex_data;
+    if (d_distribute_structure_data)
+    {
+        exchangePatchVertexData(patch_vertex_data,
+                                hierarchy,
+                                level_number,
+                                level_number,
+                                [&](const std::pair<int, int>& point_index, std::vector<char>& buffer) {
+                                    pack_values(buffer, getVertexDirectors(point_index, level_number).data(), 3 * 3);
+                                });
+    }
+
     // Loop over all patches in the specified level of the patch level and
     // initialize the local vertices.
     boost::multi_array_ref<double, 2>& D_array = *D_data->getLocalFormVecArray();
@@ -1166,17 +1378,35 @@ IBRedundantInitializer::initializeDirectorDataOnPatchLevel(const unsigned int /*
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
 
+        // Determine the directors of the vertices whose initial locations will
+        // be within the given patch.
+        std::vector<std::vector<double> > patch_directors;
+        if (d_distribute_structure_data)
+        {
+            for (const auto& vertex_data : patch_vertex_data[p()])
+            {
+                patch_directors.push_back(std::vector<double>(3 * 3));
+                unpack_values(vertex_data.second.data(), patch_directors.back().data(), 3 * 3);
+            }
+        }
+        else
+        {
+            std::vector<std::pair<int, int> > patch_vertices;
+            getPatchVertices(patch_vertices, patch, hierarchy);
+            for (const auto& point_idx : patch_vertices)
+            {
+                patch_directors.push_back(getVertexDirectors(point_idx, level_number));
+            }
+        }
+
         // Initialize the vertices whose initial locations will be within the
         // given patch.
-        std::vector<std::pair<int, int> > patch_vertices;
-        getPatchVertices(patch_vertices, patch, hierarchy);
-        local_node_count += patch_vertices.size();
-        for (const auto& point_idx : patch_vertices)
+        local_node_count += patch_directors.size();
+        for (const auto& D : patch_directors)
         {
             const int local_petsc_idx = ++local_idx + local_index_offset;
 
             // Initialize the director corresponding to the present vertex.
-            const std::vector<double>& D = getVertexDirectors(point_idx, level_number);
             for (int d = 0; d < 3 * 3; ++d)
             {
                 D_array[local_petsc_idx][d] = D[d];
@@ -1208,6 +1438,42 @@ IBRedundantInitializer::tagCellsForInitialRefinement(const Pointer<PatchHierarch
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     const IntVector<NDIM>& ratio = level->getRatio();
     const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
+
+    // When structure data are distributed, send the positions of the vertices
+    // on the finer levels to the processes that own the patches that contain
+    // them.
+    if (d_distribute_structure_data)
+    {
+        for (int ln = level_number + 1; ln < d_max_levels; ++ln)
+        {
+            PatchVertexData patch_vertex_data;
+            exchangePatchVertexData(
+                patch_vertex_data,
+                hierarchy,
+                level_number,
+                ln,
+                [&](const std::pair<int, int>& point_index, std::vector<char>& buffer) {
+                    const Point X =
+                        getShiftedVertexPosn(point_index, ln, domain_x_lower, domain_x_upper, periodic_shift);
+                    pack_values(buffer, X.data(), NDIM);
+                });
+            for (const auto& patch_data : patch_vertex_data)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(patch_data.first);
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+                for (const auto& vertex_data : patch_data.second)
+                {
+                    Point X;
+                    unpack_values(vertex_data.second.data(), X.data(), NDIM);
+                    const CellIndex<NDIM> i = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+                    if (patch_box.contains(i)) (*tag_data)(i) = 1;
+                }
+            }
+        }
+        return;
+    }
+
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -1271,6 +1537,9 @@ IBRedundantInitializer::init()
         initializeAnchorPts();
         initializeInstrumentationData();
         initializeSourceData();
+
+        // Discard the structure data that are not stored on this process.
+        if (d_distribute_structure_data) distributeStructureData();
     }
 
     // Indicate that we have processed data.
@@ -1316,6 +1585,17 @@ IBRedundantInitializer::initializeLSiloDataWriter(const int level_number)
             }
         }
 
+        // Connectivity data are not available on any single process when
+        // structure data are distributed.
+        if (d_distribute_structure_data)
+        {
+            TBOX_WARNING(d_object_name << "::initializeLSiloDataWriter():\n"
+                                       << "  structure data are distributed; spring, crosslink spring, and rod meshes "
+                                          "on level "
+                                       << level_number << " will not be written to Silo files.\n");
+            return;
+        }
+
         bool registered_spring_edge_map = false;
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
@@ -1412,7 +1692,7 @@ IBRedundantInitializer::getCanonicalLagrangianIndex(const std::pair<int, int>& p
 Point
 IBRedundantInitializer::getVertexPosn(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_vertex_posn[level_number][point_index.first][point_index.second];
+    return d_vertex_posn[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexPosn
 
 Point
@@ -1422,44 +1702,31 @@ IBRedundantInitializer::getShiftedVertexPosn(const std::pair<int, int>& point_in
                                              const double* const domain_x_upper,
                                              const IntVector<NDIM>& periodic_shift) const
 {
-    Point X = getVertexPosn(point_index, level_number);
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        if (periodic_shift[d])
-        {
-            double domain_length = domain_x_upper[d] - domain_x_lower[d];
-            while (X[d] < domain_x_lower[d]) X[d] += domain_length;
-            while (X[d] >= domain_x_upper[d]) X[d] -= domain_length;
-            TBOX_ASSERT(X[d] >= domain_x_lower[d] && X[d] < domain_x_upper[d]);
-            X[d] = std::max(X[d], domain_x_lower[d]);
-            X[d] = std::min(X[d], domain_x_upper[d] - std::numeric_limits<double>::epsilon());
-        }
-    }
-    return X;
+    return shift_vertex_posn(getVertexPosn(point_index, level_number), domain_x_lower, domain_x_upper, periodic_shift);
 } // getShiftedVertexPosn
 
 const IBRedundantInitializer::TargetSpec&
 IBRedundantInitializer::getVertexTargetSpec(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_target_spec_data[level_number][point_index.first][point_index.second];
+    return d_target_spec_data[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexTargetSpec
 
 const IBRedundantInitializer::AnchorSpec&
 IBRedundantInitializer::getVertexAnchorSpec(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_anchor_spec_data[level_number][point_index.first][point_index.second];
+    return d_anchor_spec_data[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexAnchorSpec
 
 const IBRedundantInitializer::BdryMassSpec&
 IBRedundantInitializer::getVertexBdryMassSpec(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_bdry_mass_spec_data[level_number][point_index.first][point_index.second];
+    return d_bdry_mass_spec_data[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexBdryMassSpec
 
 const std::vector<double>&
 IBRedundantInitializer::getVertexDirectors(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_directors[level_number][point_index.first][point_index.second];
+    return d_directors[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexDirectors
 
 std::pair<int, int>
@@ -1491,6 +1758,238 @@ IBRedundantInitializer::getVertexSourceIndices(const std::pair<int, int>& point_
     }
 } // getVertexSourceIndices
 
+std::pair<int, int>
+IBRedundantInitializer::getLocalVertexRange(const int level_number, const int j) const
+{
+    const std::int64_t num_vertex = d_num_vertex[level_number][j];
+    if (!d_distribute_structure_data) return std::make_pair(0, static_cast<int>(num_vertex));
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    return std::make_pair(static_cast<int>((num_vertex * rank) / nodes),
+                          static_cast<int>((num_vertex * (rank + 1)) / nodes));
+} // getLocalVertexRange
+
+int
+IBRedundantInitializer::getVertexOwner(const int level_number, const int j, const int k) const
+{
+    const std::int64_t num_vertex = d_num_vertex[level_number][j];
+    const int nodes = SAMRAI_MPI::getNodes();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= k && k < num_vertex);
+#endif
+    // The owner is the highest ranked process whose range of vertices begins at
+    // or before the specified vertex.
+    int owner = static_cast<int>((k * static_cast<std::int64_t>(nodes)) / num_vertex);
+    while (owner + 1 < nodes && (num_vertex * (owner + 1)) / nodes <= k) ++owner;
+    return owner;
+} // getVertexOwner
+
+int
+IBRedundantInitializer::getLocalVertexIndex(const std::pair<int, int>& point_index, const int level_number) const
+{
+    if (!d_distribute_structure_data) return point_index.second;
+#if !defined(NDEBUG)
+    const std::pair<int, int> range = getLocalVertexRange(level_number, point_index.first);
+    TBOX_ASSERT(range.first <= point_index.second && point_index.second < range.second);
+#endif
+    return point_index.second - d_local_vertex_begin[level_number][point_index.first];
+} // getLocalVertexIndex
+
+void
+IBRedundantInitializer::distributeStructureData()
+{
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        // Determine the range of Lagrangian indices of the locally stored
+        // vertices of each structure.
+        const size_t num_strcts = d_num_vertex[ln].size();
+        std::vector<std::pair<int, int> > local_idx_range(num_strcts);
+        d_local_vertex_begin[ln].resize(num_strcts);
+        for (unsigned int j = 0; j < num_strcts; ++j)
+        {
+            const std::pair<int, int> range = getLocalVertexRange(ln, j);
+            d_local_vertex_begin[ln][j] = range.first;
+            local_idx_range[j] = std::make_pair(d_vertex_offset[ln][j] + range.first,
+                                                d_vertex_offset[ln][j] + range.second);
+        }
+        const auto is_local = [&](const int lag_idx) {
+            const auto it = std::upper_bound(d_vertex_offset[ln].begin(), d_vertex_offset[ln].end(), lag_idx);
+            if (it == d_vertex_offset[ln].begin()) return false;
+            const std::pair<int, int>& range = local_idx_range[std::distance(d_vertex_offset[ln].begin(), it) - 1];
+            return range.first <= lag_idx && lag_idx < range.second;
+        };
+        const auto is_nonlocal_master = [&](const std::pair<const int, Edge>& entry) { return !is_local(entry.first); };
+        const auto is_nonlocal_edge = [&](const std::pair<const Edge, SpringSpec>& entry) {
+            return !is_local(entry.first.first) && !is_local(entry.first.second);
+        };
+
+        for (unsigned int j = 0; j < num_strcts; ++j)
+        {
+            const int num_vertex = d_num_vertex[ln][j];
+            const std::pair<int, int> range = getLocalVertexRange(ln, j);
+            const auto is_nonlocal_vertex = [&](const int k) { return k < range.first || k >= range.second; };
+
+            // Per-vertex data are kept only for the local vertices.
+            restrict_to_local_range(d_vertex_posn[ln][j], num_vertex, range);
+            restrict_to_local_range(d_target_spec_data[ln][j], num_vertex, range);
+            restrict_to_local_range(d_anchor_spec_data[ln][j], num_vertex, range);
+            restrict_to_local_range(d_bdry_mass_spec_data[ln][j], num_vertex, range);
+            restrict_to_local_range(d_directors[ln][j], num_vertex, range);
+            erase_if(d_instrument_idx[ln][j], [&](const std::pair<const int, std::pair<int, int> >& entry) {
+                return is_nonlocal_vertex(entry.first);
+            });
+            erase_if(d_source_idx[ln][j],
+                     [&](const std::pair<const int, int>& entry) { return is_nonlocal_vertex(entry.first); });
+
+            // Connectivity data are kept for the local master vertices, and
+            // material properties are kept for any edge with a local vertex.
+            erase_if(d_spring_edge_map[ln][j], is_nonlocal_master);
+            erase_if(d_spring_spec_data[ln][j], is_nonlocal_edge);
+            erase_if(d_xspring_edge_map[ln][j], is_nonlocal_master);
+            erase_if(d_xspring_spec_data[ln][j], [&](const std::pair<const Edge, XSpringSpec>& entry) {
+                return !is_local(entry.first.first) && !is_local(entry.first.second);
+            });
+            erase_if(d_beam_spec_data[ln][j],
+                     [&](const std::pair<const int, BeamSpec>& entry) { return !is_local(entry.first); });
+            erase_if(d_rod_edge_map[ln][j], is_nonlocal_master);
+            erase_if(d_rod_spec_data[ln][j], [&](const std::pair<const Edge, RodSpec>& entry) {
+                return !is_local(entry.first.first) && !is_local(entry.first.second);
+            });
+        }
+    }
+    return;
+} // distributeStructureData
+
+void
+IBRedundantInitializer::exchangePatchVertexData(PatchVertexData& patch_vertex_data,
+                                                const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                const int level_number,
+                                                const int vertex_level_number,
+                                                const VertexDataPacker& pack_vertex_data) const
+{
+    const int rank = SAMRAI_MPI::getRank();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    int ierr;
+
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    const Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
+    const ProcessorMapping& proc_mapping = level->getProcessorMapping();
+
+    // Pack the data associated with each locally stored vertex into a message
+    // for the process that owns the patch that contains that vertex.  Each
+    // entry consists of the patch number, the vertex index, the size of the
+    // packed data, and the packed data.
+    std::map<int, std::vector<char> > send_buffers;
+    std::vector<char> vertex_data;
+    for (unsigned int j = 0; j < d_num_vertex[vertex_level_number].size(); ++j)
+    {
+        const std::pair<int, int> range = getLocalVertexRange(vertex_level_number, j);
+        for (int k = range.first; k < range.second; ++k)
+        {
+            const std::pair<int, int> point_index(j, k);
+            const Point X =
+                getShiftedVertexPosn(point_index, vertex_level_number, domain_x_lower, domain_x_upper, periodic_shift);
+            const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+            Array<int> patch_num_arr;
+            level->getBoxTree()->findOverlapIndices(patch_num_arr, Box<NDIM>(idx, idx));
+            if (patch_num_arr.size() == 0) continue;
+            const int patch_num = patch_num_arr[0];
+            vertex_data.clear();
+            pack_vertex_data(point_index, vertex_data);
+            const int header[4] = { patch_num, static_cast<int>(j), k, static_cast<int>(vertex_data.size()) };
+            std::vector<char>& buffer = send_buffers[proc_mapping.getProcessorAssignment(patch_num)];
+            pack_values(buffer, header, 4);
+            buffer.insert(buffer.end(), vertex_data.begin(), vertex_data.end());
+        }
+    }
+    std::vector<PetscMPIInt> dest_ranks;
+    std::vector<int> send_sizes;
+    for (const auto& send_buffer : send_buffers)
+    {
+        if (send_buffer.first == rank) continue;
+        dest_ranks.push_back(send_buffer.first);
+        send_sizes.push_back(static_cast<int>(send_buffer.second.size()));
+    }
+
+    // Determine which processes will send data to this process, and the
+    // amount of data that each will send.
+    PetscMPIInt num_sources;
+    PetscMPIInt* source_ranks;
+    int* recv_sizes;
+    ierr = PetscCommBuildTwoSided(communicator,
+                                  1,
+                                  MPI_INT,
+                                  static_cast<PetscMPIInt>(dest_ranks.size()),
+                                  dest_ranks.data(),
+                                  send_sizes.data(),
+                                  &num_sources,
+                                  &source_ranks,
+                                  &recv_sizes);
+    IBTK_CHKERRQ(ierr);
+
+    // Exchange the messages.
+    std::vector<std::vector<char> > recv_buffers(num_sources);
+    std::vector<MPI_Request> requests;
+    for (int k = 0; k < num_sources; ++k)
+    {
+        recv_buffers[k].resize(recv_sizes[k]);
+        requests.push_back(MPI_REQUEST_NULL);
+        MPI_Irecv(recv_buffers[k].data(),
+                  recv_sizes[k],
+                  MPI_CHAR,
+                  source_ranks[k],
+                  VERTEX_DATA_MPI_TAG,
+                  communicator,
+                  &requests.back());
+    }
+    for (unsigned int k = 0; k < dest_ranks.size(); ++k)
+    {
+        requests.push_back(MPI_REQUEST_NULL);
+        MPI_Isend(send_buffers[dest_ranks[k]].data(),
+                  send_sizes[k],
+                  MPI_CHAR,
+                  dest_ranks[k],
+                  VERTEX_DATA_MPI_TAG,
+                  communicator,
+                  &requests.back());
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    ierr = PetscFree(source_ranks);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscFree(recv_sizes);
+    IBTK_CHKERRQ(ierr);
+    if (send_buffers.count(rank)) recv_buffers.push_back(std::move(send_buffers[rank]));
+
+    // Unpack the vertex data and sort the vertices in each patch into canonical
+    // order, so that the result is the same as for replicated structure data.
+    patch_vertex_data.clear();
+    for (const auto& buffer : recv_buffers)
+    {
+        const char* pos = buffer.data();
+        const char* const end = pos + buffer.size();
+        while (pos < end)
+        {
+            int header[4];
+            pos = unpack_values(pos, header, 4);
+            patch_vertex_data[header[0]].emplace_back(std::make_pair(header[1], header[2]),
+                                                      std::vector<char>(pos, pos + header[3]));
+            pos += header[3];
+        }
+    }
+    for (auto& patch_data : patch_vertex_data)
+    {
+        std::sort(patch_data.second.begin(),
+                  patch_data.second.end(),
+                  [](const std::pair<std::pair<int, int>, std::vector<char> >& a,
+                     const std::pair<std::pair<int, int>, std::vector<char> >& b) { return a.first < b.first; });
+    }
+    return;
+} // exchangePatchVertexData
+
 std::vector<Pointer<Streamable> >
 IBRedundantInitializer::initializeNodeData(const std::pair<int, int>& point_index,
                                            const unsigned int global_index_offset,
@@ -1700,6 +2199,10 @@ IBRedundantInitializer::getFromInput(Pointer<Database> db)
     d_source_idx.resize(d_max_levels);
 
     d_global_index_offset.resize(d_max_levels);
+    d_local_vertex_begin.resize(d_max_levels);
+
+    if (db->keyExists("distribute_structure_data"))
+        d_distribute_structure_data = db->getBool("distribute_structure_data");
 
     // Determine the various input file names.
     //
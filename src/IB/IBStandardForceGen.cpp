@@ -120,6 +120,138 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+// The number of springs, beams, or target points for which forces are computed
+// at once.
+static const int FORCE_BLOCK_SIZE = 64;
+
+template <class T>
+void
+permuteVector(std::vector<T>& v, const std::vector<int>& perm)
+{
+    const std::vector<T> v_copy(v);
+    for (std::size_t k = 0; k < perm.size(); ++k)
+    {
+        v[k] = v_copy[perm[k]];
+    }
+    return;
+} // permuteVector
+
+// Compute the forces generated by springs that use default_spring_force().
+// The force generated by spring k is stored in F[NDIM * k], ..., F[NDIM * k +
+// NDIM - 1].
+//
+// There are no dependencies between springs, so this loop may be vectorized.
+// Springs with zero resting lengths do not require the spring length to be
+// computed.
+template <bool ZERO_REST_LENGTH>
+void
+computeDefaultSpringForces(double* const F,
+                           const double* const X_node,
+                           const int* const petsc_mastr_node_idxs,
+                           const int* const petsc_slave_node_idxs,
+                           const double* const stiffnesses,
+                           const double* const rest_lengths,
+                           const int num_springs)
+{
+    const double eps = std::numeric_limits<double>::epsilon();
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (int k = 0; k < num_springs; ++k)
+    {
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int slave_idx = petsc_slave_node_idxs[k];
+        double D[NDIM], R2 = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            D[d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+            R2 += D[d] * D[d];
+        }
+        double T_over_R;
+        if (ZERO_REST_LENGTH)
+        {
+            T_over_R = R2 < eps * eps ? 0.0 : stiffnesses[k];
+        }
+        else
+        {
+            const double R = std::sqrt(R2);
+            T_over_R = R < eps ? 0.0 : stiffnesses[k] * (R - rest_lengths[k]) / R;
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F[NDIM * k + d] = T_over_R * D[d];
+        }
+    }
+    return;
+} // computeDefaultSpringForces
+
+// Compute the forces generated by springs that use user-specified force
+// functions.
+void
+computeUserSpringForces(double* const F,
+                        const double* const X_node,
+                        const int* const petsc_mastr_node_idxs,
+                        const int* const petsc_slave_node_idxs,
+                        const int* const lag_mastr_node_idxs,
+                        const int* const lag_slave_node_idxs,
+                        const SpringForceFcnPtr* const force_fcns,
+                        const double* const* const parameters,
+                        const int num_springs)
+{
+    for (int k = 0; k < num_springs; ++k)
+    {
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int slave_idx = petsc_slave_node_idxs[k];
+        double D[NDIM], R2 = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            D[d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+            R2 += D[d] * D[d];
+        }
+        const double R = std::sqrt(R2);
+        double T_over_R = 0.0;
+        if (LIKELY(R >= std::numeric_limits<double>::epsilon()))
+        {
+            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F[NDIM * k + d] = T_over_R * D[d];
+        }
+    }
+    return;
+} // computeUserSpringForces
+
+// Compute the forces generated by beams.  The force associated with beam k is
+// stored in F[NDIM * k], ..., F[NDIM * k + NDIM - 1].
+void
+computeBeamForces(double* const F,
+                  const double* const X_node,
+                  const int* const petsc_mastr_node_idxs,
+                  const int* const petsc_next_node_idxs,
+                  const int* const petsc_prev_node_idxs,
+                  const double* const rigidities,
+                  const double* const curvatures,
+                  const int num_beams)
+{
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (int k = 0; k < num_beams; ++k)
+    {
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int next_idx = petsc_next_node_idxs[k];
+        const int prev_idx = petsc_prev_node_idxs[k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F[NDIM * k + d] = rigidities[k] * (X_node[next_idx + d] + X_node[prev_idx + d] -
+                                               2.0 * X_node[mastr_idx + d] - curvatures[NDIM * k + d]);
+        }
+    }
+    return;
+} // computeBeamForces
+
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -134,6 +266,8 @@ IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("use_threaded_force_computation"))
+            d_use_threaded_force_computation = input_db->getBool("use_threaded_force_computation");
     }
     return;
 } // IBStandardForceGen
@@ -280,6 +414,21 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
                    d_target_point_data[level_number].petsc_global_node_idxs.begin(),
                    std::bind2nd(std::multiplies<int>(), NDIM));
 
+    // Determine the order in which the spring and beam forces are summed when
+    // the force computations are multithreaded.
+    if (d_use_threaded_force_computation)
+    {
+        const SpringData& spring_data = d_spring_data[level_number];
+        buildForceGatherList(d_spring_data[level_number].gather_list,
+                             { &spring_data.petsc_mastr_node_idxs, &spring_data.petsc_slave_node_idxs },
+                             { +1.0, -1.0 });
+        const BeamData& beam_data = d_beam_data[level_number];
+        buildForceGatherList(
+            d_beam_data[level_number].gather_list,
+            { &beam_data.petsc_mastr_node_idxs, &beam_data.petsc_next_node_idxs, &beam_data.petsc_prev_node_idxs },
+            { +2.0, -1.0, -1.0 });
+    }
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -745,6 +894,88 @@ IBStandardForceGen::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IBStandardForceGen::buildForceGatherList(ForceGatherList& gather_list,
+                                         const std::vector<const std::vector<int>*>& element_node_idxs,
+                                         const std::vector<double>& node_weights)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(element_node_idxs.size() == node_weights.size());
+#endif
+    // Collect the contributions of all elements to all nodes and sort them by
+    // node index and then by element index.
+    struct Contribution
+    {
+        int node_idx, element_force_idx;
+        double weight;
+    };
+    std::vector<Contribution> contributions;
+    for (unsigned int j = 0; j < element_node_idxs.size(); ++j)
+    {
+        const std::vector<int>& node_idxs = *element_node_idxs[j];
+        for (unsigned int k = 0; k < node_idxs.size(); ++k)
+        {
+            Contribution contribution;
+            contribution.node_idx = node_idxs[k];
+            contribution.element_force_idx = NDIM * k;
+            contribution.weight = node_weights[j];
+            contributions.push_back(contribution);
+        }
+    }
+    std::stable_sort(contributions.begin(), contributions.end(), [](const Contribution& a, const Contribution& b) {
+        return a.node_idx < b.node_idx || (a.node_idx == b.node_idx && a.element_force_idx < b.element_force_idx);
+    });
+
+    // Store the contributions in compressed row form.
+    gather_list.node_idxs.clear();
+    gather_list.offsets.clear();
+    gather_list.element_force_idxs.resize(contributions.size());
+    gather_list.weights.resize(contributions.size());
+    for (unsigned int j = 0; j < contributions.size(); ++j)
+    {
+        if (j == 0 || contributions[j].node_idx != contributions[j - 1].node_idx)
+        {
+            gather_list.node_idxs.push_back(contributions[j].node_idx);
+            gather_list.offsets.push_back(j);
+        }
+        gather_list.element_force_idxs[j] = contributions[j].element_force_idx;
+        gather_list.weights[j] = contributions[j].weight;
+    }
+    gather_list.offsets.push_back(static_cast<int>(contributions.size()));
+    return;
+} // buildForceGatherList
+
+void
+IBStandardForceGen::accumulateForces(double* const F_node,
+                                     const std::vector<double>& element_forces,
+                                     const ForceGatherList& gather_list)
+{
+    const int num_nodes = static_cast<int>(gather_list.node_idxs.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_nodes; ++i)
+    {
+        double F[NDIM];
+        std::fill(F, F + NDIM, 0.0);
+        for (int j = gather_list.offsets[i]; j < gather_list.offsets[i + 1]; ++j)
+        {
+            const double w = gather_list.weights[j];
+            const double* const F_element = &element_forces[gather_list.element_force_idxs[j]];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                F[d] += w * F_element[d];
+            }
+        }
+        const int idx = gather_list.node_idxs[i];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F_node[idx + d] += F[d];
+        }
+    }
+    return;
+} // accumulateForces
+
 void
 IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_set,
                                               const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
@@ -820,6 +1051,38 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
         }
     }
 
+    // Group the springs by force function so that the springs that use the
+    // default force function can be processed together.
+    std::vector<int> spring_groups(num_springs), spring_perm(num_springs);
+    for (unsigned int k = 0; k < num_springs; ++k)
+    {
+        spring_perm[k] = k;
+        if (force_fcns[k] == &default_spring_force && parameters[k])
+        {
+            spring_groups[k] = parameters[k][1] == 0.0 ? 0 : 1;
+        }
+        else
+        {
+            spring_groups[k] = 2;
+        }
+    }
+    std::stable_sort(spring_perm.begin(), spring_perm.end(), [&spring_groups](const int a, const int b) {
+        return spring_groups[a] < spring_groups[b];
+    });
+    permuteVector(lag_mastr_node_idxs, spring_perm);
+    permuteVector(lag_slave_node_idxs, spring_perm);
+    permuteVector(petsc_mastr_node_idxs, spring_perm);
+    permuteVector(force_fcns, spring_perm);
+    permuteVector(force_deriv_fcns, spring_perm);
+    permuteVector(parameters, spring_perm);
+    d_spring_data[level_number].num_zero_rest_length_springs =
+        static_cast<int>(std::count(spring_groups.begin(), spring_groups.end(), 0));
+    d_spring_data[level_number].num_default_springs =
+        d_spring_data[level_number].num_zero_rest_length_springs +
+        static_cast<int>(std::count(spring_groups.begin(), spring_groups.end(), 1));
+    d_spring_data[level_number].stiffnesses.resize(d_spring_data[level_number].num_default_springs);
+    d_spring_data[level_number].rest_lengths.resize(d_spring_data[level_number].num_default_springs);
+
     // Map the Lagrangian slave node indices to the PETSc indices corresponding
     // to the present data distribution.
     petsc_slave_node_idxs = lag_slave_node_idxs;
@@ -852,110 +1115,129 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const double /*data_time*/,
                                                  LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
-    const bool uses_springs = (num_springs > 0);
-    const int* const lag_mastr_node_idxs = uses_springs ? &d_spring_data[level_number].lag_mastr_node_idxs[0] : nullptr;
-    const int* const lag_slave_node_idxs = uses_springs ? &d_spring_data[level_number].lag_slave_node_idxs[0] : nullptr;
-    const int* const petsc_mastr_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
-    const int* const petsc_slave_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_slave_node_idxs[0] : nullptr;
-    const SpringForceFcnPtr* const force_fcns = uses_springs ? &d_spring_data[level_number].force_fcns[0] : nullptr;
-    const double** const parameters = uses_springs ? &d_spring_data[level_number].parameters[0] : nullptr;
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size());
+    if (num_springs == 0) return;
+    const int num_zero_rest_length_springs = spring_data.num_zero_rest_length_springs;
+    const int num_default_springs = spring_data.num_default_springs;
+    const int* const lag_mastr_node_idxs = &spring_data.lag_mastr_node_idxs[0];
+    const int* const lag_slave_node_idxs = &spring_data.lag_slave_node_idxs[0];
+    const int* const petsc_mastr_node_idxs = &spring_data.petsc_mastr_node_idxs[0];
+    const int* const petsc_slave_node_idxs = &spring_data.petsc_slave_node_idxs[0];
+    const SpringForceFcnPtr* const force_fcns = &spring_data.force_fcns[0];
+    const double** const parameters = &spring_data.parameters[0];
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
-    int k, kblock, kunroll, mastr_idx, slave_idx;
-    double F[NDIM], D[NDIM], R, T_over_R;
-    kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Gather the parameters of the springs that use the default force function.
+    std::vector<double>& stiffnesses = spring_data.stiffnesses;
+    std::vector<double>& rest_lengths = spring_data.rest_lengths;
+    bool zero_rest_lengths = true;
+    for (int k = 0; k < num_default_springs; ++k)
     {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        stiffnesses[k] = parameters[k][0];
+        rest_lengths[k] = parameters[k][1];
+        if (k < num_zero_rest_length_springs) zero_rest_lengths = zero_rest_lengths && rest_lengths[k] == 0.0;
+    }
+
+    // Compute the forces generated by springs [k_begin, k_end), using the
+    // appropriate kernel for each group of springs.
+    //
+    // NOTE: If the resting lengths of the springs in the zero resting length
+    // group have been reset since the springs were grouped, we use the general
+    // kernel for that group.
+    auto compute_spring_forces = [&](double* const F, const int k_begin, const int k_end) {
+        int k_start = k_begin;
+        int k_stop = std::min(k_end, num_zero_rest_length_springs);
+        if (k_start < k_stop)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(parameters[k + 1]);
-            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-            F[0] = T_over_R * D[0];
-            F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-            F[2] = T_over_R * D[2];
-#endif
-            F_node[mastr_idx + 0] += F[0];
-            F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += F[2];
-#endif
-            F_node[slave_idx + 0] -= F[0];
-            F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[slave_idx + 2] -= F[2];
+            if (zero_rest_lengths)
+            {
+                computeDefaultSpringForces<true>(F,
+                                                 X_node,
+                                                 petsc_mastr_node_idxs + k_start,
+                                                 petsc_slave_node_idxs + k_start,
+                                                 &stiffnesses[k_start],
+                                                 &rest_lengths[k_start],
+                                                 k_stop - k_start);
+            }
+            else
+            {
+                computeDefaultSpringForces<false>(F,
+                                                  X_node,
+                                                  petsc_mastr_node_idxs + k_start,
+                                                  petsc_slave_node_idxs + k_start,
+                                                  &stiffnesses[k_start],
+                                                  &rest_lengths[k_start],
+                                                  k_stop - k_start);
+            }
+        }
+        k_start = std::max(k_begin, num_zero_rest_length_springs);
+        k_stop = std::min(k_end, num_default_springs);
+        if (k_start < k_stop)
+        {
+            computeDefaultSpringForces<false>(F + NDIM * (k_start - k_begin),
+                                              X_node,
+                                              petsc_mastr_node_idxs + k_start,
+                                              petsc_slave_node_idxs + k_start,
+                                              &stiffnesses[k_start],
+                                              &rest_lengths[k_start],
+                                              k_stop - k_start);
+        }
+        k_start = std::max(k_begin, num_default_springs);
+        k_stop = k_end;
+        if (k_start < k_stop)
+        {
+            computeUserSpringForces(F + NDIM * (k_start - k_begin),
+                                    X_node,
+                                    petsc_mastr_node_idxs + k_start,
+                                    petsc_slave_node_idxs + k_start,
+                                    lag_mastr_node_idxs + k_start,
+                                    lag_slave_node_idxs + k_start,
+                                    force_fcns + k_start,
+                                    parameters + k_start,
+                                    k_stop - k_start);
+        }
+    };
+
+    if (d_use_threaded_force_computation)
+    {
+        // Compute and store the forces generated by all springs, and then sum
+        // the forces on each node.
+        std::vector<double>& forces = spring_data.forces;
+        forces.resize(NDIM * num_springs);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
 #endif
+        for (int k_block = 0; k_block < num_springs; k_block += FORCE_BLOCK_SIZE)
+        {
+            compute_spring_forces(&forces[NDIM * k_block], k_block, std::min(k_block + FORCE_BLOCK_SIZE, num_springs));
         }
+        accumulateForces(F_node, forces, spring_data.gather_list);
     }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
+    else
     {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        slave_idx = petsc_slave_node_idxs[k];
+        // Compute the forces for blocks of springs, and add the forces for each
+        // block to the nodal forces.
+        double F[NDIM * FORCE_BLOCK_SIZE];
+        for (int k_block = 0; k_block < num_springs; k_block += FORCE_BLOCK_SIZE)
+        {
+            const int num_block_springs = std::min(FORCE_BLOCK_SIZE, num_springs - k_block);
+            compute_spring_forces(F, k_block, k_block + num_block_springs);
+            for (int k = 0; k < num_block_springs; ++k)
+            {
+                const int mastr_idx = petsc_mastr_node_idxs[k_block + k];
+                const int slave_idx = petsc_slave_node_idxs[k_block + k];
 #if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-        T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-        F[0] = T_over_R * D[0];
-        F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-        F[2] = T_over_R * D[2];
-#endif
-        F_node[mastr_idx + 0] += F[0];
-        F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += F[2];
-#endif
-        F_node[slave_idx + 0] -= F[0];
-        F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[slave_idx + 2] -= F[2];
+                TBOX_ASSERT(mastr_idx != slave_idx);
 #endif
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_node[mastr_idx + d] += F[NDIM * k + d];
+                    F_node[slave_idx + d] -= F[NDIM * k + d];
+                }
+            }
+        }
     }
 
     F_data->restoreArrays();
@@ -1076,103 +1358,85 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                const double /*data_time*/,
                                                LDataManager* const /*l_data_manager*/)
 {
-    const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
-    const bool uses_beams = (num_beams > 0);
-    const int* const petsc_mastr_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
-    const int* const petsc_next_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_next_node_idxs[0] : nullptr;
-    const int* const petsc_prev_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_prev_node_idxs[0] : nullptr;
-    const double** const rigidities = uses_beams ? &d_beam_data[level_number].rigidities[0] : nullptr;
-    const Vector** const curvatures = uses_beams ? &d_beam_data[level_number].curvatures[0] : nullptr;
+    BeamData& beam_data = d_beam_data[level_number];
+    const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+    if (num_beams == 0) return;
+    const int* const petsc_mastr_node_idxs = &beam_data.petsc_mastr_node_idxs[0];
+    const int* const petsc_next_node_idxs = &beam_data.petsc_next_node_idxs[0];
+    const int* const petsc_prev_node_idxs = &beam_data.petsc_prev_node_idxs[0];
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
-    double K;
-    const double* D2X0;
-    double F[NDIM];
-    kblock = 0;
-    for (; kblock < (num_beams - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Gather the beam parameters.
+    beam_data.rigidity_values.resize(num_beams);
+    beam_data.curvature_values.resize(NDIM * num_beams);
+    double* const rigidities = &beam_data.rigidity_values[0];
+    double* const curvatures = &beam_data.curvature_values[0];
+    for (int k = 0; k < num_beams; ++k)
     {
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_next_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_prev_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(rigidities + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(curvatures + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        rigidities[k] = *beam_data.rigidities[k];
+        const double* const D2X0 = beam_data.curvatures[k]->data();
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            next_idx = petsc_next_node_idxs[k];
-            prev_idx = petsc_prev_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != next_idx);
-            TBOX_ASSERT(mastr_idx != prev_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(rigidities[k + 1]);
-            PREFETCH_READ_NTA(curvatures[k + 1]);
-            K = *rigidities[k];
-            D2X0 = curvatures[k]->data();
-            F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-            F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-            F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-            F_node[mastr_idx + 0] += 2.0 * F[0];
-            F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-            F_node[next_idx + 0] -= F[0];
-            F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[next_idx + 2] -= F[2];
-#endif
-            F_node[prev_idx + 0] -= F[0];
-            F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[prev_idx + 2] -= F[2];
+            curvatures[NDIM * k + d] = D2X0[d];
+        }
+    }
+
+    if (d_use_threaded_force_computation)
+    {
+        // Compute and store the forces generated by all beams, and then sum
+        // the forces on each node.
+        std::vector<double>& forces = beam_data.forces;
+        forces.resize(NDIM * num_beams);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
 #endif
+        for (int k_block = 0; k_block < num_beams; k_block += FORCE_BLOCK_SIZE)
+        {
+            computeBeamForces(&forces[NDIM * k_block],
+                              X_node,
+                              petsc_mastr_node_idxs + k_block,
+                              petsc_next_node_idxs + k_block,
+                              petsc_prev_node_idxs + k_block,
+                              rigidities + k_block,
+                              curvatures + NDIM * k_block,
+                              std::min(FORCE_BLOCK_SIZE, num_beams - k_block));
         }
+        accumulateForces(F_node, forces, beam_data.gather_list);
     }
-    for (k = kblock * BLOCKSIZE; k < num_beams; ++k)
+    else
     {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        next_idx = petsc_next_node_idxs[k];
-        prev_idx = petsc_prev_node_idxs[k];
+        // Compute the forces for blocks of beams, and add the forces for each
+        // block to the nodal forces.
+        double F[NDIM * FORCE_BLOCK_SIZE];
+        for (int k_block = 0; k_block < num_beams; k_block += FORCE_BLOCK_SIZE)
+        {
+            const int num_block_beams = std::min(FORCE_BLOCK_SIZE, num_beams - k_block);
+            computeBeamForces(F,
+                              X_node,
+                              petsc_mastr_node_idxs + k_block,
+                              petsc_next_node_idxs + k_block,
+                              petsc_prev_node_idxs + k_block,
+                              rigidities + k_block,
+                              curvatures + NDIM * k_block,
+                              num_block_beams);
+            for (int k = 0; k < num_block_beams; ++k)
+            {
+                const int mastr_idx = petsc_mastr_node_idxs[k_block + k];
+                const int next_idx = petsc_next_node_idxs[k_block + k];
+                const int prev_idx = petsc_prev_node_idxs[k_block + k];
 #if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != next_idx);
-        TBOX_ASSERT(mastr_idx != prev_idx);
-#endif
-        K = *rigidities[k];
-        D2X0 = curvatures[k]->data();
-        F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-        F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-        F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-        F_node[mastr_idx + 0] += 2.0 * F[0];
-        F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-        F_node[next_idx + 0] -= F[0];
-        F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[next_idx + 2] -= F[2];
-#endif
-        F_node[prev_idx + 0] -= F[0];
-        F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[prev_idx + 2] -= F[2];
+                TBOX_ASSERT(mastr_idx != next_idx);
+                TBOX_ASSERT(mastr_idx != prev_idx);
 #endif
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_node[mastr_idx + d] += 2.0 * F[NDIM * k + d];
+                    F_node[next_idx + d] -= F[NDIM * k + d];
+                    F_node[prev_idx + d] -= F[NDIM * k + d];
+                }
+            }
+        }
     }
 
     F_data->restoreArrays();
@@ -1243,78 +1507,54 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
 {
     double max_displacement = 0.0;
 
-    const int num_target_points = static_cast<int>(d_target_point_data[level_number].petsc_node_idxs.size());
-    const bool uses_target_points = (num_target_points > 0);
-    const int* const petsc_node_idxs =
-        uses_target_points ? &d_target_point_data[level_number].petsc_node_idxs[0] : nullptr;
-    const double** const kappa = uses_target_points ? &d_target_point_data[level_number].kappa[0] : nullptr;
-    const double** const eta = uses_target_points ? &d_target_point_data[level_number].eta[0] : nullptr;
-    const Point** const X0 = uses_target_points ? &d_target_point_data[level_number].X0[0] : nullptr;
+    TargetPointData& target_point_data = d_target_point_data[level_number];
+    const int num_target_points = static_cast<int>(target_point_data.petsc_node_idxs.size());
+    const int* const petsc_node_idxs = num_target_points > 0 ? &target_point_data.petsc_node_idxs[0] : nullptr;
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getLocalFormVecArray()->data();
     const double* const U_node = U_data->getLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, idx;
-    double K, E, dX;
-    const double* X_target;
-    kblock = 0;
-    for (; kblock < (num_target_points - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Gather the target point parameters.
+    target_point_data.kappa_values.resize(num_target_points);
+    target_point_data.eta_values.resize(num_target_points);
+    target_point_data.X0_values.resize(NDIM * num_target_points);
+    double* const kappa = target_point_data.kappa_values.data();
+    double* const eta = target_point_data.eta_values.data();
+    double* const X0 = target_point_data.X0_values.data();
+    for (int k = 0; k < num_target_points; ++k)
     {
-        PREFETCH_READ_NTA_BLOCK(petsc_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(kappa + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(eta + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(X0 + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        kappa[k] = *target_point_data.kappa[k];
+        eta[k] = *target_point_data.eta[k];
+        const double* const X_target = target_point_data.X0[k]->data();
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            idx = petsc_node_idxs[k];
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(kappa[k + 1]);
-            PREFETCH_READ_NTA(eta[k + 1]);
-            PREFETCH_READ_NTA(X0[k + 1]);
-            K = *kappa[k];
-            E = *eta[k];
-            X_target = X0[k]->data();
-            F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
-            F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
-#if (NDIM == 3)
-            F_node[idx + 2] += K * (X_target[2] - X_node[idx + 2]) - E * U_node[idx + 2];
-#endif
-            if (d_log_target_point_displacements)
-            {
-                dX = 0.0;
-                dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
-                dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
-#if (NDIM == 3)
-                dX += (X_target[2] - X_node[idx + 2]) * (X_target[2] - X_node[idx + 2]);
+            X0[NDIM * k + d] = X_target[d];
+        }
+    }
+
+    // Compute the forces.  Each node is associated with at most one target
+    // point, so there are no dependencies between target points.
+#ifdef _OPENMP
+#pragma omp parallel for simd schedule(static) if (d_use_threaded_force_computation)
 #endif
-                dX = std::sqrt(dX);
-                max_displacement = std::max(max_displacement, dX);
-            }
+    for (int k = 0; k < num_target_points; ++k)
+    {
+        const int idx = petsc_node_idxs[k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F_node[idx + d] += kappa[k] * (X0[NDIM * k + d] - X_node[idx + d]) - eta[k] * U_node[idx + d];
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_target_points; ++k)
+    if (d_log_target_point_displacements)
     {
-        idx = petsc_node_idxs[k];
-        K = *kappa[k];
-        E = *eta[k];
-        X_target = X0[k]->data();
-        F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
-        F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
-#if (NDIM == 3)
-        F_node[idx + 2] += K * (X_target[2] - X_node[idx + 2]) - E * U_node[idx + 2];
-#endif
-        if (d_log_target_point_displacements)
+        for (int k = 0; k < num_target_points; ++k)
         {
-            dX = 0.0;
-            dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
-            dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
-#if (NDIM == 3)
-            dX += (X_target[2] - X_node[idx + 2]) * (X_target[2] - X_node[idx + 2]);
-#endif
+            const int idx = petsc_node_idxs[k];
+            double dX = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                dX += (X0[NDIM * k + d] - X_node[idx + d]) * (X0[NDIM * k + d] - X_node[idx + d]);
+            }
             dX = std::sqrt(dX);
             max_displacement = std::max(max_displacement, dX);
         }
@@ -35,6 +35,9 @@
 #include <array>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -122,6 +125,297 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// The signature, byte order marker, and version of binary structure files.
+// The byte order marker is read as BINARY_STRUCTURE_FILE_BYTE_ORDER if the
+// file was written with the native byte order, and as its byte reversal
+// otherwise.
+static const char BINARY_STRUCTURE_FILE_SIGNATURE[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+static const int BINARY_STRUCTURE_FILE_BYTE_ORDER = 1;
+static const int BINARY_STRUCTURE_FILE_VERSION = 1;
+static const std::streamoff BINARY_STRUCTURE_FILE_HEADER_SIZE = 48;
+
+// Reverse the byte order of each of the n values stored in data.
+template <typename T>
+void
+swap_byte_order(T* const data, const std::size_t n)
+{
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        char* const bytes = reinterpret_cast<char*>(data + k);
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    return;
+} // swap_byte_order
+
+// The records read from a binary structure file.
+struct BinaryStructureRecords
+{
+    int num_records = 0;
+    int num_local_records = 0;
+    int num_int_fields = 0;
+    int num_double_fields = 0;
+    std::vector<int> ints;
+    std::vector<double> doubles;
+};
+
+// Read num_records records starting with record first_record from an open
+// binary structure file.
+void
+read_binary_structure_records(std::ifstream& file_stream,
+                              const std::int64_t total_num_records,
+                              const std::int64_t first_record,
+                              const std::int64_t num_records,
+                              const int num_int_fields,
+                              const int num_double_fields,
+                              const bool swap_bytes,
+                              std::vector<int>& ints,
+                              std::vector<double>& doubles)
+{
+    ints.resize(num_records * num_int_fields);
+    doubles.resize(num_records * num_double_fields);
+    file_stream.seekg(BINARY_STRUCTURE_FILE_HEADER_SIZE +
+                      static_cast<std::streamoff>(first_record * num_int_fields) * sizeof(int));
+    file_stream.read(reinterpret_cast<char*>(ints.data()), ints.size() * sizeof(int));
+    file_stream.seekg(BINARY_STRUCTURE_FILE_HEADER_SIZE +
+                      static_cast<std::streamoff>(total_num_records * num_int_fields) * sizeof(int) +
+                      static_cast<std::streamoff>(first_record * num_double_fields) * sizeof(double));
+    file_stream.read(reinterpret_cast<char*>(doubles.data()), doubles.size() * sizeof(double));
+    if (swap_bytes)
+    {
+        swap_byte_order(ints.data(), ints.size());
+        swap_byte_order(doubles.data(), doubles.size());
+    }
+    return;
+} // read_binary_structure_records
+
+// Read the records of a binary structure file.  If replicate_records is true,
+// the file is read by the root process and its records are broadcast to all
+// processes.  Otherwise, each process reads a contiguous block of records; if
+// record_owner is provided, each record is then sent to the process returned
+// by record_owner, and if not, each process keeps the block that it read.
+// Files written with either byte order may be read.  This is a collective
+// operation.  Returns false (on all processes) if the file does not exist.
+bool
+read_binary_structure_file(const std::string& filename,
+                           const std::string& record_type,
+                           const int min_num_int_fields,
+                           const int min_num_double_fields,
+                           BinaryStructureRecords& records,
+                           const std::string& object_name,
+                           const bool replicate_records = true,
+                           const std::function<int(int, const int*)>& record_owner = nullptr)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    int ierr;
+
+    // Read and validate the header on the root process.
+    std::ifstream file_stream;
+    int file_exists = 0;
+    if (rank == 0)
+    {
+        file_stream.open(filename.c_str(), std::ios::in | std::ios::binary);
+        file_exists = file_stream.is_open() ? 1 : 0;
+    }
+    file_exists = SAMRAI_MPI::bcast(file_exists, 0);
+    if (!file_exists) return false;
+    int swap_bytes = 0, num_int_fields = 0, num_double_fields = 0;
+    std::int64_t num_records = 0;
+    if (rank == 0)
+    {
+        char signature[8], type[8];
+        int byte_order, version, ndim, padding;
+        file_stream.read(signature, sizeof(signature));
+        file_stream.read(reinterpret_cast<char*>(&byte_order), sizeof(int));
+        file_stream.read(reinterpret_cast<char*>(&version), sizeof(int));
+        file_stream.read(type, sizeof(type));
+        file_stream.read(reinterpret_cast<char*>(&ndim), sizeof(int));
+        file_stream.read(reinterpret_cast<char*>(&num_int_fields), sizeof(int));
+        file_stream.read(reinterpret_cast<char*>(&num_double_fields), sizeof(int));
+        file_stream.read(reinterpret_cast<char*>(&padding), sizeof(int));
+        file_stream.read(reinterpret_cast<char*>(&num_records), sizeof(std::int64_t));
+        if (!file_stream || file_stream.tellg() != BINARY_STRUCTURE_FILE_HEADER_SIZE ||
+            !std::equal(signature, signature + 8, BINARY_STRUCTURE_FILE_SIGNATURE))
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid header in binary input file " << filename << std::endl);
+        }
+        if (byte_order != BINARY_STRUCTURE_FILE_BYTE_ORDER)
+        {
+            swap_byte_order(&byte_order, 1);
+            if (byte_order != BINARY_STRUCTURE_FILE_BYTE_ORDER)
+            {
+                TBOX_ERROR(object_name << ":\n  Invalid byte order marker in binary input file " << filename
+                                       << std::endl);
+            }
+            swap_bytes = 1;
+            swap_byte_order(&version, 1);
+            swap_byte_order(&ndim, 1);
+            swap_byte_order(&num_int_fields, 1);
+            swap_byte_order(&num_double_fields, 1);
+            swap_byte_order(&num_records, 1);
+        }
+        if (version != BINARY_STRUCTURE_FILE_VERSION)
+        {
+            TBOX_ERROR(object_name << ":\n  Unsupported version " << version << " of binary input file " << filename
+                                   << std::endl);
+        }
+        if (std::string(type, std::find(type, type + 8, '\0')) != record_type)
+        {
+            TBOX_ERROR(object_name << ":\n  Binary input file " << filename << " does not contain " << record_type
+                                   << " data" << std::endl);
+        }
+        if (ndim != NDIM)
+        {
+            TBOX_ERROR(object_name << ":\n  Binary input file " << filename << " contains " << ndim
+                                   << "D data, but NDIM = " << NDIM << std::endl);
+        }
+        if (num_int_fields < min_num_int_fields || num_double_fields < min_num_double_fields || num_records <= 0 ||
+            num_records * std::max(num_int_fields, num_double_fields) > std::numeric_limits<int>::max())
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid record layout in binary input file " << filename << std::endl);
+        }
+    }
+    int header[4] = { swap_bytes, num_int_fields, num_double_fields, static_cast<int>(num_records) };
+    ierr = MPI_Bcast(header, 4, MPI_INT, 0, communicator);
+    TBOX_ASSERT(ierr == 0);
+    swap_bytes = header[0];
+    num_int_fields = header[1];
+    num_double_fields = header[2];
+    num_records = header[3];
+    records.num_records = header[3];
+    records.num_int_fields = num_int_fields;
+    records.num_double_fields = num_double_fields;
+
+    // If the records are replicated, read the entire file on the root process
+    // and broadcast it to all other processes.
+    if (replicate_records)
+    {
+        records.num_local_records = records.num_records;
+        if (rank == 0)
+        {
+            read_binary_structure_records(file_stream,
+                                          num_records,
+                                          0,
+                                          num_records,
+                                          num_int_fields,
+                                          num_double_fields,
+                                          swap_bytes,
+                                          records.ints,
+                                          records.doubles);
+            if (!file_stream)
+            {
+                TBOX_ERROR(object_name << ":\n  Premature end to binary input file " << filename << " encountered"
+                                       << std::endl);
+            }
+            file_stream.close();
+        }
+        else
+        {
+            records.ints.resize(num_records * num_int_fields);
+            records.doubles.resize(num_records * num_double_fields);
+        }
+        ierr = MPI_Bcast(records.ints.data(), static_cast<int>(records.ints.size()), MPI_INT, 0, communicator);
+        TBOX_ASSERT(ierr == 0);
+        ierr = MPI_Bcast(records.doubles.data(), static_cast<int>(records.doubles.size()), MPI_DOUBLE, 0, communicator);
+        TBOX_ASSERT(ierr == 0);
+        return true;
+    }
+
+    // Otherwise, read the local block of records.
+    if (rank != 0) file_stream.open(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file_stream.is_open())
+    {
+        TBOX_ERROR(object_name << ":\n  Cannot open binary input file " << filename << " on MPI process " << rank
+                               << std::endl);
+    }
+    const int local_start = static_cast<int>((num_records * rank) / nodes);
+    const int num_local_records = static_cast<int>((num_records * (rank + 1)) / nodes - local_start);
+    std::vector<int> local_ints;
+    std::vector<double> local_doubles;
+    read_binary_structure_records(file_stream,
+                                  num_records,
+                                  local_start,
+                                  num_local_records,
+                                  num_int_fields,
+                                  num_double_fields,
+                                  swap_bytes,
+                                  local_ints,
+                                  local_doubles);
+    if (!file_stream)
+    {
+        TBOX_ERROR(object_name << ":\n  Premature end to binary input file " << filename << " encountered"
+                               << std::endl);
+    }
+    file_stream.close();
+
+    // Keep the local block of records.
+    if (!record_owner)
+    {
+        records.num_local_records = num_local_records;
+        records.ints.swap(local_ints);
+        records.doubles.swap(local_doubles);
+        return true;
+    }
+
+    // Send each record to the process that owns it.
+    std::vector<int> owner(num_local_records), send_counts(nodes, 0), send_displs(nodes + 1, 0);
+    for (int r = 0; r < num_local_records; ++r)
+    {
+        owner[r] = record_owner(local_start + r, local_ints.data() + r * num_int_fields);
+        ++send_counts[owner[r]];
+    }
+    std::partial_sum(send_counts.begin(), send_counts.end(), send_displs.begin() + 1);
+    std::vector<int> send_ints(local_ints.size());
+    std::vector<double> send_doubles(local_doubles.size());
+    std::vector<int> send_pos(send_displs.begin(), send_displs.end() - 1);
+    for (int r = 0; r < num_local_records; ++r)
+    {
+        const int pos = send_pos[owner[r]]++;
+        std::copy(local_ints.data() + r * num_int_fields,
+                  local_ints.data() + (r + 1) * num_int_fields,
+                  send_ints.data() + pos * num_int_fields);
+        std::copy(local_doubles.data() + r * num_double_fields,
+                  local_doubles.data() + (r + 1) * num_double_fields,
+                  send_doubles.data() + pos * num_double_fields);
+    }
+    std::vector<int> recv_counts(nodes), recv_displs(nodes + 1, 0);
+    ierr = MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, communicator);
+    TBOX_ASSERT(ierr == 0);
+    std::partial_sum(recv_counts.begin(), recv_counts.end(), recv_displs.begin() + 1);
+    records.num_local_records = recv_displs[nodes];
+    records.ints.resize(records.num_local_records * num_int_fields);
+    records.doubles.resize(records.num_local_records * num_double_fields);
+
+    // The records are exchanged first as integers and then as doubles.
+    for (int field_type = 0; field_type < 2; ++field_type)
+    {
+        const int num_fields = field_type == 0 ? num_int_fields : num_double_fields;
+        std::vector<int> field_send_counts(nodes), field_send_displs(nodes), field_recv_counts(nodes),
+            field_recv_displs(nodes);
+        for (int proc = 0; proc < nodes; ++proc)
+        {
+            field_send_counts[proc] = send_counts[proc] * num_fields;
+            field_send_displs[proc] = send_displs[proc] * num_fields;
+            field_recv_counts[proc] = recv_counts[proc] * num_fields;
+            field_recv_displs[proc] = recv_displs[proc] * num_fields;
+        }
+        ierr = MPI_Alltoallv(field_type == 0 ? static_cast<void*>(send_ints.data()) :
+                                               static_cast<void*>(send_doubles.data()),
+                             field_send_counts.data(),
+                             field_send_displs.data(),
+                             field_type == 0 ? MPI_INT : MPI_DOUBLE,
+                             field_type == 0 ? static_cast<void*>(records.ints.data()) :
+                                               static_cast<void*>(records.doubles.data()),
+                             field_recv_counts.data(),
+                             field_recv_displs.data(),
+                             field_type == 0 ? MPI_INT : MPI_DOUBLE,
+                             communicator);
+        TBOX_ASSERT(ierr == 0);
+    }
+    return true;
+} // read_binary_structure_file
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -205,6 +499,9 @@ IBStandardInitializer::init()
 
         // Process the source information.
         readSourceFiles(".source");
+
+        // Discard the structure data that are not stored on this process.
+        if (d_distribute_structure_data) distributeStructureData();
     }
 
     // Indicate that we have processed data.
@@ -234,9 +531,6 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
         d_vertex_posn[ln].resize(num_base_filename);
         for (unsigned int j = 0; j < num_base_filename; ++j)
         {
-            // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
-
             if (j == 0)
             {
                 d_vertex_offset[ln][j] = 0;
@@ -246,8 +540,42 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
                 d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
             }
 
-            // Ensure that the file exists.
+            // Read the binary input file, if any.  All processes read this file
+            // collectively, so file batons are not used.
             const std::string vertex_filename = d_base_filename[ln][j] + extension;
+            BinaryStructureRecords records;
+            if (d_use_binary_structure_files && read_binary_structure_file(vertex_filename + ".bin",
+                                                                          "vertex",
+                                                                          0,
+                                                                          NDIM,
+                                                                          records,
+                                                                          d_object_name,
+                                                                          !d_distribute_structure_data))
+            {
+                // When structure data are distributed, each process stores only
+                // the block of vertices that it read.
+                d_num_vertex[ln][j] = records.num_records;
+                d_vertex_posn[ln][j].resize(records.num_local_records);
+                for (int k = 0; k < records.num_local_records; ++k)
+                {
+                    Point& X = d_vertex_posn[ln][j][k];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = d_length_scale_factor *
+                               (records.doubles[k * records.num_double_fields + d] + d_posn_shift[d]);
+                    }
+                }
+
+                plog << d_object_name << ":  "
+                     << "read " << d_num_vertex[ln][j] << " vertices from binary input file named " << vertex_filename
+                     << ".bin" << std::endl;
+                continue;
+            }
+
+            // Wait for the previous MPI process to finish reading the current file.
+            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+
+            // Ensure that the file exists.
             std::ifstream file_stream;
             file_stream.open(vertex_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
@@ -363,11 +691,54 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Read the binary input file, if any.  All processes read this file
+            // collectively, so file batons are not used.
+            const std::string spring_filename = d_base_filename[ln][j] + extension;
+            BinaryStructureRecords records;
+            const auto spring_owner = [&](int /*k*/, const int* const ints) {
+                return getInputVertexOwner(ln, j, std::min(ints[0], ints[1]), input_uses_global_idxs);
+            };
+            if (d_use_binary_structure_files && read_binary_structure_file(spring_filename + ".bin",
+                                                                          "spring",
+                                                                          3,
+                                                                          2,
+                                                                          records,
+                                                                          d_object_name,
+                                                                          !d_distribute_structure_data,
+                                                                          spring_owner))
+            {
+                for (int k = 0; k < records.num_local_records; ++k)
+                {
+                    const int* const ints = &records.ints[k * records.num_int_fields];
+                    const double* const doubles = &records.doubles[k * records.num_double_fields];
+                    Edge e(ints[0], ints[1]);
+                    if ((e.first < min_idx) || (e.first >= max_idx) || (e.second < min_idx) || (e.second >= max_idx))
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                 << k << " of file " << spring_filename << ".bin" << std::endl
+                                                 << "  vertex index is out of range" << std::endl);
+                    }
+                    std::vector<double> parameters(doubles, doubles + records.num_double_fields);
+                    if (parameters[0] < 0.0 || parameters[1] < 0.0)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                 << k << " of file " << spring_filename << ".bin" << std::endl
+                                                 << "  spring constant or resting length is negative" << std::endl);
+                    }
+                    parameters[1] *= d_length_scale_factor;
+                    addSpring(ln, j, e, parameters, ints[2], input_uses_global_idxs, spring_filename, warned);
+                }
+
+                plog << d_object_name << ":  "
+                     << "read " << records.num_records << " edges from binary input file named " << spring_filename
+                     << ".bin" << std::endl;
+                continue;
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
             if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             // Ensure that the file exists.
-            const std::string spring_filename = d_base_filename[ln][j] + extension;
             std::ifstream file_stream;
             file_stream.open(spring_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
@@ -509,74 +880,7 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                         }
                     }
 
-                    // Modify kappa and length according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_spring_stiffness[ln][j])
-                    {
-                        parameters[0] = d_uniform_spring_stiffness[ln][j];
-                    }
-                    if (d_using_uniform_spring_rest_length[ln][j])
-                    {
-                        parameters[1] = d_uniform_spring_rest_length[ln][j];
-                    }
-                    if (d_using_uniform_spring_force_fcn_idx[ln][j])
-                    {
-                        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
-                    }
-
-                    // Check to see if the spring constant is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_springs[ln][j] &&
-                        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named "
-                                                   << spring_filename
-                                                   << "."
-                                                   << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the edge numbers to be in the global Lagrangian indexing
-                    // scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        e.first += d_vertex_offset[ln][j];
-                        e.second += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present edge.
-                    //
-                    // Note that in the edge map, each edge is associated with only the
-                    // first vertex.
-                    if (e.first > e.second)
-                    {
-                        std::swap<int>(e.first, e.second);
-                    }
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
-                        d_spring_edge_map[ln][j].equal_range(e.first);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        if (it->second == e) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate spring connection between nodes "
-                                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
-                                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << spring_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
-                        SpringSpec spec_data;
-                        spec_data.parameters = parameters;
-                        spec_data.force_fcn_idx = force_fcn_idx;
-                        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
-                    }
+                    addSpring(ln, j, e, parameters, force_fcn_idx, input_uses_global_idxs, spring_filename, warned);
                 }
 
                 // Close the input file.
@@ -597,6 +901,86 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
     return;
 } // readSpringFiles
 
+void
+IBStandardInitializer::addSpring(const int ln,
+                                 const unsigned int j,
+                                 Edge e,
+                                 std::vector<double> parameters,
+                                 int force_fcn_idx,
+                                 const bool input_uses_global_idxs,
+                                 const std::string& spring_filename,
+                                 bool& warned)
+{
+    // Modify kappa and length according to whether uniform values are to be
+    // employed for this particular structure.
+    if (d_using_uniform_spring_stiffness[ln][j])
+    {
+        parameters[0] = d_uniform_spring_stiffness[ln][j];
+    }
+    if (d_using_uniform_spring_rest_length[ln][j])
+    {
+        parameters[1] = d_uniform_spring_rest_length[ln][j];
+    }
+    if (d_using_uniform_spring_force_fcn_idx[ln][j])
+    {
+        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
+    }
+
+    // Check to see if the spring constant is zero and, if so, emit a warning.
+    if (!warned && d_enable_springs[ln][j] &&
+        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
+                                      "encountered in input file named "
+                                   << spring_filename
+                                   << "."
+                                   << std::endl);
+        warned = true;
+    }
+
+    // Correct the edge numbers to be in the global Lagrangian indexing
+    // scheme.
+    if (!input_uses_global_idxs)
+    {
+        e.first += d_vertex_offset[ln][j];
+        e.second += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present edge.
+    //
+    // Note that in the edge map, each edge is associated with only the
+    // first vertex.
+    if (e.first > e.second)
+    {
+        std::swap<int>(e.first, e.second);
+    }
+    bool found_connection = false;
+    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+        d_spring_edge_map[ln][j].equal_range(e.first);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == e) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate spring connection between nodes "
+                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
+                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << spring_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+        SpringSpec spec_data;
+        spec_data.parameters = parameters;
+        spec_data.force_fcn_idx = force_fcn_idx;
+        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // addSpring
+
 void
 IBStandardInitializer::readXSpringFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -879,10 +1263,65 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Read the binary input file, if any.  All processes read this file
+            // collectively, so file batons are not used.
+            const std::string beam_filename = d_base_filename[ln][j] + extension;
+            BinaryStructureRecords records;
+            const auto beam_owner = [&](int /*k*/, const int* const ints) {
+                return getInputVertexOwner(ln, j, ints[1], input_uses_global_idxs);
+            };
+            if (d_use_binary_structure_files && read_binary_structure_file(beam_filename + ".bin",
+                                                                          "beam",
+                                                                          3,
+                                                                          1 + NDIM,
+                                                                          records,
+                                                                          d_object_name,
+                                                                          !d_distribute_structure_data,
+                                                                          beam_owner))
+            {
+                for (int k = 0; k < records.num_local_records; ++k)
+                {
+                    const int* const ints = &records.ints[k * records.num_int_fields];
+                    const double* const doubles = &records.doubles[k * records.num_double_fields];
+                    for (int l = 0; l < 3; ++l)
+                    {
+                        if ((ints[l] < min_idx) || (ints[l] >= max_idx))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                     << k << " of file " << beam_filename << ".bin" << std::endl
+                                                     << "  vertex index " << ints[l] << " is out of range"
+                                                     << std::endl);
+                        }
+                    }
+                    if (doubles[0] < 0.0)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                 << k << " of file " << beam_filename << ".bin" << std::endl
+                                                 << "  beam constant is negative" << std::endl);
+                    }
+                    Vector curv;
+                    for (unsigned int d = 0; d < NDIM; ++d) curv[d] = doubles[1 + d];
+                    addBeam(ln,
+                            j,
+                            ints[0],
+                            ints[1],
+                            ints[2],
+                            doubles[0],
+                            curv,
+                            input_uses_global_idxs,
+                            beam_filename,
+                            warned);
+                }
+
+                plog << d_object_name << ":  "
+                     << "read " << records.num_records << " beams from binary input file named " << beam_filename
+                     << ".bin" << std::endl;
+                continue;
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
             if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            const std::string beam_filename = d_base_filename[ln][j] + extension;
             std::ifstream file_stream;
             file_stream.open(beam_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
@@ -1040,69 +1479,16 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                         }
                     }
 
-                    // Modify bend and curvature according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_beam_bend_rigidity[ln][j])
-                    {
-                        bend = d_uniform_beam_bend_rigidity[ln][j];
-                    }
-                    if (d_using_uniform_beam_curvature[ln][j])
-                    {
-                        curv = d_uniform_beam_curvature[ln][j];
-                    }
-
-                    // Check to see if the bending rigidity is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
-                                                      "encountered in ASCII input file named "
-                                                   << beam_filename
-                                                   << "."
-                                                   << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the node numbers to be in the global Lagrangian
-                    // indexing scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        prev_idx += d_vertex_offset[ln][j];
-                        curr_idx += d_vertex_offset[ln][j];
-                        next_idx += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present
-                    // beam.
-                    //
-                    // Note that in the beam property map, each edge is
-                    // associated with only the "current" vertex.
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
-                        d_beam_spec_data[ln][j].equal_range(curr_idx);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        const BeamSpec& spec_data = it->second;
-                        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate beam connection between nodes "
-                                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
-                                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
-                                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << beam_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        BeamSpec spec_data;
-                        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
-                        spec_data.bend_rigidity = bend;
-                        spec_data.curvature = curv;
-                        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
-                    }
+                    addBeam(ln,
+                            j,
+                            prev_idx,
+                            curr_idx,
+                            next_idx,
+                            bend,
+                            curv,
+                            input_uses_global_idxs,
+                            beam_filename,
+                            warned);
                 }
 
                 // Close the input file.
@@ -1123,6 +1509,84 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
     return;
 } // readBeamFiles
 
+void
+IBStandardInitializer::addBeam(const int ln,
+                               const unsigned int j,
+                               int prev_idx,
+                               int curr_idx,
+                               int next_idx,
+                               double bend,
+                               Vector curv,
+                               const bool input_uses_global_idxs,
+                               const std::string& beam_filename,
+                               bool& warned)
+{
+    // Modify bend and curvature according to whether uniform
+    // values are to be employed for this particular structure.
+    if (d_using_uniform_beam_bend_rigidity[ln][j])
+    {
+        bend = d_uniform_beam_bend_rigidity[ln][j];
+    }
+    if (d_using_uniform_beam_curvature[ln][j])
+    {
+        curv = d_uniform_beam_curvature[ln][j];
+    }
+
+    // Check to see if the bending rigidity is zero and, if so,
+    // emit a warning.
+    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
+                                      "encountered in input file named "
+                                   << beam_filename
+                                   << "."
+                                   << std::endl);
+        warned = true;
+    }
+
+    // Correct the node numbers to be in the global Lagrangian
+    // indexing scheme.
+    if (!input_uses_global_idxs)
+    {
+        prev_idx += d_vertex_offset[ln][j];
+        curr_idx += d_vertex_offset[ln][j];
+        next_idx += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present
+    // beam.
+    //
+    // Note that in the beam property map, each edge is
+    // associated with only the "current" vertex.
+    bool found_connection = false;
+    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
+        d_beam_spec_data[ln][j].equal_range(curr_idx);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const BeamSpec& spec_data = it->second;
+        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate beam connection between nodes "
+                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
+                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
+                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << beam_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        BeamSpec spec_data;
+        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
+        spec_data.bend_rigidity = bend;
+        spec_data.curvature = curv;
+        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
+    }
+    return;
+} // addBeam
+
 void
 IBStandardInitializer::readRodFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -1514,18 +1978,86 @@ IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             const int min_idx = 0;
             const int max_idx = d_num_vertex[ln][j];
 
+            // Read the binary input file, if any.  All processes read this file
+            // collectively, so file batons are not used.
+            const std::string target_point_stiffness_filename = d_base_filename[ln][j] + extension;
+            BinaryStructureRecords records;
+            const auto target_point_owner = [&](int /*k*/, const int* const ints) {
+                return getInputVertexOwner(ln, j, ints[0], /*input_uses_global_idxs*/ false);
+            };
+            const bool use_binary_file = d_use_binary_structure_files &&
+                                         read_binary_structure_file(target_point_stiffness_filename + ".bin",
+                                                                    "target",
+                                                                    1,
+                                                                    2,
+                                                                    records,
+                                                                    d_object_name,
+                                                                    !d_distribute_structure_data,
+                                                                    target_point_owner);
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (!use_binary_file && d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
+            // When structure data are distributed, binary target point data
+            // are stored only for the local vertices.
             std::set<int> target_point_idxs;
             TargetSpec default_spec;
             default_spec.stiffness = 0.0;
             default_spec.damping = 0.0;
-            d_target_spec_data[ln][j].resize(d_num_vertex[ln][j], default_spec);
+            const std::pair<int, int> local_range =
+                use_binary_file ? getLocalVertexRange(ln, j) : std::make_pair(0, d_num_vertex[ln][j]);
+            d_target_spec_data[ln][j].resize(local_range.second - local_range.first, default_spec);
+
+            if (use_binary_file)
+            {
+                for (int k = 0; k < records.num_local_records; ++k)
+                {
+                    const int n = records.ints[k * records.num_int_fields];
+                    const double* const doubles = &records.doubles[k * records.num_double_fields];
+                    if ((n < min_idx) || (n >= max_idx))
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                 << k << " of file " << target_point_stiffness_filename << ".bin"
+                                                 << std::endl
+                                                 << "  vertex index " << n << " is out of range" << std::endl);
+                    }
+                    if (doubles[0] < 0.0 || doubles[1] < 0.0)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                 << k << " of file " << target_point_stiffness_filename << ".bin"
+                                                 << std::endl
+                                                 << "  target point spring constant or damping coefficient is "
+                                                    "negative"
+                                                 << std::endl);
+                    }
+                    if (!target_point_idxs.insert(n).second)
+                    {
+                        TBOX_WARNING(d_object_name << ":\n  Duplicate target point node " << n
+                                                   << " encountered in binary input file named "
+                                                   << target_point_stiffness_filename << ".bin.\n"
+                                                   << "  Skipping duplicated point." << std::endl);
+                        continue;
+                    }
+                    d_target_spec_data[ln][j][n - local_range.first].stiffness = doubles[0];
+                    d_target_spec_data[ln][j][n - local_range.first].damping = doubles[1];
+                    const double kappa = doubles[0];
+                    if (!warned && d_enable_target_points[ln][j] &&
+                        (kappa == 0.0 || MathUtilities<double>::equalEps(kappa, 0.0)))
+                    {
+                        TBOX_WARNING(d_object_name << ":\n  Target point with zero penalty spring "
+                                                      "constant encountered in binary input file named "
+                                                   << target_point_stiffness_filename << ".bin." << std::endl);
+                        warned = true;
+                    }
+                }
+
+                plog << d_object_name << ":  "
+                     << "read " << records.num_records << " target points from binary input file named "
+                     << target_point_stiffness_filename << ".bin" << std::endl;
+            }
 
-            const std::string target_point_stiffness_filename = d_base_filename[ln][j] + extension;
             std::ifstream file_stream;
-            file_stream.open(target_point_stiffness_filename.c_str(), std::ios::in);
+            if (!use_binary_file) file_stream.open(target_point_stiffness_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
@@ -1664,32 +2196,33 @@ IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             // values are to be employed, for this particular structure.
             if (!d_enable_target_points[ln][j])
             {
-                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                for (auto& spec : d_target_spec_data[ln][j])
                 {
-                    d_target_spec_data[ln][j][k].stiffness = 0.0;
-                    d_target_spec_data[ln][j][k].damping = 0.0;
+                    spec.stiffness = 0.0;
+                    spec.damping = 0.0;
                 }
             }
             else
             {
                 if (d_using_uniform_target_stiffness[ln][j])
                 {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    for (auto& spec : d_target_spec_data[ln][j])
                     {
-                        d_target_spec_data[ln][j][k].stiffness = d_uniform_target_stiffness[ln][j];
+                        spec.stiffness = d_uniform_target_stiffness[ln][j];
                     }
                 }
                 if (d_using_uniform_target_damping[ln][j])
                 {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    for (auto& spec : d_target_spec_data[ln][j])
                     {
-                        d_target_spec_data[ln][j][k].damping = d_uniform_target_damping[ln][j];
+                        spec.damping = d_uniform_target_damping[ln][j];
                     }
                 }
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (!use_binary_file && d_use_file_batons && rank != nodes - 1)
+                SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -2664,6 +3197,24 @@ IBStandardInitializer::readSourceFiles(const std::string& extension)
     return;
 } // readSourceFiles
 
+int
+IBStandardInitializer::getInputVertexOwner(const int ln,
+                                           const unsigned int j,
+                                           int idx,
+                                           const bool input_uses_global_idxs) const
+{
+    unsigned int strct = j;
+    if (input_uses_global_idxs)
+    {
+        const auto it = std::upper_bound(d_vertex_offset[ln].begin(), d_vertex_offset[ln].end(), idx);
+        if (it == d_vertex_offset[ln].begin()) return SAMRAI_MPI::getRank();
+        strct = std::distance(d_vertex_offset[ln].begin(), it) - 1;
+        idx -= d_vertex_offset[ln][strct];
+    }
+    if (idx < 0 || idx >= d_num_vertex[ln][strct]) return SAMRAI_MPI::getRank();
+    return getVertexOwner(ln, strct, idx);
+} // getInputVertexOwner
+
 std::vector<Pointer<Streamable> >
 IBStandardInitializer::initializeNodeData(const std::pair<int, int>& point_index,
                                           const unsigned int global_index_offset,
@@ -2849,6 +3400,8 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // Determine whether to use "batons" to prevent multiple MPI processes from
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
+    if (db->keyExists("use_binary_structure_files"))
+        d_use_binary_structure_files = db->getBool("use_binary_structure_files");
 
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
@@ -34,6 +34,8 @@
 
 #include <limits>
 
+#include "CartesianGridGeometry.h"
+#include "PatchHierarchy.h"
 #include "ibamr/CIBStrategy.h"
 #include "ibamr/IBStrategy.h"
 #include "ibamr/INSStaggeredHierarchyIntegrator.h"
@@ -547,6 +549,17 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("mobility_operator_type"))
+        d_mobility_operator_type = input_db->getString("mobility_operator_type");
+    if (input_db->keyExists("f_periodic_correction"))
+        d_f_periodic_corr = input_db->getDouble("f_periodic_correction");
+    if (input_db->keyExists("rpy_mac_theta")) d_rpy_mac_theta = input_db->getDouble("rpy_mac_theta");
+    if (input_db->keyExists("rpy_interp_degree")) d_rpy_interp_degree = input_db->getInteger("rpy_interp_degree");
+    if (d_mobility_operator_type != "FLUID" && d_mobility_operator_type != "RPY")
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput(): Unknown mobility operator type "
+                                 << d_mobility_operator_type << std::endl);
+    }
 } // getFromInput
 
 void
@@ -901,51 +914,77 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
     static const double delta = solver->d_reg_mob_factor;
     const double half_time = 0.5 * (solver->d_new_time + solver->d_current_time);
 
-    // Use homogeneous BCs with Stokes solver in the preconditioner.
-    dynamic_cast<IBTK::LinearSolver*>(solver->d_LInv.getPointer())->setHomogeneousBc(true);
-
-    // Set y:= [J L^-1 S + \delta]x
-    // 1) Spread force.
-    solver->d_samrai_temp[0]->setToScalar(0.0);
-    solver->d_cib_strategy->setConstraintForce(x, half_time, gamma);
-    ib_method_ops->spreadForce(solver->d_samrai_temp[0]->getComponentDescriptorIndex(0),
-                               nullptr,
-                               std::vector<Pointer<RefineSchedule<NDIM> > >(),
-                               half_time);
-    if (solver->d_normalize_spread_force)
+    // Set y:= [gamma * beta * M_RPY + \delta]x if the Stokes solve is replaced
+    // by the RPY mobility matrix.
+    if (solver->d_mobility_operator_type == "RPY")
     {
-        solver->d_cib_strategy->subtractMeanConstraintForce(
-            x, solver->d_samrai_temp[0]->getComponentDescriptorIndex(0), gamma);
+        const int finest_ln = solver->d_hierarchy->getFinestLevelNumber();
+        const IntVector<NDIM>& ratio = solver->d_hierarchy->getPatchLevel(finest_ln)->getRatio();
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = solver->d_hierarchy->getGridGeometry();
+        const double* dx0 = grid_geom->getDx();
+        double dx[NDIM];
+        for (int d = 0; d < NDIM; ++d) dx[d] = dx0[d] / ratio(d);
+        const double mu = solver->d_ins_integrator->getStokesSpecifications()->getMu();
+        solver->d_cib_strategy->applyMobilityMatrix(RPY,
+                                                    x,
+                                                    y,
+                                                    dx,
+                                                    mu,
+                                                    solver->d_f_periodic_corr,
+                                                    solver->d_rpy_mac_theta,
+                                                    solver->d_rpy_interp_degree,
+                                                    /*managing_rank*/ 0);
+        VecScale(y, gamma * beta);
+    }
+    else
+    {
+        // Use homogeneous BCs with Stokes solver in the preconditioner.
+        dynamic_cast<IBTK::LinearSolver*>(solver->d_LInv.getPointer())->setHomogeneousBc(true);
+
+        // Set y:= [J L^-1 S + \delta]x
+        // 1) Spread force.
+        solver->d_samrai_temp[0]->setToScalar(0.0);
+        solver->d_cib_strategy->setConstraintForce(x, half_time, gamma);
+        ib_method_ops->spreadForce(solver->d_samrai_temp[0]->getComponentDescriptorIndex(0),
+                                   nullptr,
+                                   std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                                   half_time);
+        if (solver->d_normalize_spread_force)
+        {
+            solver->d_cib_strategy->subtractMeanConstraintForce(
+                x, solver->d_samrai_temp[0]->getComponentDescriptorIndex(0), gamma);
+        }
+        // 2) Solve Stokes system.
+        solver->d_LInv->solveSystem(*solver->d_samrai_temp[1], *solver->d_samrai_temp[0]);
+
+        // 3a) Fill velocity ghost cells.
+        int u_data_idx = solver->d_samrai_temp[1]->getComponentDescriptorIndex(0);
+        using InterpolationTransactionComponent =
+            IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        std::vector<InterpolationTransactionComponent> transaction_comps;
+        InterpolationTransactionComponent u_component(u_data_idx,
+                                                      DATA_REFINE_TYPE,
+                                                      USE_CF_INTERPOLATION,
+                                                      DATA_COARSEN_TYPE,
+                                                      BDRY_EXTRAP_TYPE,
+                                                      CONSISTENT_TYPE_2_BDRY,
+                                                      solver->d_u_bc_coefs,
+                                                      solver->d_fill_pattern);
+        transaction_comps.push_back(u_component);
+        solver->d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
+        static const bool homogeneous_bc = true;
+        solver->d_hier_bdry_fill->setHomogeneousBc(homogeneous_bc);
+        solver->d_hier_bdry_fill->fillData(half_time);
+        solver->d_hier_bdry_fill->resetTransactionComponents(solver->d_transaction_comps);
+
+        // 3b) Interpolate velocity
+        solver->d_cib_strategy->setInterpolatedVelocityVector(y, half_time);
+        ib_method_ops->interpolateVelocity(u_data_idx,
+                                           std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
+                                           std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                                           half_time);
+        solver->d_cib_strategy->getInterpolatedVelocity(y, half_time, beta);
     }
-    // 2) Solve Stokes system.
-    solver->d_LInv->solveSystem(*solver->d_samrai_temp[1], *solver->d_samrai_temp[0]);
-
-    // 3a) Fill velocity ghost cells.
-    int u_data_idx = solver->d_samrai_temp[1]->getComponentDescriptorIndex(0);
-    using InterpolationTransactionComponent = IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
-    std::vector<InterpolationTransactionComponent> transaction_comps;
-    InterpolationTransactionComponent u_component(u_data_idx,
-                                                  DATA_REFINE_TYPE,
-                                                  USE_CF_INTERPOLATION,
-                                                  DATA_COARSEN_TYPE,
-                                                  BDRY_EXTRAP_TYPE,
-                                                  CONSISTENT_TYPE_2_BDRY,
-                                                  solver->d_u_bc_coefs,
-                                                  solver->d_fill_pattern);
-    transaction_comps.push_back(u_component);
-    solver->d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
-    static const bool homogeneous_bc = true;
-    solver->d_hier_bdry_fill->setHomogeneousBc(homogeneous_bc);
-    solver->d_hier_bdry_fill->fillData(half_time);
-    solver->d_hier_bdry_fill->resetTransactionComponents(solver->d_transaction_comps);
-
-    // 3b) Interpolate velocity
-    solver->d_cib_strategy->setInterpolatedVelocityVector(y, half_time);
-    ib_method_ops->interpolateVelocity(u_data_idx,
-                                       std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
-                                       std::vector<Pointer<RefineSchedule<NDIM> > >(),
-                                       half_time);
-    solver->d_cib_strategy->getInterpolatedVelocity(y, half_time, beta);
 
     // 4) Regularize mobility.
     if (!MathUtilities<double>::equalEps(delta, 0.0))
@@ -32,11 +32,14 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 #include "ibamr/MobilityFunctions.h"
 
@@ -574,6 +577,149 @@ getEmpiricalMobilityComponents(const char* IBKernelName,
     }
     return;
 } // getEmpiricalMobilityComponents
+
+// Returns the components of the RPY tensor for two blobs of hydrodynamic
+// radius HRad separated by a distance r > 0, normalized by the self mobility,
+// i.e. M(r) = mu_tt * (F_R * I + G_R * r r^T / r^2).
+void
+getRPYMobilityComponents(const double r, const double HRad, double* F_R, double* G_R)
+{
+    if (r <= 2.0 * HRad)
+    {
+        *F_R = 1.0 - 9.0 / 32.0 * r / HRad;
+        *G_R = 3.0 / 32.0 * r / HRad;
+    }
+    else
+    {
+        const double cube = HRad * HRad * HRad / r / r / r;
+        *F_R = 3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube;
+        *G_R = 3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube;
+    }
+    return;
+} // getRPYMobilityComponents
+
+// Add the velocity induced at a marker by the force F applied to a marker
+// displaced from it by r_vec, i.e. U += mu_tt * M(r_vec) F.
+inline void
+addRPYInteraction(const double* const r_vec, const double* const F, const double mu_tt, double* const U)
+{
+    const double rsq = get_sqnorm(r_vec);
+    const double r = std::sqrt(rsq);
+    double F_R, G_R;
+    getRPYMobilityComponents(r, HRad, &F_R, &G_R);
+    double r_dot_F = 0.0;
+    for (int d = 0; d < NDIM; ++d) r_dot_F += r_vec[d] * F[d];
+    for (int d = 0; d < NDIM; ++d) U[d] += mu_tt * (F_R * F[d] + G_R * r_vec[d] * r_dot_F / rsq);
+    return;
+} // addRPYInteraction
+
+// Minimum ratio of the number of markers to the number of proxy points of a
+// cluster for which the treecode is used.
+const int MIN_TREECODE_PROXY_RATIO = 64;
+
+// A cluster of markers in the tree used by the barycentric Lagrange treecode.
+// The markers of the cluster are idxs[begin], ..., idxs[end - 1], and F_hat
+// stores the modified forces at the Chebyshev proxy points of the cluster's
+// bounding box, if the cluster contains more markers than proxy points.
+struct RPYCluster
+{
+    double center[NDIM], half_width[NDIM], radius;
+    int begin, end;
+    std::vector<int> children;
+    std::vector<double> F_hat;
+};
+
+// Compute the barycentric Lagrange basis functions L[0], ..., L[p] associated
+// with the Chebyshev points of the second kind on [c - h, c + h] at x.
+void
+getChebyshevBasis(const double x, const double c, const double h, const int p, double* const L)
+{
+    double sum = 0.0;
+    for (int k = 0; k <= p; ++k)
+    {
+        const double diff = x - (c + h * std::cos(k * M_PI / p));
+        if (std::abs(diff) <= ZERO_TOL * std::max(h, 1.0))
+        {
+            std::fill(L, L + p + 1, 0.0);
+            L[k] = 1.0;
+            return;
+        }
+        const double w = (k % 2 == 0 ? 1.0 : -1.0) * (k == 0 || k == p ? 0.5 : 1.0);
+        L[k] = w / diff;
+        sum += L[k];
+    }
+    for (int k = 0; k <= p; ++k) L[k] /= sum;
+    return;
+} // getChebyshevBasis
+
+// Build the cluster tree for N markers, dividing each cluster with more than
+// max_leaf_size markers into (up to) 2^NDIM children.
+void
+buildRPYClusterTree(const double* const X,
+                    const int N,
+                    const int max_leaf_size,
+                    std::vector<int>& idxs,
+                    std::vector<RPYCluster>& clusters)
+{
+    idxs.resize(N);
+    for (int i = 0; i < N; ++i) idxs[i] = i;
+    clusters.assign(1, RPYCluster());
+    clusters[0].begin = 0;
+    clusters[0].end = N;
+    for (unsigned int c = 0; c < clusters.size(); ++c)
+    {
+        // Determine the bounding box of the markers.
+        double x_lo[NDIM], x_up[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            x_lo[d] = std::numeric_limits<double>::max();
+            x_up[d] = -std::numeric_limits<double>::max();
+        }
+        for (int n = clusters[c].begin; n < clusters[c].end; ++n)
+        {
+            for (int d = 0; d < NDIM; ++d)
+            {
+                x_lo[d] = std::min(x_lo[d], X[idxs[n] * NDIM + d]);
+                x_up[d] = std::max(x_up[d], X[idxs[n] * NDIM + d]);
+            }
+        }
+        double radius_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            clusters[c].center[d] = 0.5 * (x_lo[d] + x_up[d]);
+            clusters[c].half_width[d] = 0.5 * (x_up[d] - x_lo[d]);
+            radius_sq += clusters[c].half_width[d] * clusters[c].half_width[d];
+        }
+        clusters[c].radius = std::sqrt(radius_sq);
+        if (clusters[c].end - clusters[c].begin <= max_leaf_size || clusters[c].radius == 0.0) continue;
+
+        // Sort the markers by the child that contains them.
+        static const int NUM_CHILDREN = 1 << NDIM;
+        std::vector<std::vector<int> > child_idxs(NUM_CHILDREN);
+        for (int n = clusters[c].begin; n < clusters[c].end; ++n)
+        {
+            int child = 0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                if (X[idxs[n] * NDIM + d] > clusters[c].center[d]) child |= 1 << d;
+            }
+            child_idxs[child].push_back(idxs[n]);
+        }
+        int pos = clusters[c].begin;
+        for (int child = 0; child < NUM_CHILDREN; ++child)
+        {
+            if (child_idxs[child].empty()) continue;
+            std::copy(child_idxs[child].begin(), child_idxs[child].end(), idxs.begin() + pos);
+            RPYCluster child_cluster = RPYCluster();
+            child_cluster.begin = pos;
+            child_cluster.end = pos + static_cast<int>(child_idxs[child].size());
+            pos = child_cluster.end;
+            clusters[c].children.push_back(static_cast<int>(clusters.size()));
+            clusters.push_back(child_cluster);
+        }
+    }
+    return;
+} // buildRPYClusterTree
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -665,35 +811,20 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
 
                 const double rsq = get_sqnorm(r_vec);
                 const double r = std::sqrt(rsq);
+                double F_R, G_R;
+                getRPYMobilityComponents(r, HRad, &F_R, &G_R);
                 int idir, jdir;
                 for (idir = 0; idir < NDIM; idir++)
                     for (jdir = 0; jdir <= idir; jdir++)
                     {
                         const int index = (col * NDIM + jdir) * size + row * NDIM + idir; // column-major for LAPACK
-                        if (r <= 2.0 * HRad)
-                        {
-                            MM[index] = (mu_tt * (1 - 9.0 / 32.0 * r / HRad) - PERIODIC_CORRECTION) * KRON(idir, jdir) +
-                                        mu_tt * r_vec[idir] * r_vec[jdir] / rsq * 3.0 * r / 32. / HRad;
-                            MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
-                            if (idir != jdir)
-                            {
-                                MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
-                                MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
-                            }
-                        }
-                        else
+                        MM[index] = (mu_tt * F_R - PERIODIC_CORRECTION) * KRON(idir, jdir) +
+                                    mu_tt * G_R * r_vec[idir] * r_vec[jdir] / rsq;
+                        MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
+                        if (idir != jdir)
                         {
-                            double cube = HRad * HRad * HRad / r / r / r;
-                            MM[index] =
-                                (mu_tt * (3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION) *
-                                    KRON(idir, jdir) +
-                                mu_tt * r_vec[idir] * r_vec[jdir] / rsq * (3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube);
-                            MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
-                            if (idir != jdir)
-                            {
-                                MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
-                                MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
-                            }
+                            MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
+                            MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
                         }
                     } // jdir
             }
@@ -701,6 +832,169 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+void
+MobilityFunctions::applyRPYMobilityMatrix(const char* IBKernelName,
+                                          const double MU,
+                                          const double DX,
+                                          const double* X,
+                                          const int N,
+                                          const double PERIODIC_CORRECTION,
+                                          const double* F,
+                                          double* U,
+                                          const double MAC_THETA,
+                                          const int INTERP_DEGREE)
+{
+    HRad = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * HRad);
+
+    // The periodic correction is subtracted from the diagonal of every NDIM x
+    // NDIM block, so its contribution only depends on the net force.
+    double F_net[NDIM];
+    for (int d = 0; d < NDIM; ++d) F_net[d] = 0.0;
+    for (int col = 0; col < N; ++col)
+    {
+        for (int d = 0; d < NDIM; ++d) F_net[d] += F[col * NDIM + d];
+    }
+    for (int row = 0; row < N; ++row)
+    {
+        for (int d = 0; d < NDIM; ++d) U[row * NDIM + d] = mu_tt * F[row * NDIM + d] - PERIODIC_CORRECTION * F_net[d];
+    }
+
+    if (MAC_THETA > 0.0 && INTERP_DEGREE < 1)
+    {
+        TBOX_ERROR("MobilityFunctions::applyRPYMobilityMatrix(): Invalid interpolation degree " << INTERP_DEGREE
+                                                                                               << std::endl);
+    }
+
+    // Small systems are summed directly, because the treecode cannot
+    // approximate enough interactions to make up for its overhead.
+    int num_proxies = 1;
+    for (int d = 0; d < NDIM; ++d) num_proxies *= INTERP_DEGREE + 1;
+    if (MAC_THETA <= 0.0 || N <= MIN_TREECODE_PROXY_RATIO * num_proxies)
+    {
+        // Accumulate the pairwise interactions, using the symmetry of the RPY
+        // tensor to visit each pair once.
+        double r_vec[NDIM];
+        for (int row = 0; row < N; ++row)
+        {
+            const double* const X_row = X + row * NDIM;
+            const double* const F_row = F + row * NDIM;
+            double* const U_row = U + row * NDIM;
+            for (int col = 0; col < row; ++col)
+            {
+                const double* const X_col = X + col * NDIM;
+                const double* const F_col = F + col * NDIM;
+                double* const U_col = U + col * NDIM;
+                for (int d = 0; d < NDIM; ++d) r_vec[d] = X_row[d] - X_col[d]; // r(i) - r(j)
+
+                const double rsq = get_sqnorm(r_vec);
+                const double r = std::sqrt(rsq);
+                double F_R, G_R;
+                getRPYMobilityComponents(r, HRad, &F_R, &G_R);
+                F_R *= mu_tt;
+                G_R *= mu_tt / rsq;
+
+                double r_dot_F_row = 0.0, r_dot_F_col = 0.0;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    r_dot_F_row += r_vec[d] * F_row[d];
+                    r_dot_F_col += r_vec[d] * F_col[d];
+                }
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    U_row[d] += F_R * F_col[d] + G_R * r_vec[d] * r_dot_F_col;
+                    U_col[d] += F_R * F_row[d] + G_R * r_vec[d] * r_dot_F_row;
+                }
+            }
+        }
+        return;
+    }
+
+    // Otherwise, use a barycentric Lagrange treecode: the interactions with
+    // a well-separated cluster of markers are approximated by interpolating
+    // the RPY tensor at the Chebyshev proxy points of the cluster's bounding
+    // box.  A cluster is well separated from a marker if its radius is less
+    // than MAC_THETA times the distance to its center, and if all of its
+    // proxy points are more than 2*HRad away from the marker, so that the
+    // interpolated tensor is smooth.
+    const int p = INTERP_DEGREE;
+    std::vector<int> idxs;
+    std::vector<RPYCluster> clusters;
+    buildRPYClusterTree(X, N, num_proxies, idxs, clusters);
+
+    // Compute the modified forces at the proxy points of each cluster that
+    // contains more markers than proxy points.
+    std::vector<double> cos_k(p + 1);
+    for (int k = 0; k <= p; ++k) cos_k[k] = std::cos(k * M_PI / p);
+    std::vector<double> L(NDIM * (p + 1));
+    for (auto& cluster : clusters)
+    {
+        if (cluster.end - cluster.begin <= num_proxies) continue;
+        cluster.F_hat.assign(NDIM * num_proxies, 0.0);
+        for (int n = cluster.begin; n < cluster.end; ++n)
+        {
+            const double* const X_n = X + idxs[n] * NDIM;
+            const double* const F_n = F + idxs[n] * NDIM;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                getChebyshevBasis(X_n[d], cluster.center[d], cluster.half_width[d], p, &L[d * (p + 1)]);
+            }
+            for (int q = 0; q < num_proxies; ++q)
+            {
+                double weight = 1.0;
+                for (int d = 0, r = q; d < NDIM; ++d, r /= p + 1) weight *= L[d * (p + 1) + r % (p + 1)];
+                for (int d = 0; d < NDIM; ++d) cluster.F_hat[q * NDIM + d] += weight * F_n[d];
+            }
+        }
+    }
+
+    // Compute the velocity of each marker by traversing the tree.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for (int row = 0; row < N; ++row)
+    {
+        const double* const X_row = X + row * NDIM;
+        double* const U_row = U + row * NDIM;
+        double r_vec[NDIM];
+        std::vector<int> stack(1, 0);
+        while (!stack.empty())
+        {
+            const RPYCluster& cluster = clusters[stack.back()];
+            stack.pop_back();
+            for (int d = 0; d < NDIM; ++d) r_vec[d] = X_row[d] - cluster.center[d];
+            const double dist = std::sqrt(get_sqnorm(r_vec));
+            const bool well_separated = cluster.radius < MAC_THETA * dist && dist - cluster.radius > 2.0 * HRad;
+            if (well_separated && !cluster.F_hat.empty())
+            {
+                for (int q = 0; q < num_proxies; ++q)
+                {
+                    for (int d = 0, r = q; d < NDIM; ++d, r /= p + 1)
+                    {
+                        r_vec[d] = X_row[d] - (cluster.center[d] + cluster.half_width[d] * cos_k[r % (p + 1)]);
+                    }
+                    addRPYInteraction(r_vec, &cluster.F_hat[q * NDIM], mu_tt, U_row);
+                }
+            }
+            else if (well_separated || cluster.children.empty())
+            {
+                for (int n = cluster.begin; n < cluster.end; ++n)
+                {
+                    const int col = idxs[n];
+                    if (col == row) continue;
+                    for (int d = 0; d < NDIM; ++d) r_vec[d] = X_row[d] - X[col * NDIM + d];
+                    addRPYInteraction(r_vec, F + col * NDIM, mu_tt, U_row);
+                }
+            }
+            else
+            {
+                stack.insert(stack.end(), cluster.children.begin(), cluster.children.end());
+            }
+        }
+    }
+    return;
+} // applyRPYMobilityMatrix
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // IBAMR
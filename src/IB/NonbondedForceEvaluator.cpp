@@ -32,6 +32,10 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "ibamr/NonbondedForceEvaluator.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/LNodeSetData.h"
@@ -71,6 +75,13 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
     // this will only work if the domain is a single box.
     assert(d_grid_geometry->getDomainIsSingleBox());
 
+    // get the (optional) Verlet list skin
+    d_verlet_skin = input_db->getDoubleWithDefault("verlet_skin", d_verlet_skin);
+    if (d_verlet_skin < 0.0)
+    {
+        TBOX_ERROR("verlet_skin for NonbondedForceEvaluator must be nonnegative.");
+    }
+
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
 }
@@ -79,7 +90,7 @@ void
 NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
                                         int search_petsc_idx,
                                         Pointer<LData> X_data,
-                                        std::vector<int> cell_offset,
+                                        const std::vector<int>& cell_offset,
                                         Pointer<LData> F_data)
 {
     //   Function to add nonbonded forces from the interaction between the nodes at
@@ -97,10 +108,12 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //          F_data - pointer to LData object containing forces on particles.  Will
     //                   be added to by this function.
     //
+    //   note: computeLagrangianForce() does not call this function; it fetches the
+    //   arrays once and evaluates all pairs in a batch.
+    //
     //////////////////////////////////////////////////////////////////////////////////
 
     // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
     PetscScalar* position;
     VecGetArray(X_data->getVec(), &position);
     PetscScalar* force;
@@ -129,9 +142,23 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
         force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
     }
     VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
     return;
 } // evaluateForces
 
+void
+NonbondedForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                             const int /*level_number*/,
+                                             const double /*init_data_time*/,
+                                             const bool /*initial_time*/,
+                                             LDataManager* const /*l_data_manager*/)
+{
+    // The local PETSc indices stored in the Verlet list are invalidated when
+    // the Lagrangian data are redistributed.
+    d_verlet_list_valid = false;
+    return;
+} // initializeLevelData
+
 void
 NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 Pointer<LData> X_data,
@@ -147,14 +174,155 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
 
     // These will only work if the domain is a single box.
     assert(grid_geom->getDomainIsSingleBox());
+
+    // Determine the grid spacing on the level.
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const double* const dx0 = grid_geom->getDx();
+    double dx[NDIM];
+    for (int k = 0; k < NDIM; ++k) dx[k] = dx0[k] / static_cast<double>(ratio(k));
+
+    // Get the positions of the local and ghost nodes, and the forces on the
+    // local nodes.
+    X_data->beginGhostUpdate();
+    X_data->endGhostUpdate();
+    const int num_local_nodes = X_data->getLocalNodeCount();
+    const int num_ghosted_nodes = num_local_nodes + X_data->getGhostNodeCount();
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+
+    // Rebuild the Verlet list if any node has moved too far.
+    if (!verletListIsValid(X_node, num_ghosted_nodes, dx))
+    {
+        buildVerletList(X_node, num_local_nodes, num_ghosted_nodes, dx, hierarchy, level_number, l_data_manager);
+    }
+
+    // Compute the separation vectors of all pairs.
+    const int num_pairs = static_cast<int>(d_pair_mstr_idxs.size());
+    d_D_pairs.resize(NDIM * num_pairs);
+    d_F_pairs.resize(NDIM * num_pairs);
+    const int* const mstr_idxs = d_pair_mstr_idxs.data();
+    const int* const search_idxs = d_pair_search_idxs.data();
+    const double* const shifts = d_pair_shifts.data();
+    double* const D_pairs = d_D_pairs.data();
+    double* const F_pairs = d_F_pairs.data();
+    for (int n = 0; n < num_pairs; ++n)
+    {
+        const double* const X_mstr = X_node + NDIM * mstr_idxs[n];
+        const double* const X_search = X_node + NDIM * search_idxs[n];
+        for (int k = 0; k < NDIM; ++k)
+        {
+            D_pairs[NDIM * n + k] = X_mstr[k] - X_search[k] - shifts[NDIM * n + k];
+        }
+    }
+
+    // Evaluate the force function for all pairs.
+    for (int n = 0; n < num_pairs; ++n)
+    {
+        (d_force_fcn_ptr)(D_pairs + NDIM * n, d_parameters, F_pairs + NDIM * n);
+    }
+
+    // Accumulate the forces on the local nodes.  Pairs that couple a local node
+    // to a ghost node are also evaluated by the process that owns the ghost
+    // node, so only the local node is updated here.
+    for (int n = 0; n < num_pairs; ++n)
+    {
+        double* const F_mstr = F_node + NDIM * mstr_idxs[n];
+        for (int k = 0; k < NDIM; ++k) F_mstr[k] += F_pairs[NDIM * n + k];
+    }
+    for (int n = 0; n < d_num_local_pairs; ++n)
+    {
+        double* const F_search = F_node + NDIM * search_idxs[n];
+        for (int k = 0; k < NDIM; ++k) F_search[k] -= F_pairs[NDIM * n + k];
+    }
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
+} // computeLagrangianForce
+
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+int
+NonbondedForceEvaluator::getNumberOfVerletListBuilds() const
+{
+    return d_num_verlet_list_builds;
+} // getNumberOfVerletListBuilds
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+bool
+NonbondedForceEvaluator::verletListIsValid(const double* const X_node,
+                                           const int num_ghosted_nodes,
+                                           const double* const dx) const
+{
+    // Without a skin, the list is rebuilt every time it is used.
+    if (!d_verlet_list_valid || d_verlet_skin <= 0.0) return false;
+    if (static_cast<int>(d_X_verlet.size()) != NDIM * num_ghosted_nodes) return false;
+
+    // The list remains valid as long as no node used by this process (local or
+    // ghost) has moved more than half of the skin since the list was built.
+    // Because every process checks all of the nodes that it uses, no global
+    // reduction is required.
+    const double max_disp_sq = 0.25 * d_verlet_skin * d_verlet_skin;
+    for (int i = 0; i < num_ghosted_nodes; ++i)
+    {
+        double disp_sq = 0.0;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            const double disp = (X_node[NDIM * i + k] - d_X_verlet[NDIM * i + k]) / dx[k];
+            disp_sq += disp * disp;
+        }
+        if (disp_sq > max_disp_sq) return false;
+    }
+    return true;
+} // verletListIsValid
+
+void
+NonbondedForceEvaluator::buildVerletList(const double* const X_node,
+                                         const int num_local_nodes,
+                                         const int num_ghosted_nodes,
+                                         const double* const dx,
+                                         const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                         const int level_number,
+                                         LDataManager* const l_data_manager)
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
 
-    // we will grow the search box by interaction_radius + 2.0*regrid_alpha
-    IntVector<NDIM> grow_amount(int(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
+    // we will grow the search box by interaction_radius + 2.0*regrid_alpha,
+    // plus the Verlet skin.  Pairs farther apart than interaction_radius +
+    // verlet_skin are discarded only when a skin is used.
+    IntVector<NDIM> grow_amount(int(ceil(d_interaction_radius + 2.0 * d_regrid_alpha + d_verlet_skin)));
+    const bool use_cutoff = d_verlet_skin > 0.0;
+    const double cutoff_sq = std::pow(d_interaction_radius + d_verlet_skin, 2);
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
-    // iterate through levels.
+    // Nodes are only available within the ghost cells of each patch, so pairs
+    // can only be found if the ghost cell width of the Lagrangian index data
+    // is at least as large as the search distance.
+    const IntVector<NDIM>& ghost_width = l_data_manager->getGhostCellWidth();
+    if (!(ghost_width >= grow_amount))
+    {
+        TBOX_ERROR("NonbondedForceEvaluator::computeLagrangianForce():\n"
+                   << "  the Lagrangian data ghost cell width " << ghost_width
+                   << " is smaller than the nonbonded search distance " << grow_amount << ".\n"
+                   << "  increase the ghost cell width of the LDataManager or decrease interaction_radius, "
+                      "regrid_alpha, or verlet_skin.\n");
+    }
+
+    std::vector<int> ghost_mstr_idxs, ghost_search_idxs;
+    std::vector<double> ghost_shifts;
+    d_pair_mstr_idxs.clear();
+    d_pair_search_idxs.clear();
+    d_pair_shifts.clear();
+
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
@@ -164,74 +332,101 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
 
-        std::vector<int> cell_offset(NDIM);
+        double shift[NDIM];
         // Loop through cells in this processors patch. For each iteration, this
         // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
+        // pairs.
         for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
         {
             // get list of particles in this cell
             const Index<NDIM>& first_cell_idx = *cit;
             LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            if (!mstr_node_set) continue;
+            Box<NDIM> search_box(first_cell_idx, first_cell_idx);
+            // loop over neighboring cells, up to interaction_radius +
+            // 2*regrid_alpha + verlet_skin away.
+            for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+                const Index<NDIM>& search_cell_idx = *scit;
+                LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
+                if (!search_node_set) continue;
+
+                // Pairs of local nodes are found from the "forward" half of
+                // the neighboring cells, in which the last nonzero component
+                // of the offset of the search cell is positive, so that each
+                // such pair is found once.  Pairs with a ghost node are found
+                // from all neighboring cells, because they are also evaluated
+                // by the process that owns the ghost node.  Cells in the
+                // backward half that lie within the patch contain only local
+                // nodes and are skipped.
+                int offset_sign = 0;
+                for (int k = NDIM - 1; k >= 0 && offset_sign == 0; --k)
                 {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const Index<NDIM>& search_cell_idx = *scit;
-
-                    // search across periodic boundaries.
-                    for (int k = 0; k < NDIM; ++k)
-                    {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
-                    }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+                    offset_sign = (search_cell_idx(k) > first_cell_idx(k)) - (search_cell_idx(k) < first_cell_idx(k));
+                }
+                if (offset_sign < 0 && patch_box.contains(search_cell_idx)) continue;
+
+                // search across periodic boundaries.
+                for (int k = 0; k < NDIM; ++k)
+                {
+                    // Difference between lower boundary and this search cell.
+                    double absolute_diff = search_cell_idx[k] * patch_dx[k];
+                    // Periodic offset of this cell.
+                    shift[k] = floor(absolute_diff / (x_upper[k] - x_lower[k])) * (x_upper[k] - x_lower[k]);
+                }
+
+                for (const auto& mstr_node_idx : *mstr_node_set)
+                {
+                    // master nodes
+                    const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
+                    const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                    for (const auto& search_node_idx : *search_node_set)
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (const auto& mstr_node_idx : *mstr_node_set)
+                        const int search_lag_idx = search_node_idx->getLagrangianIndex();
+                        const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
+                        const bool search_is_local = search_petsc_idx < num_local_nodes;
+                        if (search_is_local &&
+                            (offset_sign < 0 || (offset_sign == 0 && mstr_lag_idx >= search_lag_idx)))
                         {
-                            // master nodes
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
-
-                            for (const auto& search_node_idx : *search_node_set)
+                            continue;
+                        }
+                        if (use_cutoff)
+                        {
+                            double r_sq = 0.0;
+                            for (int k = 0; k < NDIM; ++k)
                             {
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
-    return;
-} // computeLagrangianForce
+                                const double D = (X_node[NDIM * mstr_petsc_idx + k] -
+                                                  X_node[NDIM * search_petsc_idx + k] - shift[k]) /
+                                                 dx[k];
+                                r_sq += D * D;
+                            }
+                            if (r_sq > cutoff_sq) continue;
+                        }
+                        std::vector<int>& mstr_idxs = search_is_local ? d_pair_mstr_idxs : ghost_mstr_idxs;
+                        std::vector<int>& search_idxs = search_is_local ? d_pair_search_idxs : ghost_search_idxs;
+                        std::vector<double>& shifts = search_is_local ? d_pair_shifts : ghost_shifts;
+                        mstr_idxs.push_back(mstr_petsc_idx);
+                        search_idxs.push_back(search_petsc_idx);
+                        shifts.insert(shifts.end(), shift, shift + NDIM);
+                    } // search node index
+                }     // mstr node index
+            }         // search cell loop
+        }             // first cell
+    }                 // patches
 
-void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
-{
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+    // Store the pairs of local nodes first, followed by the pairs that involve
+    // ghost nodes.
+    d_num_local_pairs = static_cast<int>(d_pair_mstr_idxs.size());
+    d_pair_mstr_idxs.insert(d_pair_mstr_idxs.end(), ghost_mstr_idxs.begin(), ghost_mstr_idxs.end());
+    d_pair_search_idxs.insert(d_pair_search_idxs.end(), ghost_search_idxs.begin(), ghost_search_idxs.end());
+    d_pair_shifts.insert(d_pair_shifts.end(), ghost_shifts.begin(), ghost_shifts.end());
+
+    // Record the positions used to build the list.
+    d_X_verlet.assign(X_node, X_node + NDIM * num_ghosted_nodes);
+    d_verlet_list_valid = true;
+    ++d_num_verlet_list_builds;
     return;
-} // registerForceFcnPtr
+} // buildVerletList
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -83,22 +84,6 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
-namespace
-{
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
-}
-
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffStochasticForcing::AdvDiffStochasticForcing(std::string object_name,
@@ -112,6 +97,9 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(std::string object_name,
     {
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         int k = 0;
         std::string key_name = "weights_0";
         while (input_db->keyExists(key_name))
@@ -250,6 +238,8 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            const std::uint32_t rng_key[2] = { static_cast<std::uint32_t>(d_rng_seed),
+                                               static_cast<std::uint32_t>(d_adv_diff_solver->getIntegratorStep()) };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -261,7 +251,18 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d);
+                            if (d_use_counter_based_rng)
+                            {
+                                RNG::genrandn(F_sc_data->getArrayData(d),
+                                              side_box,
+                                              rng_key,
+                                              RNG::getStream(level_num, k, d));
+                            }
+                            else
+                            {
+                                RNG::genrandn(F_sc_data->getArrayData(d), side_box);
+                            }
                         }
                     }
                 }
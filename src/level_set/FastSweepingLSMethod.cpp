@@ -32,7 +32,11 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+
 #include "ibamr/FastSweepingLSMethod.h"
+#include "Box.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IBAMR_config.h"
@@ -82,6 +86,222 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Sweep directions, in the order used by the Fortran fast sweeping routines.
+#if (NDIM == 2)
+static const int NUM_SWEEP_DIRS = 4;
+static const int SWEEP_DIRS[NUM_SWEEP_DIRS][NDIM] = { { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 } };
+#endif
+#if (NDIM == 3)
+static const int NUM_SWEEP_DIRS = 8;
+static const int SWEEP_DIRS[NUM_SWEEP_DIRS][NDIM] = { { 1, 1, 1 },   { -1, 1, 1 },  { 1, -1, 1 },  { 1, 1, -1 },
+                                                      { -1, -1, 1 }, { 1, -1, -1 }, { -1, 1, -1 }, { -1, -1, -1 } };
+#endif
+
+// Compute the first-order fast sweeping update of the cell with the given
+// index.  This is the same update as the one carried out by the Fortran
+// routines evalsweep1storder2d and evalsweep1storder3d.
+inline void
+eval_sweep_1st_order(double* const U,
+                     const int idx,
+                     const int* const i,
+                     const int* const stride,
+                     const double* const dx,
+                     const Box<NDIM>& domain_box,
+                     const bool patch_touches_bdry,
+                     const int* const touches_wall_loc_idx)
+{
+    const double U_idx = U[idx];
+    if (U_idx == 0.0) return;
+    const double sgn = U_idx > 0.0 ? 1.0 : -1.0;
+
+    double a[NDIM], h[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        a[d] = sgn * std::min(sgn * U[idx - stride[d]], sgn * U[idx + stride[d]]);
+        h[d] = dx[d];
+
+        // Take care of physical boundaries.  The grid spacing to the boundary
+        // will be h/2 and the distance value imposed at the boundary is zero.
+        if (patch_touches_bdry && ((i[d] == domain_box.lower(d) && touches_wall_loc_idx[2 * d]) ||
+                                   (i[d] == domain_box.upper(d) && touches_wall_loc_idx[2 * d + 1])))
+        {
+            a[d] = 0.0;
+            h[d] *= 0.5;
+        }
+    }
+
+    double dbar;
+#if (NDIM == 2)
+    if (sgn * (a[1] - a[0]) > h[0])
+    {
+        dbar = a[0] + sgn * h[0];
+    }
+    else if (sgn * (a[0] - a[1]) > h[1])
+    {
+        dbar = a[1] + sgn * h[1];
+    }
+    else
+    {
+        const double Q = h[0] * h[0] + h[1] * h[1];
+        const double R = -2.0 * (h[1] * h[1] * a[0] + h[0] * h[0] * a[1]);
+        const double S = h[1] * h[1] * a[0] * a[0] + h[0] * h[0] * a[1] * a[1] - h[0] * h[0] * h[1] * h[1];
+        dbar = (-R + sgn * std::sqrt(R * R - 4.0 * Q * S)) / (2.0 * Q);
+    }
+#endif
+#if (NDIM == 3)
+    // Sort the neighboring values (and the corresponding grid spacings).
+    int p1, p2, p3;
+    if (sgn * a[0] <= sgn * a[1])
+    {
+        if (sgn * a[0] <= sgn * a[2])
+        {
+            p1 = 0;
+            if (sgn * a[1] <= sgn * a[2])
+            {
+                p2 = 1;
+                p3 = 2;
+            }
+            else
+            {
+                p2 = 2;
+                p3 = 1;
+            }
+        }
+        else
+        {
+            p1 = 2;
+            p2 = 0;
+            p3 = 1;
+        }
+    }
+    else
+    {
+        if (sgn * a[1] <= sgn * a[2])
+        {
+            p1 = 1;
+            if (sgn * a[0] <= sgn * a[2])
+            {
+                p2 = 0;
+                p3 = 2;
+            }
+            else
+            {
+                p2 = 2;
+                p3 = 0;
+            }
+        }
+        else
+        {
+            p1 = 2;
+            p2 = 1;
+            p3 = 0;
+        }
+    }
+    const double a1 = a[p1], a2 = a[p2], a3 = a[p3];
+    const double h1 = h[p1], h2 = h[p2], h3 = h[p3];
+
+    double dtil = a1 + sgn * h1;
+    if (sgn * dtil > sgn * a2)
+    {
+        const double Q = h1 * h1 + h2 * h2;
+        const double R = -2.0 * (h2 * h2 * a1 + h1 * h1 * a2);
+        const double S = h2 * h2 * a1 * a1 + h1 * h1 * a2 * a2 - h1 * h1 * h2 * h2;
+        dtil = (-R + sgn * std::sqrt(R * R - 4.0 * Q * S)) / (2.0 * Q);
+    }
+    if (sgn * dtil < sgn * a3)
+    {
+        dbar = dtil;
+    }
+    else
+    {
+        const double Q = 1.0 / (h1 * h1) + 1.0 / (h2 * h2) + 1.0 / (h3 * h3);
+        const double R = -2.0 * (a1 / (h1 * h1) + a2 / (h2 * h2) + a3 / (h3 * h3));
+        const double S = a1 * a1 / (h1 * h1) + a2 * a2 / (h2 * h2) + a3 * a3 / (h3 * h3) - 1.0;
+        dbar = (-R + sgn * std::sqrt(R * R - 4.0 * Q * S)) / (2.0 * Q);
+    }
+#endif
+    U[idx] = sgn * std::min(sgn * U_idx, sgn * dbar);
+    return;
+} // eval_sweep_1st_order
+
+// Carry out the first-order fast sweeping algorithm on a patch, visiting the
+// cells of each sweep one hyperplane at a time.  A cell only depends on its
+// face neighbors, which lie on the adjacent hyperplanes, so the cells within a
+// hyperplane may be updated concurrently.
+void
+hyperplane_fast_sweep_1st_order(double* const U,
+                                const int U_gcw,
+                                const Box<NDIM>& patch_box,
+                                const Box<NDIM>& domain_box,
+                                const double* const dx,
+                                const bool patch_touches_bdry,
+                                const int* const touches_wall_loc_idx)
+{
+    int n[NDIM], stride[NDIM];
+    int num_planes = 1;
+    for (int d = 0, s = 1; d < NDIM; ++d)
+    {
+        n[d] = patch_box.numberCells(d);
+        stride[d] = s;
+        s *= n[d] + 2 * U_gcw;
+        num_planes += n[d] - 1;
+    }
+
+    for (const auto& dir : SWEEP_DIRS)
+    {
+        // Update the cell with the given offsets from the corner of the patch
+        // at which the sweep starts.
+        auto sweep_cell = [&](const int* const j) {
+            int i[NDIM];
+            int idx = 0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                i[d] = dir[d] > 0 ? patch_box.lower(d) + j[d] : patch_box.upper(d) - j[d];
+                idx += (i[d] - patch_box.lower(d) + U_gcw) * stride[d];
+            }
+            eval_sweep_1st_order(U, idx, i, stride, dx, domain_box, patch_touches_bdry, touches_wall_loc_idx);
+        };
+
+        for (int p = 0; p < num_planes; ++p)
+        {
+#if (NDIM == 2)
+            const int j1_lower = std::max(0, p - (n[0] - 1));
+            const int j1_upper = std::min(n[1] - 1, p);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int j1 = j1_lower; j1 <= j1_upper; ++j1)
+            {
+                const int j[NDIM] = { p - j1, j1 };
+                sweep_cell(j);
+            }
+#endif
+#if (NDIM == 3)
+            const int j2_lower = std::max(0, p - (n[0] - 1) - (n[1] - 1));
+            const int j2_upper = std::min(n[2] - 1, p);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int j2 = j2_lower; j2 <= j2_upper; ++j2)
+            {
+                const int q = p - j2;
+                const int j1_lower = std::max(0, q - (n[0] - 1));
+                const int j1_upper = std::min(n[1] - 1, q);
+                for (int j1 = j1_lower; j1 <= j1_upper; ++j1)
+                {
+                    const int j[NDIM] = { q - j1, j1, j2 };
+                    sweep_cell(j);
+                }
+            }
+#endif
+        }
+    }
+    return;
+} // hyperplane_fast_sweep_1st_order
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(std::string object_name, Pointer<Database> db, bool register_for_restart)
@@ -274,7 +494,12 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 
     const Box<NDIM>& patch_box = patch->getBox();
     const double* const dx = pgeom->getDx();
-    if (d_ls_order == FIRST_ORDER_LS)
+    if (d_ls_order == FIRST_ORDER_LS && d_use_hyperplane_sweep)
+    {
+        hyperplane_fast_sweep_1st_order(
+            D, D_ghosts, patch_box, domain_box, dx, patch_touches_bdry, touches_wall_loc_idx);
+    }
+    else if (d_ls_order == FIRST_ORDER_LS)
     {
         FAST_SWEEP_1ST_ORDER_FC(D,
                                 D_ghosts,
@@ -322,6 +547,8 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_use_hyperplane_sweep = input_db->getBoolWithDefault("use_hyperplane_sweep", d_use_hyperplane_sweep);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
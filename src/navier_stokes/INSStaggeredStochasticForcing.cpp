@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -163,19 +164,6 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
     extended_box.upper()(data_axis) += 1;
     return extended_box;
 } // compute_tangential_extension
-
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -194,6 +182,9 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(std::string object_
                 string_to_enum<StochasticStressTensorType>(input_db->getString("stress_tensor_type"));
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         int k = 0;
         std::string key_name = "weights_0";
         while (input_db->keyExists(key_name))
@@ -281,6 +272,8 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            const std::uint32_t rng_key[2] = { static_cast<std::uint32_t>(d_rng_seed),
+                                               static_cast<std::uint32_t>(d_fluid_solver->getIntegratorStep()) };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -290,16 +283,46 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        if (d_use_counter_based_rng)
+                        {
+                            RNG::genrandn(W_cc_data->getArrayData(),
+                                          W_cc_data->getBox(),
+                                          rng_key,
+                                          RNG::getStream(level_num, k, 0));
+                        }
+                        else
+                        {
+                            RNG::genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        }
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        const Box<NDIM> node_box = NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox());
+                        if (d_use_counter_based_rng)
+                        {
+                            RNG::genrandn(
+                                W_nc_data->getArrayData(), node_box, rng_key, RNG::getStream(level_num, k, 1));
+                        }
+                        else
+                        {
+                            RNG::genrandn(W_nc_data->getArrayData(), node_box);
+                        }
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            const Box<NDIM> edge_box = EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d);
+                            if (d_use_counter_based_rng)
+                            {
+                                RNG::genrandn(W_ec_data->getArrayData(d),
+                                              edge_box,
+                                              rng_key,
+                                              RNG::getStream(level_num, k, 1 + d));
+                            }
+                            else
+                            {
+                                RNG::genrandn(W_ec_data->getArrayData(d), edge_box);
+                            }
                         }
 #endif
                     }
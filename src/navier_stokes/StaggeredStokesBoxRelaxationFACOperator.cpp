@@ -34,7 +34,6 @@
 
 #include <array>
 #include <algorithm>
-#include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -45,7 +44,6 @@
 #include "Box.h"
 #include "BoxList.h"
 #include "CartesianGridGeometry.h"
-#include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
 #include "Index.h"
@@ -58,17 +56,10 @@
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
 #include "SideGeometry.h"
-#include "SideIndex.h"
 #include "ibamr/StaggeredStokesBoxRelaxationFACOperator.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
-#include "ibtk/IBTK_CHKERRQ.h"
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscpc.h"
-#include "petscsys.h"
-#include "petscvec.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -85,363 +76,11 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GHOSTS = 1;
 
-inline int
-compute_side_index(const Index<NDIM>& i, const Box<NDIM>& box, const unsigned int axis)
-{
-    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-    if (!side_box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int d = 0; d < axis; ++d)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, d).size();
-    }
-    return offset + side_box.offset(i);
-} // compute_side_index
-
-inline int
-compute_cell_index(const Index<NDIM>& i, const Box<NDIM>& box)
-{
-    if (!box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, axis).size();
-    }
-    return box.offset(i) + offset;
-} // compute_cell_index
-
-void
-buildBoxOperator(Mat& A,
-                 const PoissonSpecifications& U_problem_coefs,
-                 const Box<NDIM>& box,
-                 const Box<NDIM>& ghost_box,
-                 const std::array<double, NDIM>& dx)
-{
-    int ierr;
-
-    const double C = U_problem_coefs.getCConstant();
-    const double D = U_problem_coefs.getDConstant();
-
-    // Allocate a PETSc matrix for the box operator.
-    std::array<Box<NDIM>, NDIM> side_boxes;
-    std::array<BoxList<NDIM>, NDIM> side_ghost_boxes;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        side_boxes[axis] = SideGeometry<NDIM>::toSideBox(box, axis);
-        side_ghost_boxes[axis] = SideGeometry<NDIM>::toSideBox(ghost_box, axis);
-        side_ghost_boxes[axis].removeIntersections(side_boxes[axis]);
-    }
-    BoxList<NDIM> cell_ghost_boxes(ghost_box);
-    cell_ghost_boxes.removeIntersections(box);
-
-    int size = 0;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        size += SideGeometry<NDIM>::toSideBox(ghost_box, axis).size();
-    }
-    size += ghost_box.size();
-
-    static const int U_stencil_sz = 2 * NDIM + 3;
-    static const int P_stencil_sz = 2 * NDIM + 1;
-    std::vector<int> nnz(size, 0);
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
-        {
-            nnz[compute_side_index(b(), ghost_box, axis)] = std::min(size, U_stencil_sz);
-        }
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
-        {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
-            {
-                nnz[compute_side_index(b(), ghost_box, axis)] = 1;
-            }
-        }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        nnz[compute_cell_index(b(), ghost_box)] = std::min(size, P_stencil_sz);
-    }
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
-    {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
-        {
-            nnz[compute_cell_index(b(), ghost_box)] = 1;
-        }
-    }
-
-    ierr = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 0, size ? &nnz[0] : nullptr, &A);
-    IBTK_CHKERRQ(ierr);
-
-// Set some general matrix options.
-#if !defined(NDEBUG)
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-#endif
-
-    // Set the matrix coefficients to correspond to the standard finite
-    // difference approximation to the time-dependent incompressible Stokes
-    // operator.
-    //
-    // Note that boundary conditions at both physical boundaries and at
-    // coarse-fine interfaces are implicitly treated by setting ghost cell
-    // values appropriately.  Thus the matrix coefficients are independent of
-    // any boundary conditions.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
-        {
-            Index<NDIM> i = b();
-            const int mat_row = compute_side_index(i, ghost_box, axis);
-
-            std::vector<int> mat_cols(U_stencil_sz, -1);
-            std::vector<double> mat_vals(U_stencil_sz, 0.0);
-
-            mat_cols[0] = mat_row;
-            mat_vals[0] = C;
-
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const Index<NDIM> u_left = i - shift;
-                const Index<NDIM> u_rght = i + shift;
-                mat_cols[2 * d + 1] = compute_side_index(u_left, ghost_box, axis);
-                mat_cols[2 * d + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-                mat_vals[0] -= 2.0 * D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 1] = D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 2] = D / (dx[d] * dx[d]);
-            }
-
-            Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const Index<NDIM> p_left = i - shift;
-            const Index<NDIM> p_rght = i;
-            mat_cols[2 * NDIM + 1] = compute_cell_index(p_left, ghost_box);
-            mat_cols[2 * NDIM + 2] = compute_cell_index(p_rght, ghost_box);
-
-            mat_vals[2 * NDIM + 1] = -1.0 / dx[axis];
-            mat_vals[2 * NDIM + 2] = 1.0 / dx[axis];
-
-            static const int m = 1;
-            static const int n = U_stencil_sz;
-            ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        Index<NDIM> i = b();
-        const int mat_row = compute_cell_index(i, ghost_box);
-
-        std::vector<int> mat_cols(P_stencil_sz, -1);
-        std::vector<double> mat_vals(P_stencil_sz, 0.0);
-
-        mat_cols[0] = mat_row;
-        mat_vals[0] = 0.0;
-
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const Index<NDIM> u_left = i;
-            const Index<NDIM> u_rght = i + shift;
-            mat_cols[2 * axis + 1] = compute_side_index(u_left, ghost_box, axis);
-            mat_cols[2 * axis + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-            mat_vals[2 * axis + 1] = 1.0 / dx[axis];
-            mat_vals[2 * axis + 2] = -1.0 / dx[axis];
-        }
-
-        static const int m = 1;
-        static const int n = P_stencil_sz;
-        ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    // Set the entries in the ghost cell region so that ghost cell values are
-    // not modified by the smoother.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
-        {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
-            {
-                const int i = compute_side_index(b(), ghost_box, axis);
-                ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
-    }
-
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
-    {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
-        {
-            const int i = compute_cell_index(b(), ghost_box);
-            ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-
-    // Assemble the matrices.
-    ierr = MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // buildBoxOperator
-
-void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
-                const double* const dx)
-{
-    int ierr;
-
-    const double D = U_problem_coefs.getDConstant();
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
-        {
-            Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
-
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const Index<NDIM> u_left = i - shift;
-                const Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-                if (!side_box.contains(u_rght))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-
-            Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const Index<NDIM> p_left = i - shift;
-            const Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
-            {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            if (!box.contains(p_rght))
-            {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // modifyRhsForBcs
-
-inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
-        {
-            const Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // copyToVec
-
-inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    const double omega = 0.65;
-
-    double U;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
-        {
-            const Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
-        }
-    }
-
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
-    }
-    return;
-} // copyFromVec
+// Number of colors used along each coordinate direction by the multicolor
+// ordering.  The box solve for a cell reads values up to two cells away from
+// that cell, so that the box solves for cells whose indices are congruent
+// modulo three may be performed concurrently.
+static const int NUM_COLORS_PER_DIM = 3;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -452,7 +91,14 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix)
 {
-    // intentionally blank
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("smoother_damping_factor"))
+            d_smoother_damping_factor = input_db->getDouble("smoother_damping_factor");
+        if (input_db->keyExists("smoother_use_multicolor_ordering"))
+            d_smoother_use_multicolor_ordering = input_db->getBool("smoother_use_multicolor_ordering");
+    }
     return;
 } // StaggeredStokesBoxRelaxationFACOperator
 
@@ -472,7 +118,6 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
@@ -585,11 +230,8 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
         }
 
         // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        const BoxInverse& box_inv = d_box_inv[level_num];
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<SideData<NDIM, double> > U_error_data = error.getComponentPatchData(0, *patch);
@@ -609,20 +251,7 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             TBOX_ASSERT(P_residual_data->getGhostCellWidth() == d_gcw);
 #endif
             // Smooth the error on the patch.
-            const Box<NDIM>& patch_box = patch->getBox();
-            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const dx = pgeom->getDx();
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
-            {
-                const Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
-            }
+            smoothPatch(*U_error_data, *P_error_data, *U_residual_data, *P_residual_data, patch->getBox(), box_inv);
         }
     }
 
@@ -641,43 +270,52 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int coarsest_reset_ln,
                                                                             const int finest_reset_ln)
 {
-    // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
-    const Box<NDIM> box(Index<NDIM>(0), Index<NDIM>(0));
+    // Compute the closed-form inverse of the single-cell box operator on each
+    // level of the patch hierarchy.
+    //
+    // The box operator couples the 2*NDIM velocity unknowns on the faces of a
+    // cell to the pressure unknown in that cell.  The velocity block is block
+    // diagonal, with one 2x2 block for each coordinate direction that couples
+    // the lower and upper faces of the cell, and the eigenvectors of each of
+    // these blocks are (1,1) and (1,-1).  Because the discrete gradient of the
+    // cell pressure is parallel to (1,-1), the pressure Schur complement reduces
+    // to a scalar.
+    d_box_inv.resize(d_finest_ln + 1);
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
-    std::array<double, NDIM> dx;
+    const double C = d_U_problem_coefs.getCConstant();
+    const double D = d_U_problem_coefs.getDConstant();
     for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
     {
+        BoxInverse& box_inv = d_box_inv[ln];
         const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        double diag = C;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            box_inv.dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+            box_inv.D_over_dx_sq[d] = D / (box_inv.dx[d] * box_inv.dx[d]);
+            diag -= 2.0 * box_inv.D_over_dx_sq[d];
+        }
+        double schur = 0.0;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+            const double sum_eig = diag + box_inv.D_over_dx_sq[d];
+            const double diff_eig = diag - box_inv.D_over_dx_sq[d];
+            if (sum_eig == 0.0 || diff_eig == 0.0)
+            {
+                TBOX_ERROR(d_object_name << "::initializeOperatorStateSpecialized():\n"
+                                         << "  box operator is singular on level number " << ln << std::endl);
+            }
+            box_inv.sum_inv[d] = 1.0 / sum_eig;
+            box_inv.diff_inv[d] = 1.0 / diff_eig;
+            schur += 2.0 * box_inv.diff_inv[d] / (box_inv.dx[d] * box_inv.dx[d]);
+        }
+        if (schur == 0.0)
+        {
+            TBOX_ERROR(d_object_name << "::initializeOperatorStateSpecialized():\n"
+                                     << "  box operator is singular on level number " << ln << std::endl);
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        box_inv.schur_inv = 1.0 / schur;
     }
 
     // Get overlap information for setting patch boundary conditions.
@@ -731,15 +369,6 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
@@ -748,6 +377,140 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+StaggeredStokesBoxRelaxationFACOperator::smoothPatch(SideData<NDIM, double>& U_error_data,
+                                                     CellData<NDIM, double>& P_error_data,
+                                                     const SideData<NDIM, double>& U_residual_data,
+                                                     const CellData<NDIM, double>& P_residual_data,
+                                                     const Box<NDIM>& patch_box,
+                                                     const BoxInverse& box_inv) const
+{
+    // Setup pointers and strides for indexing the patch data arrays.  The error
+    // and residual data are required to have the same ghost cell widths.
+    const Box<NDIM>& ghost_box = P_error_data.getGhostBox();
+    const Index<NDIM>& ghost_lower = ghost_box.lower();
+    std::array<double*, NDIM> U;
+    std::array<const double*, NDIM> R_U;
+    std::array<std::array<int, NDIM>, NDIM> U_stride;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        U[axis] = U_error_data.getPointer(axis);
+        R_U[axis] = U_residual_data.getPointer(axis);
+        const Box<NDIM> side_ghost_box = SideGeometry<NDIM>::toSideBox(ghost_box, axis);
+        U_stride[axis][0] = 1;
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            U_stride[axis][d] = U_stride[axis][d - 1] * side_ghost_box.numberCells(d - 1);
+        }
+    }
+    double* const P = P_error_data.getPointer();
+    const double* const R_P = P_residual_data.getPointer();
+    std::array<int, NDIM> P_stride;
+    P_stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        P_stride[d] = P_stride[d - 1] * ghost_box.numberCells(d - 1);
+    }
+
+    // Perform a sweep over the cells in the patch.  With the multicolor
+    // ordering, cells of the same color do not read values that are modified by
+    // other cells of that color, so that the cells of each color may be relaxed
+    // in any order.  Otherwise, there is a single color and the cells are
+    // relaxed in lexicographic order.
+    const std::array<double, NDIM>& dx = box_inv.dx;
+    const double omega = d_smoother_damping_factor;
+    const int num_colors_per_dim = d_smoother_use_multicolor_ordering ? NUM_COLORS_PER_DIM : 1;
+    int num_colors = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_colors *= num_colors_per_dim;
+    for (int color = 0; color < num_colors; ++color)
+    {
+        std::array<int, NDIM> color_lower, color_size;
+        int num_color_cells = 1;
+        int c = color;
+        for (unsigned int d = 0; d < NDIM; ++d, c /= num_colors_per_dim)
+        {
+            const int shift = c % num_colors_per_dim;
+            const int n = patch_box.numberCells(d) - shift;
+            color_lower[d] = patch_box.lower(d) + shift;
+            color_size[d] = n > 0 ? (n + num_colors_per_dim - 1) / num_colors_per_dim : 0;
+            num_color_cells *= color_size[d];
+        }
+#ifdef _OPENMP
+#pragma omp parallel for if (d_smoother_use_multicolor_ordering)
+#endif
+        for (int k = 0; k < num_color_cells; ++k)
+        {
+            // Determine the offset of the cell relative to the start of the
+            // patch data arrays.
+            std::array<int, NDIM> i;
+            int P_idx = 0;
+            int m = k;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                i[d] = color_lower[d] + num_colors_per_dim * (m % color_size[d]) - ghost_lower(d);
+                m /= color_size[d];
+                P_idx += i[d] * P_stride[d];
+            }
+
+            // Form the right-hand side of the box problem, in which values
+            // outside of the box are treated as Dirichlet data, and eliminate
+            // the velocity unknowns to solve for the pressure.
+            //
+            // NOTE: The velocity values outside of the box are added to the
+            // right-hand side, as in the original KSP-based implementation of
+            // this smoother, rather than subtracted as the box operator would
+            // suggest.
+            std::array<int, NDIM> U_lower_idx;
+            std::array<double, NDIM> f_lower, f_upper;
+            double p = -R_P[P_idx];
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const std::array<int, NDIM>& stride = U_stride[axis];
+                const double* const u = U[axis];
+                int lower = 0;
+                for (unsigned int d = 0; d < NDIM; ++d) lower += i[d] * stride[d];
+                const int upper = lower + stride[axis];
+                double f_l = R_U[axis][lower];
+                double f_u = R_U[axis][upper];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double coef = box_inv.D_over_dx_sq[d];
+                    if (d == axis)
+                    {
+                        f_l += coef * u[lower - stride[d]];
+                        f_u += coef * u[upper + stride[d]];
+                    }
+                    else
+                    {
+                        f_l += coef * (u[lower - stride[d]] + u[lower + stride[d]]);
+                        f_u += coef * (u[upper - stride[d]] + u[upper + stride[d]]);
+                    }
+                }
+                f_l += P[P_idx - P_stride[axis]] / dx[axis];
+                f_u -= P[P_idx + P_stride[axis]] / dx[axis];
+                U_lower_idx[axis] = lower;
+                f_lower[axis] = f_l;
+                f_upper[axis] = f_u;
+                p += box_inv.diff_inv[axis] * (f_l - f_u) / dx[axis];
+            }
+            p *= box_inv.schur_inv;
+
+            // Back-substitute for the velocity unknowns and update the error.
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const double sum = 0.5 * (f_lower[axis] + f_upper[axis]) * box_inv.sum_inv[axis];
+                const double diff = (0.5 * (f_lower[axis] - f_upper[axis]) - p / dx[axis]) * box_inv.diff_inv[axis];
+                double& u_lower = U[axis][U_lower_idx[axis]];
+                double& u_upper = U[axis][U_lower_idx[axis] + U_stride[axis][axis]];
+                u_lower = (1.0 - omega) * u_lower + omega * (sum + diff);
+                u_upper = (1.0 - omega) * u_upper + omega * (sum - diff);
+            }
+            P[P_idx] = (1.0 - omega) * P[P_idx] + omega * p;
+        }
+    }
+    return;
+} // smoothPatch
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
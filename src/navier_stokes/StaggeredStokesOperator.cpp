@@ -198,9 +198,6 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
 {
     IBAMR_TIMER_START(t_apply);
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
-
     // Get the vector components.
     const int U_idx = x.getComponentDescriptorIndex(0);
     const int P_idx = x.getComponentDescriptorIndex(1);
@@ -244,37 +241,21 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
-                             U_scratch_idx,
-                             U_sc_var,
-                             d_no_fill,
-                             d_new_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+    //
+    // All three terms are evaluated in a single sweep over each patch.
+    d_hier_math_ops->stokes(A_U_idx,
+                            A_U_sc_var,
+                            A_P_idx,
+                            A_P_cc_var,
+                            d_U_problem_coefs,
+                            U_scratch_idx,
+                            U_sc_var,
+                            P_idx,
+                            P_cc_var,
+                            d_no_fill,
+                            d_new_time);
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
-
     IBAMR_TIMER_STOP(t_apply);
     return;
 } // apply
@@ -292,6 +273,9 @@ StaggeredStokesOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, do
     d_x = in.cloneVector(in.getName());
     d_b = out.cloneVector(out.getName());
 
+    // Allocate scratch data.  These data persist until deallocateOperatorState().
+    d_x->allocateVectorData();
+
     // Setup the interpolation transaction information.
     d_U_fill_pattern = new SideNoCornersFillPattern(SIDEG, false, false, true);
     d_P_fill_pattern = new CellNoCornersFillPattern(CELLG, false, false, true);
@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "CellVariable.h"
+#include "PoissonSpecifications.h"
 #include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "ibamr/VCStaggeredStokesOperator.h"
@@ -102,9 +103,6 @@ VCStaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVector
 {
     IBAMR_TIMER_START(t_apply);
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
-
     // Get the vector components.
     const int U_idx = x.getComponentDescriptorIndex(0);
     const int P_idx = x.getComponentDescriptorIndex(1);
@@ -148,16 +146,11 @@ VCStaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVector
 
     // Compute the action of the operator:
     //
-    // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    // A_U += (C*I*L(D))*U
+    // A*[U;P] := [A_U;A_P] = [(C*I+L(D))*U + Grad P; -Div U]
+    //
+    // The variable-coefficient viscous term is computed first.  The pressure
+    // gradient and the divergence are then evaluated in a single fused sweep
+    // that adds the viscous term back in.
     double alpha = 1.0;
     double beta = 1.0;
     if (d_U_problem_coefs.cIsZero() || d_U_problem_coefs.cIsConstant())
@@ -180,23 +173,26 @@ VCStaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVector
                                 d_new_time,
                                 d_D_interp_type,
                                 d_U_problem_coefs.cIsVariable() ? d_U_problem_coefs.getCPatchDataId() : -1,
-                                Pointer<SideVariable<NDIM, double> >(nullptr),
-                                1.0,
-                                A_U_idx,
-                                A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+                                Pointer<SideVariable<NDIM, double> >(nullptr));
+    PoissonSpecifications grad_div_spec(d_object_name + "::grad_div_spec");
+    grad_div_spec.setCZero();
+    grad_div_spec.setDConstant(0.0);
+    d_hier_math_ops->stokes(A_U_idx,
+                            A_U_sc_var,
+                            A_P_idx,
+                            A_P_cc_var,
+                            grad_div_spec,
+                            U_scratch_idx,
+                            U_sc_var,
+                            P_idx,
+                            P_cc_var,
+                            d_no_fill,
+                            d_new_time,
+                            1.0,
+                            A_U_idx,
+                            A_U_sc_var);
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
-
     IBAMR_TIMER_STOP(t_apply);
     return;
 } // apply
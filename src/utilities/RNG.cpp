@@ -1,6 +1,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <cmath>
+#include <cstdint>
 #include <ctime>
 #include <iosfwd>
 #include <iostream>
@@ -309,6 +310,61 @@ RNG::parallel_seed(int global_seed)
     return;
 } // parallel_seed
 
+void
+RNG::philox4x32(std::uint32_t ctr[4], const std::uint32_t key[2])
+{
+    static const std::uint32_t PHILOX_M0 = 0xD2511F53;
+    static const std::uint32_t PHILOX_M1 = 0xCD9E8D57;
+    static const std::uint32_t PHILOX_W0 = 0x9E3779B9;
+    static const std::uint32_t PHILOX_W1 = 0xBB67AE85;
+    static const int PHILOX_ROUNDS = 10;
+    std::uint32_t k0 = key[0], k1 = key[1];
+    for (int r = 0; r < PHILOX_ROUNDS; ++r)
+    {
+        const std::uint64_t p0 = static_cast<std::uint64_t>(PHILOX_M0) * ctr[0];
+        const std::uint64_t p1 = static_cast<std::uint64_t>(PHILOX_M1) * ctr[2];
+        const std::uint32_t c0 = static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ k0;
+        const std::uint32_t c1 = static_cast<std::uint32_t>(p1);
+        const std::uint32_t c2 = static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ k1;
+        const std::uint32_t c3 = static_cast<std::uint32_t>(p0);
+        ctr[0] = c0;
+        ctr[1] = c1;
+        ctr[2] = c2;
+        ctr[3] = c3;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    return;
+} // philox4x32
+
+void
+RNG::genrandn(double* const result, const int n, const std::uint32_t key[2], const std::uint32_t ctr[4])
+{
+    // Each output value is obtained from two uniformly distributed random
+    // numbers in (0,1) with 53 bits of precision via the Box-Muller transform.
+    static const double TWO_PI = 2.0 * M_PI;
+    static const double TWO_POW_M53 = 1.0 / 9007199254740992.0;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (int m = 0; m < n; ++m)
+    {
+        std::uint32_t x[4] = { ctr[0] + static_cast<std::uint32_t>(m), ctr[1], ctr[2], ctr[3] };
+        philox4x32(x, key);
+        const double u1 = ((static_cast<std::uint64_t>(x[0] >> 5) << 26 | (x[1] >> 6)) + 0.5) * TWO_POW_M53;
+        const double u2 = ((static_cast<std::uint64_t>(x[2] >> 5) << 26 | (x[3] >> 6)) + 0.5) * TWO_POW_M53;
+        result[m] = std::sqrt(-2.0 * std::log(u1)) * std::cos(TWO_PI * u2);
+    }
+    return;
+} // genrandn
+
+std::uint32_t
+RNG::getStream(const int level_num, const int rand_val_num, const int component)
+{
+    return (static_cast<std::uint32_t>(level_num) << 16) | (static_cast<std::uint32_t>(rand_val_num) << 8) |
+           static_cast<std::uint32_t>(component);
+} // getStream
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -0,0 +1,376 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/dof_map.h>
+#include <libmesh/equation_systems.h>
+#include <libmesh/fe.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+#include <libmesh/quadrature.h>
+#include <libmesh/string_to_enum.h>
+#include <libmesh/system.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LEInteractor.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test checks that the elements associated with each local patch by
+// FEDataManager::reinitElementMappings(), which exchanges element bounding
+// boxes only with the processes owning patches that the boxes may intersect,
+// are the same elements that are found when every process has the bounding
+// boxes of all of the elements in the mesh.  The reference sets are computed
+// here in the same way as FEDataManager did before the bounding box exchange
+// was introduced: each element whose bounding box intersects a patch is
+// provisionally associated with the patch, elements without a quadrature point
+// in the patch ghost box are removed, and the neighbors of the retained
+// elements are recursively tested in the same way.
+
+namespace
+{
+// Maps the reference mesh [0,1]^NDIM to a smoothly distorted block in the
+// middle of the domain, so that the element bounding boxes are not aligned with
+// the Cartesian grid.
+libMesh::Point
+deformed_position(const libMesh::Point& s)
+{
+    libMesh::Point X;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        X(d) = 0.3 + 0.4 * s(d) + 0.05 * std::sin(2.0 * M_PI * s((d + 1) % NDIM));
+    }
+    return X;
+} // deformed_position
+
+// Computes the active elements of each local patch from the bounding boxes of
+// all of the elements in the mesh.
+void
+collect_reference_patch_elements(std::vector<std::set<dof_id_type> >& ref_patch_elem_ids,
+                                 FEDataManager* const fe_data_manager)
+{
+    EquationSystems* equation_systems = fe_data_manager->getEquationSystems();
+    const MeshBase& mesh = equation_systems->get_mesh();
+    const unsigned int dim = mesh.mesh_dimension();
+    System& X_system = equation_systems->get_system(fe_data_manager->COORDINATES_SYSTEM_NAME);
+    const DofMap& X_dof_map = X_system.get_dof_map();
+    std::vector<double> X_serial;
+    X_system.solution->localize(X_serial);
+
+    // Get the nodal coordinates of an element.
+    std::vector<std::vector<dof_id_type> > X_dof_indices(NDIM);
+    auto get_X_node = [&](const Elem* const elem, std::vector<libMesh::Point>& X_node) {
+        for (unsigned int d = 0; d < NDIM; ++d) X_dof_map.dof_indices(elem, X_dof_indices[d], d);
+        X_node.resize(X_dof_indices[0].size());
+        for (unsigned int k = 0; k < X_node.size(); ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d) X_node[k](d) = X_serial[X_dof_indices[d][k]];
+        }
+    };
+
+    // Compute the bounding boxes of all of the active elements.
+    std::vector<std::pair<libMesh::Point, libMesh::Point> > elem_bboxes(mesh.max_elem_id());
+    std::vector<libMesh::Point> X_node;
+    for (auto el_it = mesh.active_elements_begin(); el_it != mesh.active_elements_end(); ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        get_X_node(elem, X_node);
+        libMesh::Point& elem_lower_bound = elem_bboxes[elem->id()].first;
+        libMesh::Point& elem_upper_bound = elem_bboxes[elem->id()].second;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            elem_lower_bound(d) = std::numeric_limits<double>::max();
+            elem_upper_bound(d) = -std::numeric_limits<double>::max();
+        }
+        for (const auto& X : X_node)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                elem_lower_bound(d) = std::min(elem_lower_bound(d), X(d));
+                elem_upper_bound(d) = std::max(elem_upper_bound(d), X(d));
+            }
+        }
+    }
+
+    // The quadrature rule used to determine whether an element has a
+    // quadrature point in a patch.
+    const FEDataManager::InterpSpec& interp_spec = fe_data_manager->getDefaultInterpSpec();
+    std::unique_ptr<QBase> qrule = QBase::build(interp_spec.quad_type, dim, interp_spec.quad_order);
+    std::unique_ptr<FEBase> X_fe = FEBase::build(dim, X_dof_map.variable_type(0));
+    X_fe->attach_quadrature_rule(qrule.get());
+    const std::vector<std::vector<double> >& phi = X_fe->get_phi();
+
+    Pointer<PatchHierarchy<NDIM> > hierarchy = fe_data_manager->getPatchHierarchy();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(fe_data_manager->getLevelNumber());
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const IntVector<NDIM>& ghost_width = fe_data_manager->getGhostCellWidth();
+    ref_patch_elem_ids.clear();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM> ghost_box = Box<NDIM>::grow(patch->getBox(), ghost_width);
+        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const dx = pgeom->getDx();
+        libMesh::Point x_lower, x_upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            x_lower(d) = pgeom->getXLower()[d] - dx[d] * ghost_width[d];
+            x_upper(d) = pgeom->getXUpper()[d] + dx[d] * ghost_width[d];
+        }
+
+        // Provisionally associate the elements whose bounding boxes intersect
+        // the patch.
+        std::set<const Elem*> frontier_elems, local_elems, nonlocal_elems;
+        for (auto el_it = mesh.active_elements_begin(); el_it != mesh.active_elements_end(); ++el_it)
+        {
+            const Elem* const elem = *el_it;
+            const libMesh::Point& elem_lower_bound = elem_bboxes[elem->id()].first;
+            const libMesh::Point& elem_upper_bound = elem_bboxes[elem->id()].second;
+            bool in_patch = true;
+            for (unsigned int d = 0; d < NDIM && in_patch; ++d)
+            {
+                in_patch = (elem_upper_bound(d) >= x_lower(d) && elem_upper_bound(d) <= x_upper(d)) ||
+                           (elem_lower_bound(d) >= x_lower(d) && elem_lower_bound(d) <= x_upper(d));
+            }
+            if (in_patch) frontier_elems.insert(elem);
+        }
+
+        // Keep only those elements that have a quadrature point in the patch,
+        // and test the neighbors of the retained elements until no new elements
+        // are found.
+        while (!frontier_elems.empty())
+        {
+            for (const Elem* const elem : frontier_elems)
+            {
+                get_X_node(elem, X_node);
+                X_fe->reinit(elem);
+                bool found_qp = false;
+                for (unsigned int qp = 0; qp < qrule->n_points() && !found_qp; ++qp)
+                {
+                    libMesh::Point X_qp;
+                    for (unsigned int k = 0; k < X_node.size(); ++k) X_qp += phi[k][qp] * X_node[k];
+                    const Index<NDIM> i = IndexUtilities::getCellIndex(X_qp, grid_geom, ratio);
+                    found_qp = ghost_box.contains(i);
+                }
+                if (found_qp)
+                {
+                    local_elems.insert(elem);
+                }
+                else
+                {
+                    nonlocal_elems.insert(elem);
+                }
+            }
+            frontier_elems.clear();
+            for (const Elem* const elem : local_elems)
+            {
+                for (unsigned int n = 0; n < elem->n_neighbors(); ++n)
+                {
+                    const Elem* const nghbr_elem = elem->neighbor(n);
+                    if (nghbr_elem && !local_elems.count(nghbr_elem) && !nonlocal_elems.count(nghbr_elem))
+                    {
+                        frontier_elems.insert(nghbr_elem);
+                    }
+                }
+            }
+        }
+
+        ref_patch_elem_ids.emplace_back();
+        for (const Elem* const elem : local_elems) ref_patch_elem_ids.back().insert(elem->id());
+    }
+    return;
+} // collect_reference_patch_elements
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, num_mismatches holds the total number of elements that are     *
+ * active on a patch in only one of the computed and the reference sets, and   *
+ * num_active_elems and num_ref_active_elems hold the total numbers of         *
+ * elements in the computed and the reference sets, summed over all patches.   *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc, char* argv[], int& num_mismatches, int& num_active_elems, int& num_ref_active_elems)
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_elems = input_db->getIntegerWithDefault("NUM_ELEMS", 8);
+        const std::string elem_type = input_db->getStringWithDefault("ELEM_TYPE", NDIM == 2 ? "QUAD9" : "HEX27");
+        const std::string fe_order = input_db->getStringWithDefault("FE_ORDER", "SECOND");
+        const std::string kernel_fcn = input_db->getStringWithDefault("KERNEL_FCN", "IB_4");
+
+        // Create a replicated mesh of the reference block and the coordinates
+        // system that stores its deformed configuration.
+        Mesh mesh(init.comm(), NDIM);
+#if (NDIM == 2)
+        MeshTools::Generation::build_square(
+            mesh, num_elems, num_elems, 0.0, 1.0, 0.0, 1.0, Utility::string_to_enum<ElemType>(elem_type));
+#endif
+#if (NDIM == 3)
+        MeshTools::Generation::build_cube(mesh,
+                                          num_elems,
+                                          num_elems,
+                                          num_elems,
+                                          0.0,
+                                          1.0,
+                                          0.0,
+                                          1.0,
+                                          0.0,
+                                          1.0,
+                                          Utility::string_to_enum<ElemType>(elem_type));
+#endif
+        EquationSystems equation_systems(mesh);
+        FEDataManager::InterpSpec interp_spec(kernel_fcn,
+                                              QGAUSS,
+                                              FIFTH,
+                                              /*use_adaptive_quadrature*/ false,
+                                              /*point_density*/ 2.0,
+                                              /*use_consistent_mass_matrix*/ true,
+                                              /*use_nodal_quadrature*/ false);
+        FEDataManager::SpreadSpec spread_spec(kernel_fcn,
+                                              QGAUSS,
+                                              FIFTH,
+                                              /*use_adaptive_quadrature*/ false,
+                                              /*point_density*/ 2.0,
+                                              /*use_nodal_quadrature*/ false);
+        const IntVector<NDIM> ghosts(LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        FEDataManager* const fe_data_manager = FEDataManager::getManager(
+            "FEDataManager", interp_spec, spread_spec, ghosts, /*register_for_restart*/ false);
+        fe_data_manager->setEquationSystems(&equation_systems, /*level_number*/ 0);
+        System& X_system = equation_systems.add_system<System>(fe_data_manager->COORDINATES_SYSTEM_NAME);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_system.add_variable("X_" + std::to_string(d), Utility::string_to_enum<Order>(fe_order), LAGRANGE);
+        }
+        equation_systems.init();
+        const unsigned int X_sys_num = X_system.number();
+        for (auto n_it = mesh.local_nodes_begin(); n_it != mesh.local_nodes_end(); ++n_it)
+        {
+            const Node* const node = *n_it;
+            const libMesh::Point X = deformed_position(*node);
+            for (unsigned int d = 0; d < NDIM; ++d) X_system.solution->set(node->dof_number(X_sys_num, d, 0), X(d));
+        }
+        X_system.solution->close();
+
+        // Create a single-level patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               fe_data_manager,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+
+        // Associate the elements with the local patches and compare the
+        // results with the reference sets.
+        fe_data_manager->reinitElementMappings();
+        const std::vector<std::vector<Elem*> >& active_patch_elem_map = fe_data_manager->getActivePatchElementMap();
+        std::vector<std::set<dof_id_type> > ref_patch_elem_ids;
+        collect_reference_patch_elements(ref_patch_elem_ids, fe_data_manager);
+        TBOX_ASSERT(active_patch_elem_map.size() == ref_patch_elem_ids.size());
+        int local_mismatches = 0, local_active_elems = 0, local_ref_active_elems = 0;
+        for (unsigned int k = 0; k < ref_patch_elem_ids.size(); ++k)
+        {
+            std::set<dof_id_type> patch_elem_ids;
+            for (const Elem* const elem : active_patch_elem_map[k]) patch_elem_ids.insert(elem->id());
+            std::vector<dof_id_type> diff;
+            std::set_symmetric_difference(patch_elem_ids.begin(),
+                                          patch_elem_ids.end(),
+                                          ref_patch_elem_ids[k].begin(),
+                                          ref_patch_elem_ids[k].end(),
+                                          std::back_inserter(diff));
+            local_mismatches += static_cast<int>(diff.size());
+            local_active_elems += static_cast<int>(active_patch_elem_map[k].size());
+            local_ref_active_elems += static_cast<int>(ref_patch_elem_ids[k].size());
+        }
+        num_mismatches = SAMRAI_MPI::sumReduction(local_mismatches);
+        num_active_elems = SAMRAI_MPI::sumReduction(local_active_elems);
+        num_ref_active_elems = SAMRAI_MPI::sumReduction(local_ref_active_elems);
+        pout << "number of patches: " << patch_hierarchy->getPatchLevel(0)->getNumberOfPatches() << "\n"
+             << "number of active patch elements: " << num_active_elems << "\n"
+             << "number of mismatched patch elements: " << num_mismatches << "\n";
+    }
+
+    SAMRAIManager::shutdown();
+    return true;
+} // run_example
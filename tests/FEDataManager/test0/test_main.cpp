@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+int num_mismatches, num_active_elems, num_ref_active_elems;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME FEDataManager_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME FEDataManager_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, active_patch_elements_found)
+{
+    EXPECT_GT(num_active_elems, 0);
+    EXPECT_EQ(num_active_elems, num_ref_active_elems);
+}
+
+// The active patch elements must not depend on whether the element bounding
+// boxes are sent only to the owners of overlapping patches or to all processes.
+TEST(TEST_CASE_NAME, active_patch_elements_match_all_gather)
+{
+    EXPECT_EQ(num_mismatches, 0);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc, ex_argv, num_mismatches, num_active_elems, num_ref_active_elems);
+    return RUN_ALL_TESTS();
+}
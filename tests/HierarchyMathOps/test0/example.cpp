@@ -0,0 +1,366 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test checks that HierarchyMathOps::stokes(), which evaluates the
+// staggered-grid Stokes operator in a single sweep over each patch, gives the
+// same results as the sequence grad(), laplace(), div() that it replaces.  The
+// operator is evaluated on a two-level locally refined grid, so that the
+// results include the synchronization of the velocity and of the momentum
+// residual along the coarse-fine interface and the values on the parts of the
+// coarse level that are covered by the fine level.  The test compares:
+//
+//   - the momentum and continuity components of the results on each level;
+//   - the velocity after the evaluation, which is synchronized in place by both
+//     approaches.
+
+namespace
+{
+// Set smooth values for the velocity and pressure, including ghost values.
+void
+fill_data(Pointer<PatchHierarchy<NDIM> > hierarchy, const int u_idx, const int p_idx)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(u_data->getGhostBox(), axis)); b; b++)
+                {
+                    const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                    double u = 1.0;
+                    for (unsigned int k = 0; k < NDIM; ++k)
+                    {
+                        const double offset = k == axis ? 0.0 : 0.5;
+                        const double x = x_lower[k] + dx[k] * (i_s(k) - patch_box.lower(k) + offset);
+                        u *= std::sin(2.0 * M_PI * (k + axis + 1) * x + 0.1);
+                    }
+                    (*u_data)(i_s) = u;
+                }
+            }
+            Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_idx);
+            for (Box<NDIM>::Iterator b(p_data->getGhostBox()); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                double p = 0.0;
+                for (unsigned int k = 0; k < NDIM; ++k)
+                {
+                    const double x = x_lower[k] + dx[k] * (i(k) - patch_box.lower(k) + 0.5);
+                    p += std::cos(2.0 * M_PI * (k + 1) * x);
+                }
+                (*p_data)(i) = p;
+            }
+        }
+    }
+    return;
+} // fill_data
+
+// Return the largest difference between the interior values of two
+// side-centered quantities on a level, relative to the largest magnitude of the
+// reference values.
+double
+side_rel_diff(Pointer<PatchLevel<NDIM> > level, const int idx, const int ref_idx)
+{
+    double max_diff = 0.0, max_abs = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(idx);
+        Pointer<SideData<NDIM, double> > ref_data = patch->getPatchData(ref_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch->getBox(), axis)); b; b++)
+            {
+                const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                max_diff = std::max(max_diff, std::abs((*data)(i_s) - (*ref_data)(i_s)));
+                max_abs = std::max(max_abs, std::abs((*ref_data)(i_s)));
+            }
+        }
+    }
+    max_diff = SAMRAI_MPI::maxReduction(max_diff);
+    max_abs = SAMRAI_MPI::maxReduction(max_abs);
+    return max_diff / std::max(max_abs, 1.0);
+} // side_rel_diff
+
+// Return the largest difference between the interior values of two
+// cell-centered quantities on a level, relative to the largest magnitude of the
+// reference values.
+double
+cell_rel_diff(Pointer<PatchLevel<NDIM> > level, const int idx, const int ref_idx)
+{
+    double max_diff = 0.0, max_abs = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(idx);
+        Pointer<CellData<NDIM, double> > ref_data = patch->getPatchData(ref_idx);
+        for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            max_diff = std::max(max_diff, std::abs((*data)(i) - (*ref_data)(i)));
+            max_abs = std::max(max_abs, std::abs((*ref_data)(i)));
+        }
+    }
+    max_diff = SAMRAI_MPI::maxReduction(max_diff);
+    max_abs = SAMRAI_MPI::maxReduction(max_abs);
+    return max_diff / std::max(max_abs, 1.0);
+} // cell_rel_diff
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * The operator is evaluated with a nonzero damping factor C and then with     *
+ * C = 0.  Upon return, entry NUM_LEVELS*c + ln of each of mom_rel_diff,       *
+ * div_rel_diff, and u_rel_diff holds the largest difference between the       *
+ * results of stokes() and of the sequence grad(), laplace(), div() on level   *
+ * ln for case c, relative to the largest magnitude of the results: for the    *
+ * momentum component, the continuity component, and the synchronized         *
+ * velocity, respectively.  Entry c of u_synch_change holds the largest change *
+ * of the coarse-level velocity made by the synchronization in stokes().       *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            int& num_levels,
+            std::vector<double>& mom_rel_diff,
+            std::vector<double>& div_rel_diff,
+            std::vector<double>& u_rel_diff,
+            std::vector<double>& u_synch_change)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "HierarchyMathOps.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double mu = input_db->getDouble("MU");
+        const double rho = input_db->getDouble("RHO");
+        const double dt = input_db->getDouble("DT");
+
+        // Create a locally refined patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        num_levels = finest_ln + 1;
+
+        // Create the data used by both approaches.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        Pointer<SideVariable<NDIM, double> > a_u_var = new SideVariable<NDIM, double>("a_u");
+        Pointer<CellVariable<NDIM, double> > a_p_var = new CellVariable<NDIM, double>("a_p");
+        std::vector<int> u_idxs(3), p_idxs(3), a_u_idxs(3), a_p_idxs(3);
+        for (int k = 0; k < 3; ++k)
+        {
+            Pointer<VariableContext> ctx = var_db->getContext("context_" + std::to_string(k));
+            u_idxs[k] = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+            p_idxs[k] = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+            a_u_idxs[k] = var_db->registerVariableAndContext(a_u_var, ctx, IntVector<NDIM>(0));
+            a_p_idxs[k] = var_db->registerVariableAndContext(a_p_var, ctx, IntVector<NDIM>(0));
+        }
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (int k = 0; k < 3; ++k)
+            {
+                level->allocatePatchData(u_idxs[k], 0.0);
+                level->allocatePatchData(p_idxs[k], 0.0);
+                level->allocatePatchData(a_u_idxs[k], 0.0);
+                level->allocatePatchData(a_p_idxs[k], 0.0);
+            }
+        }
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        Pointer<HierarchyGhostCellInterpolation> no_fill;
+
+        // Evaluate the operator with each approach.  Index 0 holds the initial
+        // data, index 1 the results of the sequence grad(), laplace(), div(),
+        // and index 2 the results of stokes().
+        std::vector<PoissonSpecifications> U_problem_coefs(2, PoissonSpecifications("U_problem_coefs"));
+        U_problem_coefs[0].setCConstant(rho / dt);
+        U_problem_coefs[0].setDConstant(-mu);
+        U_problem_coefs[1].setCZero();
+        U_problem_coefs[1].setDConstant(-mu);
+        const int num_cases = static_cast<int>(U_problem_coefs.size());
+        mom_rel_diff.resize(num_cases * num_levels);
+        div_rel_diff.resize(num_cases * num_levels);
+        u_rel_diff.resize(num_cases * num_levels);
+        u_synch_change.resize(num_cases);
+        fill_data(patch_hierarchy, u_idxs[0], p_idxs[0]);
+        for (int c = 0; c < num_cases; ++c)
+        {
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idxs[0]);
+                    Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_idxs[0]);
+                    for (int k = 1; k < 3; ++k)
+                    {
+                        Pointer<SideData<NDIM, double> > u_copy_data = patch->getPatchData(u_idxs[k]);
+                        Pointer<CellData<NDIM, double> > p_copy_data = patch->getPatchData(p_idxs[k]);
+                        u_copy_data->copy(*u_data);
+                        p_copy_data->copy(*p_data);
+                    }
+                }
+            }
+
+            hier_math_ops.grad(a_u_idxs[1],
+                               a_u_var,
+                               /*cf_bdry_synch*/ false,
+                               1.0,
+                               p_idxs[1],
+                               p_var,
+                               no_fill,
+                               0.0);
+            hier_math_ops.laplace(a_u_idxs[1],
+                                  a_u_var,
+                                  U_problem_coefs[c],
+                                  u_idxs[1],
+                                  u_var,
+                                  no_fill,
+                                  0.0,
+                                  1.0,
+                                  a_u_idxs[1],
+                                  a_u_var);
+            hier_math_ops.div(a_p_idxs[1],
+                              a_p_var,
+                              -1.0,
+                              u_idxs[1],
+                              u_var,
+                              no_fill,
+                              0.0,
+                              /*cf_bdry_synch*/ true);
+
+            hier_math_ops.stokes(a_u_idxs[2],
+                                 a_u_var,
+                                 a_p_idxs[2],
+                                 a_p_var,
+                                 U_problem_coefs[c],
+                                 u_idxs[2],
+                                 u_var,
+                                 p_idxs[2],
+                                 p_var,
+                                 no_fill,
+                                 0.0);
+
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                const int k = num_levels * c + ln;
+                mom_rel_diff[k] = side_rel_diff(level, a_u_idxs[2], a_u_idxs[1]);
+                div_rel_diff[k] = cell_rel_diff(level, a_p_idxs[2], a_p_idxs[1]);
+                u_rel_diff[k] = side_rel_diff(level, u_idxs[2], u_idxs[1]);
+                pout << "case " << c << ", level " << ln << ": momentum difference = " << mom_rel_diff[k]
+                     << ", continuity difference = " << div_rel_diff[k] << ", velocity difference = " << u_rel_diff[k]
+                     << "\n";
+            }
+            u_synch_change[c] = side_rel_diff(patch_hierarchy->getPatchLevel(0), u_idxs[2], u_idxs[0]);
+        }
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+int num_levels;
+std::vector<double> mom_rel_diff, div_rel_diff, u_rel_diff, u_synch_change;
+
+// The fused and unfused evaluations perform the same floating point operations
+// in a different order, so that the results agree only up to round-off.
+static const double MAX_REL_DIFF = 1.0e-12;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME HierarchyMathOps_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME HierarchyMathOps_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, hierarchy_has_two_levels)
+{
+    EXPECT_EQ(num_levels, 2);
+}
+
+// The velocity on the coarse level is changed by the synchronization along the
+// coarse-fine interface, so that the comparisons below cover it.
+TEST(TEST_CASE_NAME, coarse_fine_synchronization_changes_velocity)
+{
+    for (unsigned int c = 0; c < u_synch_change.size(); ++c)
+    {
+        SCOPED_TRACE("case " + std::to_string(c));
+        EXPECT_GT(u_synch_change[c], 1.0e-6);
+    }
+}
+
+TEST(TEST_CASE_NAME, stokes_matches_grad_laplace_div)
+{
+    ASSERT_EQ(mom_rel_diff.size(), 2u * num_levels);
+    for (unsigned int k = 0; k < mom_rel_diff.size(); ++k)
+    {
+        SCOPED_TRACE("case " + std::to_string(k / num_levels) + ", level " + std::to_string(k % num_levels));
+        EXPECT_LE(mom_rel_diff[k], MAX_REL_DIFF);
+        EXPECT_LE(div_rel_diff[k], MAX_REL_DIFF);
+        EXPECT_LE(u_rel_diff[k], MAX_REL_DIFF);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc, ex_argv, num_levels, mom_rel_diff, div_rel_diff, u_rel_diff, u_synch_change);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,542 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LInitStrategy.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+#include <ibtk/LNodeSetData.h>
+#include <ibtk/ibtk_enums.h>
+#include <ibtk/ibtk_utilities.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test redistributes a cloud of Lagrangian nodes with each of the local
+// node orderings supported by LDataManager (PATCH, MORTON, and HILBERT) and
+// checks that:
+//
+//   - the permutation returned by LDataManager::getLocalNodePermutation() is a
+//     permutation of the local nodes (and is the identity for PATCH ordering);
+//   - the local position data agree with the positions of the nodes;
+//   - interpolation and spreading yield the same results for every ordering;
+//   - interpolation reproduces a linear function and spreading conserves the
+//     spread values.
+//
+// The nodes are placed away from the physical boundary so that the kernel
+// stencils do not cross it.  The distance between consecutive local nodes and
+// the time required for interpolation and spreading with each ordering are
+// written to pout.
+
+namespace
+{
+static const int NUM_ORDERINGS = 3;
+static const LNodeOrderingType ORDERINGS[NUM_ORDERINGS] = { PATCH_LNODE_ORDERING,
+                                                            MORTON_LNODE_ORDERING,
+                                                            HILBERT_LNODE_ORDERING };
+
+// A linear congruential generator, used so that the node positions do not
+// depend on the standard library implementation.
+class NodeGenerator
+{
+public:
+    explicit NodeGenerator(const unsigned long long seed) : d_state(seed)
+    {
+    }
+
+    double next()
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(d_state >> 11) / 9007199254740992.0;
+    }
+
+private:
+    unsigned long long d_state;
+};
+
+// Initializes a cloud of randomly placed nodes on the coarsest level of the
+// patch hierarchy.  The nodes are placed in the middle 80% of the domain in each
+// direction.  The Lagrangian indices of the nodes are unrelated to their
+// positions.
+class PointCloudInitializer : public LInitStrategy
+{
+public:
+    PointCloudInitializer(const int num_nodes, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
+        : d_grid_geom(grid_geom), d_X(num_nodes)
+    {
+        const double* const x_lower = grid_geom->getXLower();
+        const double* const x_upper = grid_geom->getXUpper();
+        NodeGenerator generator(1);
+        for (auto& X : d_X)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X[d] = x_lower[d] + (0.1 + 0.8 * generator.next()) * (x_upper[d] - x_lower[d]);
+            }
+        }
+        return;
+    }
+
+    const Point& getNodePosn(const int lag_idx) const
+    {
+        return d_X[lag_idx];
+    }
+
+    bool getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const override
+    {
+        return level_number == 0;
+    }
+
+    unsigned int computeGlobalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                    const int /*level_number*/,
+                                                    const double /*init_data_time*/,
+                                                    const bool /*can_be_refined*/,
+                                                    const bool /*initial_time*/) override
+    {
+        return static_cast<unsigned int>(d_X.size());
+    }
+
+    unsigned int computeLocalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number,
+                                                   const double /*init_data_time*/,
+                                                   const bool /*can_be_refined*/,
+                                                   const bool /*initial_time*/) override
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        unsigned int local_node_count = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            local_node_count += getPatchNodes(level, level->getPatch(p())->getBox()).size();
+        }
+        return local_node_count;
+    }
+
+    unsigned int initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                            const unsigned int global_index_offset,
+                                            const unsigned int local_index_offset,
+                                            Pointer<LData> X_data,
+                                            Pointer<LData> U_data,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int level_number,
+                                            const double /*init_data_time*/,
+                                            const bool /*can_be_refined*/,
+                                            const bool /*initial_time*/,
+                                            LDataManager* const /*l_data_manager*/) override
+    {
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        int local_idx = -1;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
+            for (const int lag_idx : getPatchNodes(level, patch->getBox()))
+            {
+                const int local_petsc_idx = ++local_idx + local_index_offset;
+                const int global_petsc_idx = local_petsc_idx + global_index_offset;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_array[local_petsc_idx][d] = d_X[lag_idx][d];
+                    U_array[local_petsc_idx][d] = 0.0;
+                }
+                const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(d_X[lag_idx], d_grid_geom, level->getRatio());
+                if (!index_data->isElement(idx))
+                {
+                    index_data->appendItemPointer(idx, new LNodeSet());
+                }
+                index_data->getItem(idx)->push_back(new LNode(lag_idx, global_petsc_idx, local_petsc_idx));
+            }
+        }
+        X_data->restoreArrays();
+        U_data->restoreArrays();
+        return local_idx + 1;
+    }
+
+private:
+    std::vector<int> getPatchNodes(Pointer<PatchLevel<NDIM> > level, const Box<NDIM>& patch_box) const
+    {
+        std::vector<int> patch_nodes;
+        for (int lag_idx = 0; lag_idx < static_cast<int>(d_X.size()); ++lag_idx)
+        {
+            const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(d_X[lag_idx], d_grid_geom, level->getRatio());
+            if (patch_box.contains(idx)) patch_nodes.push_back(lag_idx);
+        }
+        return patch_nodes;
+    }
+
+    Pointer<CartesianGridGeometry<NDIM> > d_grid_geom;
+    std::vector<Point> d_X;
+};
+
+// Forwards the gridding algorithm callbacks to the LDataManager, in the same
+// way as IBMethod.
+class LDataManagerTagStrategy : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    explicit LDataManagerTagStrategy(LDataManager* const l_data_manager) : d_l_data_manager(l_data_manager)
+    {
+    }
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             const int level_number,
+                             const double init_data_time,
+                             const bool can_be_refined,
+                             const bool initial_time,
+                             Pointer<BasePatchLevel<NDIM> > old_level,
+                             const bool allocate_data) override
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->initializeLevelData(
+            hierarchy, level_number, init_data_time, can_be_refined, initial_time, old_level, allocate_data);
+        return;
+    }
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                                     const int coarsest_level,
+                                     const int finest_level) override
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+        return;
+    }
+
+private:
+    LDataManager* const d_l_data_manager;
+};
+
+// A linear function used to initialize the Eulerian data, which is reproduced
+// exactly by interpolation.
+double
+eulerian_fcn(const double* const x, const int d)
+{
+    double val = 1.0 + d;
+    for (unsigned int k = 0; k < NDIM; ++k) val += (k + d + 1) * x[k];
+    return val;
+} // eulerian_fcn
+
+void
+fill_eulerian_data(Pointer<PatchLevel<NDIM> > level, const int u_idx)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const x_lower = pgeom->getXLower();
+        const double* const dx = pgeom->getDx();
+        const Index<NDIM>& ilower = patch->getBox().lower();
+        Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+        for (Box<NDIM>::Iterator b(u_data->getGhostBox()); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            double x[NDIM];
+            for (unsigned int k = 0; k < NDIM; ++k) x[k] = x_lower[k] + dx[k] * (i(k) - ilower(k) + 0.5);
+            for (int d = 0; d < u_data->getDepth(); ++d) (*u_data)(i, d) = eulerian_fcn(x, d);
+        }
+    }
+    return;
+} // fill_eulerian_data
+
+// Accumulates the largest difference between the results obtained using a
+// particular ordering and those obtained using PATCH ordering.
+struct Comparison
+{
+    double max_diff = 0.0, max_abs = 0.0;
+
+    void update(const double val, const double ref_val)
+    {
+        max_diff = std::max(max_diff, std::abs(val - ref_val));
+        max_abs = std::max(max_abs, std::abs(ref_val));
+        return;
+    }
+
+    double relativeDifference() const
+    {
+        const double max_diff_all = SAMRAI_MPI::maxReduction(max_diff);
+        const double max_abs_all = SAMRAI_MPI::maxReduction(max_abs);
+        return max_diff_all / std::max(max_abs_all, 1.0);
+    }
+};
+
+// Return the number of processes on which the check failed.
+int
+num_failures(const bool passed)
+{
+    return SAMRAI_MPI::sumReduction(passed ? 0 : 1);
+} // num_failures
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, entry k of each output vector holds the results for the kth   *
+ * node ordering (PATCH, MORTON, and HILBERT): the number of processes on      *
+ * which the local node permutation or the local node positions are wrong,    *
+ * the largest differences from the PATCH ordering results for interpolation  *
+ * and spreading relative to the largest magnitude of the results, the sum of  *
+ * the interpolated values, and the integral of the spread values.            *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            std::vector<int>& permutation_failures,
+            std::vector<int>& position_failures,
+            std::vector<double>& interp_rel_diff,
+            std::vector<double>& spread_rel_diff,
+            std::vector<double>& interp_sum,
+            std::vector<double>& spread_integral)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    permutation_failures.resize(NUM_ORDERINGS);
+    position_failures.resize(NUM_ORDERINGS);
+    interp_rel_diff.resize(NUM_ORDERINGS);
+    spread_rel_diff.resize(NUM_ORDERINGS);
+    interp_sum.resize(NUM_ORDERINGS);
+    spread_integral.resize(NUM_ORDERINGS);
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_nodes = input_db->getIntegerWithDefault("NUM_NODES", 1000);
+        const int num_reps = input_db->getIntegerWithDefault("NUM_REPETITIONS", 1);
+        const std::string kernel_fcn = input_db->getStringWithDefault("KERNEL_FCN", "IB_4");
+
+        // Create the Lagrangian data manager and a single-level patch
+        // hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        const IntVector<NDIM> ghosts(LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        LDataManager* const l_data_manager = LDataManager::getManager(
+            "LDataManager", kernel_fcn, kernel_fcn, /*error_if_points_leave_domain*/ true, ghosts, false);
+        Pointer<PointCloudInitializer> l_initializer = new PointCloudInitializer(num_nodes, grid_geometry);
+        l_data_manager->registerLInitStrategy(l_initializer);
+        LDataManagerTagStrategy tag_strategy(l_data_manager);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               &tag_strategy,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+
+        // Create the Eulerian data.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u", NDIM);
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f", NDIM);
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, ghosts);
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, ghosts);
+        const int f_ref_idx = var_db->registerClonedPatchDataIndex(f_var, f_idx);
+        level->allocatePatchData(u_idx);
+        level->allocatePatchData(f_idx);
+        level->allocatePatchData(f_ref_idx);
+        fill_eulerian_data(level, u_idx);
+
+        std::map<int, std::array<double, NDIM> > U_ref;
+        for (int n = 0; n < NUM_ORDERINGS; ++n)
+        {
+            const LNodeOrderingType ordering = ORDERINGS[n];
+            // Redistribute the nodes using the specified ordering.
+            l_data_manager->setNodeOrdering(ordering);
+            l_data_manager->beginDataRedistribution();
+            l_data_manager->endDataRedistribution();
+            const int num_local_nodes = static_cast<int>(l_data_manager->getNumberOfLocalNodes(0));
+            Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+            Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, 0);
+            Pointer<LData> F_data = l_data_manager->createLData("F", 0, NDIM);
+            const std::vector<LNode*>& local_nodes = l_data_manager->getLMesh(0)->getLocalNodes();
+
+            // Check the permutation.
+            std::vector<int> permutation = l_data_manager->getLocalNodePermutation(0);
+            std::vector<int> identity(num_local_nodes);
+            std::iota(identity.begin(), identity.end(), 0);
+            bool permutation_ok = static_cast<int>(permutation.size()) == num_local_nodes;
+            if (ordering == PATCH_LNODE_ORDERING) permutation_ok = permutation_ok && permutation == identity;
+            std::sort(permutation.begin(), permutation.end());
+            permutation_ok = permutation_ok && permutation == identity;
+
+            // Check the node positions, set the Lagrangian values to spread,
+            // and measure the distance between consecutive local nodes.
+            bool positions_ok = static_cast<int>(local_nodes.size()) == num_local_nodes;
+            boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+            boost::multi_array_ref<double, 2>& F_array = *F_data->getLocalFormVecArray();
+            for (const auto& node : local_nodes)
+            {
+                const int lag_idx = node->getLagrangianIndex();
+                const int local_idx = node->getLocalPETScIndex();
+                const Point& X = l_initializer->getNodePosn(lag_idx);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    positions_ok = positions_ok && X_array[local_idx][d] == X[d];
+                    F_array[local_idx][d] = std::sin(0.1 * lag_idx + d);
+                }
+            }
+            const double* const dx0 = grid_geometry->getDx();
+            double node_distance = 0.0;
+            for (int k = 1; k < num_local_nodes; ++k)
+            {
+                double r_sq = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    r_sq += std::pow((X_array[k][d] - X_array[k - 1][d]) / dx0[d], 2);
+                }
+                node_distance += std::sqrt(r_sq);
+            }
+            X_data->restoreArrays();
+            F_data->restoreArrays();
+
+            // Interpolate and spread, and compare the results with those
+            // obtained using PATCH ordering.
+            const double start_time = MPI_Wtime();
+            for (int k = 0; k < num_reps; ++k)
+            {
+                l_data_manager->interp(u_idx, U_data, X_data, 0);
+            }
+            const double interp_time = MPI_Wtime() - start_time;
+            for (int k = 0; k < num_reps; ++k)
+            {
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<CellData<NDIM, double> > f_data = level->getPatch(p())->getPatchData(f_idx);
+                    f_data->fillAll(0.0);
+                }
+                l_data_manager->spread(f_idx, F_data, X_data, kernel_fcn, NULL, 0);
+            }
+            const double spread_time = MPI_Wtime() - start_time - interp_time;
+
+            Comparison interp_comparison, spread_comparison;
+            double local_interp_sum = 0.0, local_spread_integral = 0.0;
+            const boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+            for (const auto& node : local_nodes)
+            {
+                const int lag_idx = node->getLagrangianIndex();
+                const int local_idx = node->getLocalPETScIndex();
+                if (ordering == PATCH_LNODE_ORDERING)
+                {
+                    std::copy(&U_array[local_idx][0], &U_array[local_idx][0] + NDIM, U_ref[lag_idx].begin());
+                }
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    interp_comparison.update(U_array[local_idx][d], U_ref[lag_idx][d]);
+                    local_interp_sum += U_array[local_idx][d];
+                }
+            }
+            U_data->restoreArrays();
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+                Pointer<CellData<NDIM, double> > f_ref_data = patch->getPatchData(f_ref_idx);
+                if (ordering == PATCH_LNODE_ORDERING) f_ref_data->copy(*f_data);
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+                double cell_volume = 1.0;
+                for (unsigned int d = 0; d < NDIM; ++d) cell_volume *= dx[d];
+                for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+                {
+                    const CellIndex<NDIM> i(b());
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        spread_comparison.update((*f_data)(i, d), (*f_ref_data)(i, d));
+                        local_spread_integral += (*f_data)(i, d) * cell_volume;
+                    }
+                }
+            }
+
+            const std::string ordering_name = enum_to_string<LNodeOrderingType>(ordering);
+            pout << ordering_name << "\n"
+                 << "  mean distance between consecutive local nodes: "
+                 << node_distance / std::max(num_local_nodes - 1, 1) << " cells\n"
+                 << "  interpolation time: " << SAMRAI_MPI::maxReduction(interp_time) << " s\n"
+                 << "  spreading time: " << SAMRAI_MPI::maxReduction(spread_time) << " s\n";
+            permutation_failures[n] = num_failures(permutation_ok);
+            position_failures[n] = num_failures(positions_ok);
+            interp_rel_diff[n] = interp_comparison.relativeDifference();
+            spread_rel_diff[n] = spread_comparison.relativeDifference();
+            interp_sum[n] = SAMRAI_MPI::sumReduction(local_interp_sum);
+            spread_integral[n] = SAMRAI_MPI::sumReduction(local_spread_integral);
+        }
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
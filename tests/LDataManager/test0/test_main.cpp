@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+static const double REL_ERROR = 1.0e-10;
+static const double MAX_ORDERING_DIFF = 1.0e-12;
+std::vector<int> permutation_failures, position_failures;
+std::vector<double> interp_rel_diff, spread_rel_diff, interp_sum, spread_integral;
+double bench_interp_sum, bench_spread_integral;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME LDataManager_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME LDataManager_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, local_node_permutation)
+{
+    for (int n = 0; n < NUM_ORDERINGS; ++n)
+    {
+        SCOPED_TRACE(enum_to_string<LNodeOrderingType>(ORDERINGS[n]));
+        EXPECT_EQ(permutation_failures[n], 0);
+        EXPECT_EQ(position_failures[n], 0);
+    }
+}
+
+// Interpolation and spreading do not depend on the node ordering.
+TEST(TEST_CASE_NAME, results_independent_of_ordering)
+{
+    for (int n = 0; n < NUM_ORDERINGS; ++n)
+    {
+        SCOPED_TRACE(enum_to_string<LNodeOrderingType>(ORDERINGS[n]));
+        EXPECT_LE(interp_rel_diff[n], MAX_ORDERING_DIFF);
+        EXPECT_LE(spread_rel_diff[n], MAX_ORDERING_DIFF);
+    }
+}
+
+TEST(TEST_CASE_NAME, interpolation_sum)
+{
+    for (int n = 0; n < NUM_ORDERINGS; ++n)
+    {
+        SCOPED_TRACE(enum_to_string<LNodeOrderingType>(ORDERINGS[n]));
+        EXPECT_LE(std::abs(interp_sum[n] - bench_interp_sum), std::abs(bench_interp_sum) * REL_ERROR);
+    }
+}
+
+TEST(TEST_CASE_NAME, spreading_integral)
+{
+    for (int n = 0; n < NUM_ORDERINGS; ++n)
+    {
+        SCOPED_TRACE(enum_to_string<LNodeOrderingType>(ORDERINGS[n]));
+        EXPECT_LE(std::abs(spread_integral[n] - bench_spread_integral), std::abs(bench_spread_integral) * REL_ERROR);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    // The sum of the linear Eulerian function over the node positions generated
+    // by NodeGenerator(1), and the sum of the Lagrangian values, for
+    // input[23]d.test.
+    if (NDIM == 2)
+    {
+        bench_interp_sum = 2.810051484317567e+04;
+        bench_spread_integral = 1.761740411016110e+01;
+    }
+    else if (NDIM == 3)
+    {
+        bench_interp_sum = 1.557599326087116e+05;
+        bench_spread_integral = 3.266911714960315e+01;
+    }
+
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc,
+                          ex_argv,
+                          permutation_failures,
+                          position_failures,
+                          interp_rel_diff,
+                          spread_rel_diff,
+                          interp_sum,
+                          spread_integral);
+    return RUN_ALL_TESTS();
+}
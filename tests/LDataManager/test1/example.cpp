@@ -0,0 +1,597 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LEStencilCache.h>
+#include <ibtk/LInitStrategy.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+#include <ibtk/LNodeSetData.h>
+#include <ibtk/ibtk_enums.h>
+#include <ibtk/ibtk_utilities.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test checks that the delta function stencils cached by LIndexSetData
+// (see LEInteractor::s_use_stencil_cache) are reused in a typical IB cycle.
+// At each step, the velocity is interpolated to the nodes, a force is spread
+// from the nodes, and the nodes are moved with the interpolated velocity.  The
+// steps are performed first without and then with the stencil cache, and the
+// test checks that:
+//
+//   - no stencils are computed or reused when the cache is disabled;
+//   - spreading reuses the stencils computed for interpolation at the same
+//     positions, and moving the nodes invalidates the cached stencils;
+//   - the cached and uncached results agree up to round-off;
+//   - interpolation reproduces a linear function and spreading conserves the
+//     spread values.
+
+namespace
+{
+// A linear congruential generator, used so that the node positions do not
+// depend on the standard library implementation.
+class NodeGenerator
+{
+public:
+    explicit NodeGenerator(const unsigned long long seed) : d_state(seed)
+    {
+    }
+
+    double next()
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(d_state >> 11) / 9007199254740992.0;
+    }
+
+private:
+    unsigned long long d_state;
+};
+
+// Initializes a cloud of randomly placed nodes on the coarsest level of the
+// patch hierarchy.  The nodes are placed in the middle 80% of the domain in each
+// direction.  The Lagrangian indices of the nodes are unrelated to their
+// positions.
+class PointCloudInitializer : public LInitStrategy
+{
+public:
+    PointCloudInitializer(const int num_nodes, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
+        : d_grid_geom(grid_geom), d_X(num_nodes)
+    {
+        const double* const x_lower = grid_geom->getXLower();
+        const double* const x_upper = grid_geom->getXUpper();
+        NodeGenerator generator(1);
+        for (auto& X : d_X)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X[d] = x_lower[d] + (0.1 + 0.8 * generator.next()) * (x_upper[d] - x_lower[d]);
+            }
+        }
+        return;
+    }
+
+    const Point& getNodePosn(const int lag_idx) const
+    {
+        return d_X[lag_idx];
+    }
+
+    bool getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const override
+    {
+        return level_number == 0;
+    }
+
+    unsigned int computeGlobalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                    const int /*level_number*/,
+                                                    const double /*init_data_time*/,
+                                                    const bool /*can_be_refined*/,
+                                                    const bool /*initial_time*/) override
+    {
+        return static_cast<unsigned int>(d_X.size());
+    }
+
+    unsigned int computeLocalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number,
+                                                   const double /*init_data_time*/,
+                                                   const bool /*can_be_refined*/,
+                                                   const bool /*initial_time*/) override
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        unsigned int local_node_count = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            local_node_count += getPatchNodes(level, level->getPatch(p())->getBox()).size();
+        }
+        return local_node_count;
+    }
+
+    unsigned int initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                            const unsigned int global_index_offset,
+                                            const unsigned int local_index_offset,
+                                            Pointer<LData> X_data,
+                                            Pointer<LData> U_data,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int level_number,
+                                            const double /*init_data_time*/,
+                                            const bool /*can_be_refined*/,
+                                            const bool /*initial_time*/,
+                                            LDataManager* const /*l_data_manager*/) override
+    {
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        int local_idx = -1;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
+            for (const int lag_idx : getPatchNodes(level, patch->getBox()))
+            {
+                const int local_petsc_idx = ++local_idx + local_index_offset;
+                const int global_petsc_idx = local_petsc_idx + global_index_offset;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_array[local_petsc_idx][d] = d_X[lag_idx][d];
+                    U_array[local_petsc_idx][d] = 0.0;
+                }
+                const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(d_X[lag_idx], d_grid_geom, level->getRatio());
+                if (!index_data->isElement(idx))
+                {
+                    index_data->appendItemPointer(idx, new LNodeSet());
+                }
+                index_data->getItem(idx)->push_back(new LNode(lag_idx, global_petsc_idx, local_petsc_idx));
+            }
+        }
+        X_data->restoreArrays();
+        U_data->restoreArrays();
+        return local_idx + 1;
+    }
+
+private:
+    std::vector<int> getPatchNodes(Pointer<PatchLevel<NDIM> > level, const Box<NDIM>& patch_box) const
+    {
+        std::vector<int> patch_nodes;
+        for (int lag_idx = 0; lag_idx < static_cast<int>(d_X.size()); ++lag_idx)
+        {
+            const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(d_X[lag_idx], d_grid_geom, level->getRatio());
+            if (patch_box.contains(idx)) patch_nodes.push_back(lag_idx);
+        }
+        return patch_nodes;
+    }
+
+    Pointer<CartesianGridGeometry<NDIM> > d_grid_geom;
+    std::vector<Point> d_X;
+};
+
+// Forwards the gridding algorithm callbacks to the LDataManager, in the same
+// way as IBMethod.
+class LDataManagerTagStrategy : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    explicit LDataManagerTagStrategy(LDataManager* const l_data_manager) : d_l_data_manager(l_data_manager)
+    {
+    }
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             const int level_number,
+                             const double init_data_time,
+                             const bool can_be_refined,
+                             const bool initial_time,
+                             Pointer<BasePatchLevel<NDIM> > old_level,
+                             const bool allocate_data) override
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->initializeLevelData(
+            hierarchy, level_number, init_data_time, can_be_refined, initial_time, old_level, allocate_data);
+        return;
+    }
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                                     const int coarsest_level,
+                                     const int finest_level) override
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+        return;
+    }
+
+private:
+    LDataManager* const d_l_data_manager;
+};
+
+// A linear function used to initialize the Eulerian data, which is reproduced
+// exactly by interpolation.
+double
+eulerian_fcn(const double* const x, const int d)
+{
+    double val = 1.0 + d;
+    for (unsigned int k = 0; k < NDIM; ++k) val += (k + d + 1) * x[k];
+    return val;
+} // eulerian_fcn
+
+void
+fill_eulerian_data(Pointer<PatchLevel<NDIM> > level, const int u_idx)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const x_lower = pgeom->getXLower();
+        const double* const dx = pgeom->getDx();
+        const Index<NDIM>& ilower = patch->getBox().lower();
+        Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+        for (Box<NDIM>::Iterator b(u_data->getGhostBox()); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            double x[NDIM];
+            for (unsigned int k = 0; k < NDIM; ++k) x[k] = x_lower[k] + dx[k] * (i(k) - ilower(k) + 0.5);
+            for (int d = 0; d < u_data->getDepth(); ++d) (*u_data)(i, d) = eulerian_fcn(x, d);
+        }
+    }
+    return;
+} // fill_eulerian_data
+
+// Accumulates the largest difference between the results obtained with and
+// without the stencil cache.
+struct Comparison
+{
+    double max_diff = 0.0, max_abs = 0.0;
+
+    void update(const double val, const double ref_val)
+    {
+        max_diff = std::max(max_diff, std::abs(val - ref_val));
+        max_abs = std::max(max_abs, std::abs(ref_val));
+        return;
+    }
+
+    double relativeDifference() const
+    {
+        const double max_diff_all = SAMRAI_MPI::maxReduction(max_diff);
+        const double max_abs_all = SAMRAI_MPI::maxReduction(max_abs);
+        return max_diff_all / std::max(max_abs_all, 1.0);
+    }
+};
+
+
+// Return the total numbers of times that cached stencils have been reused and
+// (re)computed on the level.
+void
+get_cache_counts(int& num_hits, int& num_misses, Pointer<PatchLevel<NDIM> > level, const int lag_node_index_idx)
+{
+    num_hits = 0;
+    num_misses = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<LNodeSetData> idx_data = level->getPatch(p())->getPatchData(lag_node_index_idx);
+        const LEStencilCache& stencil_cache = idx_data->getStencilCache();
+        num_hits += stencil_cache.getNumberOfHits();
+        num_misses += stencil_cache.getNumberOfMisses();
+    }
+    num_hits = SAMRAI_MPI::sumReduction(num_hits);
+    num_misses = SAMRAI_MPI::sumReduction(num_misses);
+    return;
+} // get_cache_counts
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * The nodes are moved after each of the first NUM_STEPS cycles, and the last  *
+ * cycle repeats the one before it at the same positions.  Upon return,        *
+ * uncached_accesses holds the number of cache lookups made while the cache    *
+ * was disabled, and entry c of each output vector holds the results for      *
+ * cycle c with the cache enabled: the numbers of times that cached stencils   *
+ * were reused and (re)computed, the largest differences from the uncached     *
+ * results for interpolation and spreading relative to the largest magnitude   *
+ * of the results, the sum of the interpolated values, and the integral of the *
+ * spread values.  sub_box_rel_diff holds the largest difference between the   *
+ * values interpolated over a proper sub-box of each patch box and the values  *
+ * interpolated over the whole patch box, relative to their largest magnitude. *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            int& uncached_accesses,
+            std::vector<int>& num_hits,
+            std::vector<int>& num_misses,
+            std::vector<double>& interp_rel_diff,
+            std::vector<double>& spread_rel_diff,
+            std::vector<double>& interp_sum,
+            std::vector<double>& spread_integral,
+            double& sub_box_rel_diff)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_nodes = input_db->getIntegerWithDefault("NUM_NODES", 1000);
+        const int num_steps = input_db->getIntegerWithDefault("NUM_STEPS", 3);
+        const double dt = input_db->getDoubleWithDefault("DT", 1.0e-4);
+        const std::string kernel_fcn = input_db->getStringWithDefault("KERNEL_FCN", "IB_4");
+        const int num_cycles = num_steps + 2;
+        num_hits.resize(num_cycles);
+        num_misses.resize(num_cycles);
+        interp_rel_diff.resize(num_cycles);
+        spread_rel_diff.resize(num_cycles);
+        interp_sum.resize(num_cycles);
+        spread_integral.resize(num_cycles);
+
+        // Create the Lagrangian data manager and a single-level patch
+        // hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        const IntVector<NDIM> ghosts(LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        LDataManager* const l_data_manager = LDataManager::getManager(
+            "LDataManager", kernel_fcn, kernel_fcn, /*error_if_points_leave_domain*/ true, ghosts, false);
+        Pointer<PointCloudInitializer> l_initializer = new PointCloudInitializer(num_nodes, grid_geometry);
+        l_data_manager->registerLInitStrategy(l_initializer);
+        LDataManagerTagStrategy tag_strategy(l_data_manager);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               &tag_strategy,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        l_data_manager->beginDataRedistribution();
+        l_data_manager->endDataRedistribution();
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        const int lag_node_index_idx = l_data_manager->getLNodePatchDescriptorIndex();
+
+        // Create the Eulerian data.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u", NDIM);
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f", NDIM);
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, ghosts);
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, ghosts);
+        level->allocatePatchData(u_idx);
+        level->allocatePatchData(f_idx);
+        std::vector<int> f_ref_idxs(num_cycles);
+        for (auto& f_ref_idx : f_ref_idxs)
+        {
+            f_ref_idx = var_db->registerClonedPatchDataIndex(f_var, f_idx);
+            level->allocatePatchData(f_ref_idx);
+        }
+        fill_eulerian_data(level, u_idx);
+
+        // Create the Lagrangian data and save the initial node positions.
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, 0);
+        Pointer<LData> F_data = l_data_manager->createLData("F", 0, NDIM);
+        const std::vector<LNode*>& local_nodes = l_data_manager->getLMesh(0)->getLocalNodes();
+        boost::multi_array_ref<double, 2>& F_array = *F_data->getLocalFormVecArray();
+        for (const auto& node : local_nodes)
+        {
+            const int lag_idx = node->getLagrangianIndex();
+            const int local_idx = node->getLocalPETScIndex();
+            for (unsigned int d = 0; d < NDIM; ++d) F_array[local_idx][d] = std::sin(0.1 * lag_idx + d);
+        }
+        F_data->restoreArrays();
+        Vec X_init_vec;
+        VecDuplicate(X_data->getVec(), &X_init_vec);
+        VecCopy(X_data->getVec(), X_init_vec);
+
+        // Perform the cycles first without and then with the stencil cache.
+        std::vector<std::vector<double> > U_ref(num_cycles);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            const bool use_stencil_cache = pass == 1;
+            LEInteractor::s_use_stencil_cache = use_stencil_cache;
+            VecCopy(X_init_vec, X_data->getVec());
+            X_data->beginGhostUpdate();
+            X_data->endGhostUpdate();
+            for (int c = 0; c < num_cycles; ++c)
+            {
+                int hits_before = 0, misses_before = 0;
+                if (use_stencil_cache) get_cache_counts(hits_before, misses_before, level, lag_node_index_idx);
+
+                // Interpolate the velocity and spread the force.
+                l_data_manager->interp(u_idx, U_data, X_data, 0);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<CellData<NDIM, double> > f_data = level->getPatch(p())->getPatchData(f_idx);
+                    f_data->fillAll(0.0);
+                }
+                l_data_manager->spread(f_idx, F_data, X_data, kernel_fcn, NULL, 0);
+
+                // Compare the results with those obtained without the cache.
+                Comparison interp_comparison, spread_comparison;
+                double local_interp_sum = 0.0, local_spread_integral = 0.0;
+                boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+                const boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+                if (!use_stencil_cache) U_ref[c].resize(NDIM * local_nodes.size());
+                for (const auto& node : local_nodes)
+                {
+                    const int local_idx = node->getLocalPETScIndex();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (!use_stencil_cache) U_ref[c][d + NDIM * local_idx] = U_array[local_idx][d];
+                        interp_comparison.update(U_array[local_idx][d], U_ref[c][d + NDIM * local_idx]);
+                        local_interp_sum += U_array[local_idx][d];
+                    }
+                }
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<CellData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+                    Pointer<CellData<NDIM, double> > f_ref_data = patch->getPatchData(f_ref_idxs[c]);
+                    if (!use_stencil_cache) f_ref_data->copy(*f_data);
+                    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                    const double* const dx = pgeom->getDx();
+                    double cell_volume = 1.0;
+                    for (unsigned int d = 0; d < NDIM; ++d) cell_volume *= dx[d];
+                    for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+                    {
+                        const CellIndex<NDIM> i(b());
+                        for (unsigned int d = 0; d < NDIM; ++d)
+                        {
+                            spread_comparison.update((*f_data)(i, d), (*f_ref_data)(i, d));
+                            local_spread_integral += (*f_data)(i, d) * cell_volume;
+                        }
+                    }
+                }
+
+                // Move the nodes with the interpolated velocity, except after
+                // the last two cycles.
+                if (c < num_steps)
+                {
+                    for (const auto& node : local_nodes)
+                    {
+                        const int local_idx = node->getLocalPETScIndex();
+                        for (unsigned int d = 0; d < NDIM; ++d) X_array[local_idx][d] += dt * U_array[local_idx][d];
+                    }
+                }
+                X_data->restoreArrays();
+                U_data->restoreArrays();
+                X_data->beginGhostUpdate();
+                X_data->endGhostUpdate();
+
+                if (use_stencil_cache)
+                {
+                    int hits_after = 0, misses_after = 0;
+                    get_cache_counts(hits_after, misses_after, level, lag_node_index_idx);
+                    num_hits[c] = hits_after - hits_before;
+                    num_misses[c] = misses_after - misses_before;
+                    interp_rel_diff[c] = interp_comparison.relativeDifference();
+                    spread_rel_diff[c] = spread_comparison.relativeDifference();
+                    interp_sum[c] = SAMRAI_MPI::sumReduction(local_interp_sum);
+                    spread_integral[c] = SAMRAI_MPI::sumReduction(local_spread_integral);
+                    pout << "cycle " << c << ": " << num_hits[c] << " stencil cache hit(s), " << num_misses[c]
+                         << " stencil cache miss(es)\n";
+                }
+            }
+            if (!use_stencil_cache)
+            {
+                int hits = 0, misses = 0;
+                get_cache_counts(hits, misses, level, lag_node_index_idx);
+                uncached_accesses = hits + misses;
+            }
+        }
+        VecDestroy(&X_init_vec);
+
+        // Interpolate the velocity over a box that is neither the patch box nor
+        // the ghost box.  The nodes in the box must get the values obtained by
+        // interpolating over the patch box, and the other nodes must not be
+        // touched.
+        LEInteractor::s_use_stencil_cache = false;
+        const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(level->getRatio());
+        Comparison sub_box_comparison;
+        VecSet(U_data->getVec(), 0.0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(lag_node_index_idx);
+            Box<NDIM> sub_box = patch->getBox();
+            sub_box.lower()(0) += 1;
+            LEInteractor::interpolate(U_data, X_data, idx_data, u_data, patch, sub_box, periodic_shift, kernel_fcn);
+        }
+        const boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(lag_node_index_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            Box<NDIM> sub_box = patch_box;
+            sub_box.lower()(0) += 1;
+            for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+            {
+                const Index<NDIM>& i = it.getIndex();
+                if (!patch_box.contains(i)) continue;
+                for (const auto& node : it.getItem())
+                {
+                    const int local_idx = node->getLocalPETScIndex();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const double ref_val = sub_box.contains(i) ? U_ref.back()[d + NDIM * local_idx] : 0.0;
+                        sub_box_comparison.update(U_array[local_idx][d], ref_val);
+                    }
+                }
+            }
+        }
+        U_data->restoreArrays();
+        sub_box_rel_diff = sub_box_comparison.relativeDifference();
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
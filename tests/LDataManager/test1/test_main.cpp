@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+static const double REL_ERROR = 1.0e-10;
+static const double MAX_CACHE_DIFF = 1.0e-12;
+int uncached_accesses;
+std::vector<int> num_hits, num_misses;
+std::vector<double> interp_rel_diff, spread_rel_diff, interp_sum, spread_integral;
+std::vector<double> bench_interp_sum;
+double bench_spread_integral;
+double sub_box_rel_diff;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME LDataManager_test1_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME LDataManager_test1_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, cache_unused_when_disabled)
+{
+    EXPECT_EQ(uncached_accesses, 0);
+}
+
+// Spreading reuses the stencils computed for interpolation at the same
+// positions.  Moving the nodes invalidates the cached stencils, and no stencils
+// are recomputed when the nodes do not move.
+TEST(TEST_CASE_NAME, stencils_reused_between_interpolation_and_spreading)
+{
+    const int num_cycles = static_cast<int>(num_hits.size());
+    ASSERT_GE(num_cycles, 2);
+    for (int c = 0; c < num_cycles; ++c)
+    {
+        SCOPED_TRACE("cycle " + std::to_string(c));
+        EXPECT_GT(num_hits[c], 0);
+        if (c < num_cycles - 1)
+        {
+            EXPECT_GT(num_misses[c], 0);
+        }
+        else
+        {
+            EXPECT_EQ(num_misses[c], 0);
+        }
+    }
+}
+
+TEST(TEST_CASE_NAME, cached_results_match_uncached_results)
+{
+    for (int c = 0; c < static_cast<int>(num_hits.size()); ++c)
+    {
+        SCOPED_TRACE("cycle " + std::to_string(c));
+        EXPECT_LE(interp_rel_diff[c], MAX_CACHE_DIFF);
+        EXPECT_LE(spread_rel_diff[c], MAX_CACHE_DIFF);
+    }
+}
+
+TEST(TEST_CASE_NAME, interpolation_sum)
+{
+    ASSERT_EQ(interp_sum.size(), bench_interp_sum.size() + 1);
+    for (int c = 0; c < static_cast<int>(interp_sum.size()); ++c)
+    {
+        SCOPED_TRACE("cycle " + std::to_string(c));
+        const double bench = bench_interp_sum[std::min(c, static_cast<int>(bench_interp_sum.size()) - 1)];
+        EXPECT_LE(std::abs(interp_sum[c] - bench), std::abs(bench) * REL_ERROR);
+    }
+}
+
+TEST(TEST_CASE_NAME, spreading_integral)
+{
+    for (int c = 0; c < static_cast<int>(spread_integral.size()); ++c)
+    {
+        SCOPED_TRACE("cycle " + std::to_string(c));
+        EXPECT_LE(std::abs(spread_integral[c] - bench_spread_integral), std::abs(bench_spread_integral) * REL_ERROR);
+    }
+}
+
+// Interpolating over a box other than the patch box or the ghost box must give
+// the same values as interpolating over the patch box for the nodes in that box.
+TEST(TEST_CASE_NAME, sub_box_interpolation)
+{
+    EXPECT_LE(sub_box_rel_diff, MAX_CACHE_DIFF);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    // The sums of the linear Eulerian function over the node positions
+    // generated by NodeGenerator(1) and moved with velocity equal to that
+    // function for each of the NUM_STEPS = 3 time steps of size DT = 1.0e-4,
+    // and the sum of the Lagrangian values, for input[23]d.test.
+    if (NDIM == 2)
+    {
+        bench_interp_sum = {
+            2.810051484317567e+04, 2.811255738331033e+04, 2.812460502146620e+04, 2.813665775980291e+04
+        };
+        bench_spread_integral = 1.761740411016110e+01;
+    }
+    else if (NDIM == 3)
+    {
+        bench_interp_sum = {
+            1.557599326087116e+05, 1.559121091998160e+05, 1.560644320954483e+05, 1.562169014364132e+05
+        };
+        bench_spread_integral = 3.266911714960315e+01;
+    }
+
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc,
+                          ex_argv,
+                          uncached_accesses,
+                          num_hits,
+                          num_misses,
+                          interp_rel_diff,
+                          spread_rel_diff,
+                          interp_sum,
+                          spread_integral,
+                          sub_box_rel_diff);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,530 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIndex.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LEInteractor.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test compares the vectorizable C++ interpolation and spreading kernels
+// (LEInteractor::s_use_vectorized_kernels) with the Fortran kernels for all of
+// the kernel functions that the C++ kernels support, for cell-centered data of
+// depth 1 and 4 and for side-centered data.  It also checks that the C++
+// kernels conserve the spread quantities and reproduce linear functions when
+// interpolating.  The markers are generated over the whole computational
+// domain, so that the results do not depend on the patch decomposition or the
+// number of processes.
+
+namespace
+{
+static const int NUM_KERNELS = 12;
+static const std::string KERNEL_FCNS[NUM_KERNELS] = { "PIECEWISE_CONSTANT",
+                                                      "PIECEWISE_LINEAR",
+                                                      "PIECEWISE_CUBIC",
+                                                      "IB_3",
+                                                      "IB_4",
+                                                      "IB_4_W8",
+                                                      "IB_5",
+                                                      "IB_6",
+                                                      "BSPLINE_3",
+                                                      "BSPLINE_4",
+                                                      "BSPLINE_5",
+                                                      "BSPLINE_6" };
+
+// The operations that are compared, and the data layouts for which the
+// conservation and linear reproduction properties are checked.
+static const int NUM_OPS = 6;
+static const int NUM_LAYOUTS = 3;
+
+// A linear congruential generator, used so that the marker positions do not
+// depend on the standard library implementation.
+class MarkerGenerator
+{
+public:
+    explicit MarkerGenerator(const unsigned long long seed) : d_state(seed)
+    {
+    }
+
+    double next()
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(d_state >> 11) / 9007199254740992.0;
+    }
+
+private:
+    unsigned long long d_state;
+};
+
+// A linear function of position, which is reproduced exactly by all of the
+// kernels except PIECEWISE_CONSTANT.
+double
+linear_fcn(const double* const x, const int d)
+{
+    double val = 1.0 + d;
+    for (unsigned int k = 0; k < NDIM; ++k) val += (k + d + 1) * x[k];
+    return val;
+} // linear_fcn
+
+void
+fill_array_data(ArrayData<NDIM, double>& data, const int seed)
+{
+    for (int d = 0; d < data.getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator b(data.getBox()); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            double val = 1.0 + 0.5 * (seed + d);
+            for (unsigned int k = 0; k < NDIM; ++k)
+            {
+                val *= std::cos(0.37 * (k + 1) * i(k) + 0.11 * (d + seed));
+            }
+            data(i, d) = val;
+        }
+    }
+    return;
+} // fill_array_data
+
+// Fill the data with linear functions of position.  Component d of
+// cell-centered data and axis d of side-centered data are set to the dth linear
+// function.
+void
+fill_linear_data(CellData<NDIM, double>& data, Pointer<Patch<NDIM> > patch)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const Index<NDIM>& ilower = patch->getBox().lower();
+    for (Box<NDIM>::Iterator b(data.getGhostBox()); b; b++)
+    {
+        const CellIndex<NDIM> i(b());
+        double x[NDIM];
+        for (unsigned int k = 0; k < NDIM; ++k) x[k] = x_lower[k] + dx[k] * (i(k) - ilower(k) + 0.5);
+        for (int d = 0; d < data.getDepth(); ++d) data(i, d) = linear_fcn(x, d);
+    }
+    return;
+} // fill_linear_data
+
+void
+fill_linear_data(SideData<NDIM, double>& data, Pointer<Patch<NDIM> > patch)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const Index<NDIM>& ilower = patch->getBox().lower();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(data.getGhostBox(), axis)); b; b++)
+        {
+            const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+            double x[NDIM];
+            for (unsigned int k = 0; k < NDIM; ++k)
+            {
+                x[k] = x_lower[k] + dx[k] * (i(k) - ilower(k) + (k == axis ? 0.0 : 0.5));
+            }
+            data(i) = linear_fcn(x, axis);
+        }
+    }
+    return;
+} // fill_linear_data
+
+// Return the sum of the values multiplied by the cell volume.
+double
+integrate(const ArrayData<NDIM, double>& data, const double* const dx)
+{
+    double cell_volume = 1.0;
+    for (unsigned int k = 0; k < NDIM; ++k) cell_volume *= dx[k];
+    double integral = 0.0;
+    for (int d = 0; d < data.getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator b(data.getBox()); b; b++)
+        {
+            integral += data(b(), d) * cell_volume;
+        }
+    }
+    return integral;
+} // integrate
+
+double
+integrate(const CellData<NDIM, double>& data, const double* const dx)
+{
+    return integrate(data.getArrayData(), dx);
+} // integrate
+
+double
+integrate(const SideData<NDIM, double>& data, const double* const dx)
+{
+    double integral = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis) integral += integrate(data.getArrayData(axis), dx);
+    return integral;
+} // integrate
+
+// Return the largest absolute difference between the two arrays and update the
+// largest absolute value of the first array.
+double
+max_abs_diff(const ArrayData<NDIM, double>& a, const ArrayData<NDIM, double>& b, double& max_abs)
+{
+    double max_diff = 0.0;
+    for (int d = 0; d < a.getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator bb(a.getBox()); bb; bb++)
+        {
+            const Index<NDIM>& i = bb();
+            max_diff = std::max(max_diff, std::abs(a(i, d) - b(i, d)));
+            max_abs = std::max(max_abs, std::abs(a(i, d)));
+        }
+    }
+    return max_diff;
+} // max_abs_diff
+
+double
+max_abs_diff(const CellData<NDIM, double>& a, const CellData<NDIM, double>& b, double& max_abs)
+{
+    return max_abs_diff(a.getArrayData(), b.getArrayData(), max_abs);
+} // max_abs_diff
+
+double
+max_abs_diff(const SideData<NDIM, double>& a, const SideData<NDIM, double>& b, double& max_abs)
+{
+    double max_diff = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        max_diff = std::max(max_diff, max_abs_diff(a.getArrayData(axis), b.getArrayData(axis), max_abs));
+    }
+    return max_diff;
+} // max_abs_diff
+
+double
+max_abs_diff(const std::vector<double>& a, const std::vector<double>& b, double& max_abs)
+{
+    double max_diff = 0.0;
+    for (unsigned int k = 0; k < a.size(); ++k)
+    {
+        max_diff = std::max(max_diff, std::abs(a[k] - b[k]));
+        max_abs = std::max(max_abs, std::abs(a[k]));
+    }
+    return max_diff;
+} // max_abs_diff
+
+// Accumulates the largest differences between the results of the two
+// implementations of a particular operation, along with the time spent in
+// each implementation.
+struct Comparison
+{
+    double max_diff = 0.0, max_abs = 0.0;
+    double fortran_time = 0.0, vectorized_time = 0.0;
+
+    double relativeDifference() const
+    {
+        const double max_diff_all = SAMRAI_MPI::maxReduction(max_diff);
+        const double max_abs_all = SAMRAI_MPI::maxReduction(max_abs);
+        return max_diff_all / std::max(max_abs_all, 1.0);
+    }
+};
+
+template <class DataType>
+void
+compare_interpolation(Comparison& comparison,
+                      Pointer<DataType> q_data,
+                      const int Q_depth,
+                      const std::vector<double>& X,
+                      Pointer<Patch<NDIM> > patch,
+                      const std::string& kernel_fcn,
+                      const int num_reps)
+{
+    const int num_markers = static_cast<int>(X.size()) / NDIM;
+    std::vector<double> Q_fortran(Q_depth * num_markers), Q_vectorized(Q_depth * num_markers);
+    const bool use_vectorized_kernels = LEInteractor::s_use_vectorized_kernels;
+    for (int vectorized = 0; vectorized < 2; ++vectorized)
+    {
+        LEInteractor::s_use_vectorized_kernels = vectorized == 1;
+        std::vector<double>& Q = vectorized ? Q_vectorized : Q_fortran;
+        const double start_time = MPI_Wtime();
+        for (int k = 0; k < num_reps; ++k)
+        {
+            LEInteractor::interpolate(Q, Q_depth, X, NDIM, q_data, patch, patch->getBox(), kernel_fcn);
+        }
+        (vectorized ? comparison.vectorized_time : comparison.fortran_time) += MPI_Wtime() - start_time;
+    }
+    LEInteractor::s_use_vectorized_kernels = use_vectorized_kernels;
+    comparison.max_diff = std::max(comparison.max_diff, max_abs_diff(Q_fortran, Q_vectorized, comparison.max_abs));
+    return;
+} // compare_interpolation
+
+template <class DataType>
+void
+compare_spreading(Comparison& comparison,
+                  Pointer<DataType> q_fortran,
+                  Pointer<DataType> q_vectorized,
+                  const std::vector<double>& Q,
+                  const int Q_depth,
+                  const std::vector<double>& X,
+                  Pointer<Patch<NDIM> > patch,
+                  const std::string& kernel_fcn,
+                  const int num_reps)
+{
+    const bool use_vectorized_kernels = LEInteractor::s_use_vectorized_kernels;
+    for (int vectorized = 0; vectorized < 2; ++vectorized)
+    {
+        LEInteractor::s_use_vectorized_kernels = vectorized == 1;
+        Pointer<DataType> q_data = vectorized ? q_vectorized : q_fortran;
+        q_data->fillAll(0.0);
+        const double start_time = MPI_Wtime();
+        for (int k = 0; k < num_reps; ++k)
+        {
+            LEInteractor::spread(q_data, Q, Q_depth, X, NDIM, patch, patch->getBox(), kernel_fcn);
+        }
+        (vectorized ? comparison.vectorized_time : comparison.fortran_time) += MPI_Wtime() - start_time;
+    }
+    LEInteractor::s_use_vectorized_kernels = use_vectorized_kernels;
+    comparison.max_diff = std::max(comparison.max_diff, max_abs_diff(*q_fortran, *q_vectorized, comparison.max_abs));
+    return;
+} // compare_spreading
+
+// Spread the values once with the C++ kernels and return the integral of the
+// spread values, and interpolate linear functions with the C++ kernels and
+// return the sum of the interpolated values.
+template <class DataType>
+void
+check_moments(double& spread_integral,
+              double& interp_sum,
+              Pointer<DataType> q_data,
+              const std::vector<double>& Q,
+              const int Q_depth,
+              const std::vector<double>& X,
+              Pointer<Patch<NDIM> > patch,
+              const std::string& kernel_fcn)
+{
+    const bool use_vectorized_kernels = LEInteractor::s_use_vectorized_kernels;
+    LEInteractor::s_use_vectorized_kernels = true;
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    q_data->fillAll(0.0);
+    LEInteractor::spread(q_data, Q, Q_depth, X, NDIM, patch, patch->getBox(), kernel_fcn);
+    spread_integral += integrate(*q_data, pgeom->getDx());
+    fill_linear_data(*q_data, patch);
+    std::vector<double> Q_interp(Q.size(), 0.0);
+    LEInteractor::interpolate(Q_interp, Q_depth, X, NDIM, q_data, patch, patch->getBox(), kernel_fcn);
+    for (const auto& q : Q_interp) interp_sum += q;
+    LEInteractor::s_use_vectorized_kernels = use_vectorized_kernels;
+    return;
+} // check_moments
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, max_rel_diff[NUM_OPS*k+op] is the largest difference between   *
+ * the Fortran and C++ kernels for operation op and kernel function k,         *
+ * relative to the largest magnitude of the results, and                       *
+ * spread_integral[NUM_LAYOUTS*k+l] and interp_sum[NUM_LAYOUTS*k+l] are the    *
+ * integral of the spread values and the sum of the interpolated linear        *
+ * functions for data layout l.                                                *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            std::vector<double>& max_rel_diff,
+            std::vector<double>& spread_integral,
+            std::vector<double>& interp_sum)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    max_rel_diff.resize(NUM_OPS * NUM_KERNELS);
+    spread_integral.resize(NUM_LAYOUTS * NUM_KERNELS);
+    interp_sum.resize(NUM_LAYOUTS * NUM_KERNELS);
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_markers = input_db->getIntegerWithDefault("NUM_MARKERS", 2000);
+        const int num_reps = input_db->getIntegerWithDefault("NUM_REPETITIONS", 1);
+
+        // Create a single-level patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+
+        int gcw = 0;
+        for (const auto& kernel_fcn : KERNEL_FCNS)
+        {
+            gcw = std::max(gcw, LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        }
+        const IntVector<NDIM> ghosts(gcw);
+
+        // Generate the markers over the whole domain, along with the values to
+        // spread.
+        const double* const domain_x_lower = grid_geometry->getXLower();
+        const double* const domain_x_upper = grid_geometry->getXUpper();
+        MarkerGenerator generator(1);
+        std::vector<double> X(NDIM * num_markers), Q1(num_markers), Q4(4 * num_markers), QS(NDIM * num_markers);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X[d + NDIM * k] = domain_x_lower[d] + generator.next() * (domain_x_upper[d] - domain_x_lower[d]);
+            }
+        }
+        for (auto& Q : Q1) Q = generator.next() - 0.5;
+        for (auto& Q : Q4) Q = generator.next() - 0.5;
+        for (auto& Q : QS) Q = generator.next() - 0.5;
+
+        for (int kernel = 0; kernel < NUM_KERNELS; ++kernel)
+        {
+            const std::string& kernel_fcn = KERNEL_FCNS[kernel];
+            Comparison comparisons[NUM_OPS];
+            double integrals[NUM_LAYOUTS] = { 0.0 }, sums[NUM_LAYOUTS] = { 0.0 };
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+
+                // Collect the markers that lie within the patch.
+                std::vector<double> X_patch, Q1_patch, Q4_patch, QS_patch;
+                for (int k = 0; k < num_markers; ++k)
+                {
+                    if (!patch_box.contains(IndexUtilities::getCellIndex(&X[NDIM * k], pgeom, patch_box))) continue;
+                    X_patch.insert(X_patch.end(), &X[NDIM * k], &X[NDIM * k] + NDIM);
+                    Q1_patch.push_back(Q1[k]);
+                    Q4_patch.insert(Q4_patch.end(), &Q4[4 * k], &Q4[4 * k] + 4);
+                    QS_patch.insert(QS_patch.end(), &QS[NDIM * k], &QS[NDIM * k] + NDIM);
+                }
+
+                // Cell-centered data.
+                for (int depth : { 1, 4 })
+                {
+                    const int op = depth == 1 ? 0 : 2;
+                    const std::vector<double>& Q_patch = depth == 1 ? Q1_patch : Q4_patch;
+                    Pointer<CellData<NDIM, double> > q_data = new CellData<NDIM, double>(patch_box, depth, ghosts);
+                    fill_array_data(q_data->getArrayData(), depth);
+                    compare_interpolation(comparisons[op], q_data, depth, X_patch, patch, kernel_fcn, num_reps);
+                    Pointer<CellData<NDIM, double> > q_fortran = new CellData<NDIM, double>(patch_box, depth, ghosts);
+                    Pointer<CellData<NDIM, double> > q_vectorized =
+                        new CellData<NDIM, double>(patch_box, depth, ghosts);
+                    compare_spreading(comparisons[op + 1],
+                                      q_fortran,
+                                      q_vectorized,
+                                      Q_patch,
+                                      depth,
+                                      X_patch,
+                                      patch,
+                                      kernel_fcn,
+                                      num_reps);
+                    check_moments(integrals[op / 2], sums[op / 2], q_data, Q_patch, depth, X_patch, patch, kernel_fcn);
+                }
+
+                // Side-centered data.
+                Pointer<SideData<NDIM, double> > q_data = new SideData<NDIM, double>(patch_box, 1, ghosts);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    fill_array_data(q_data->getArrayData(axis), axis);
+                }
+                compare_interpolation(comparisons[4], q_data, NDIM, X_patch, patch, kernel_fcn, num_reps);
+                Pointer<SideData<NDIM, double> > q_fortran = new SideData<NDIM, double>(patch_box, 1, ghosts);
+                Pointer<SideData<NDIM, double> > q_vectorized = new SideData<NDIM, double>(patch_box, 1, ghosts);
+                compare_spreading(
+                    comparisons[5], q_fortran, q_vectorized, QS_patch, NDIM, X_patch, patch, kernel_fcn, num_reps);
+                check_moments(integrals[2], sums[2], q_data, QS_patch, NDIM, X_patch, patch, kernel_fcn);
+            }
+
+            static const std::string op_names[NUM_OPS] = { "cell-centered interpolation (depth 1)",
+                                                           "cell-centered spreading (depth 1)",
+                                                           "cell-centered interpolation (depth 4)",
+                                                           "cell-centered spreading (depth 4)",
+                                                           "side-centered interpolation",
+                                                           "side-centered spreading" };
+            pout << kernel_fcn << "\n";
+            for (int op = 0; op < NUM_OPS; ++op)
+            {
+                max_rel_diff[NUM_OPS * kernel + op] = comparisons[op].relativeDifference();
+                pout << "  " << op_names[op] << ": Fortran: " << SAMRAI_MPI::maxReduction(comparisons[op].fortran_time)
+                     << " s, vectorized: " << SAMRAI_MPI::maxReduction(comparisons[op].vectorized_time) << " s\n";
+            }
+            for (int l = 0; l < NUM_LAYOUTS; ++l)
+            {
+                spread_integral[NUM_LAYOUTS * kernel + l] = SAMRAI_MPI::sumReduction(integrals[l]);
+                interp_sum[NUM_LAYOUTS * kernel + l] = SAMRAI_MPI::sumReduction(sums[l]);
+            }
+        }
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+static const double REL_ERROR = 1.0e-10;
+static const double MAX_KERNEL_DIFF = 1.0e-12;
+std::vector<double> max_rel_diff, spread_integral, interp_sum;
+std::vector<double> bench_spread_integral, bench_interp_sum;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME LEInteractor_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME LEInteractor_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+// The Fortran and C++ kernels must agree to round-off for every kernel
+// function and operation.
+TEST(TEST_CASE_NAME, vectorized_kernels_match_fortran_kernels)
+{
+    for (int kernel = 0; kernel < NUM_KERNELS; ++kernel)
+    {
+        for (int op = 0; op < NUM_OPS; ++op)
+        {
+            SCOPED_TRACE(KERNEL_FCNS[kernel] + " operation " + std::to_string(op));
+            EXPECT_LE(max_rel_diff[NUM_OPS * kernel + op], MAX_KERNEL_DIFF);
+        }
+    }
+}
+
+// Spreading conserves the total of the spread values for every kernel
+// function.
+TEST(TEST_CASE_NAME, spreading_is_conservative)
+{
+    for (int kernel = 0; kernel < NUM_KERNELS; ++kernel)
+    {
+        for (int l = 0; l < NUM_LAYOUTS; ++l)
+        {
+            SCOPED_TRACE(KERNEL_FCNS[kernel] + " layout " + std::to_string(l));
+            const double bench = bench_spread_integral[l];
+            const double actual = spread_integral[NUM_LAYOUTS * kernel + l];
+            EXPECT_LE(std::abs(actual - bench), std::max(std::abs(bench), 1.0) * REL_ERROR);
+        }
+    }
+}
+
+// Interpolation reproduces linear functions for every kernel function except
+// PIECEWISE_CONSTANT.
+TEST(TEST_CASE_NAME, interpolation_reproduces_linear_functions)
+{
+    for (int kernel = 1; kernel < NUM_KERNELS; ++kernel)
+    {
+        for (int l = 0; l < NUM_LAYOUTS; ++l)
+        {
+            SCOPED_TRACE(KERNEL_FCNS[kernel] + " layout " + std::to_string(l));
+            const double bench = bench_interp_sum[l];
+            const double actual = interp_sum[NUM_LAYOUTS * kernel + l];
+            EXPECT_LE(std::abs(actual - bench), std::abs(bench) * REL_ERROR);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    // Sums of the values generated by MarkerGenerator(1) for input[23]d.test,
+    // for cell-centered data of depth 1 and 4 and for side-centered data.
+    bench_spread_integral.resize(NUM_LAYOUTS);
+    bench_interp_sum.resize(NUM_LAYOUTS);
+    if (NDIM == 2)
+    {
+        bench_spread_integral[0] = 1.091101573180944e+01;
+        bench_spread_integral[1] = -1.054062616946711e+01;
+        bench_spread_integral[2] = -4.021310188712035e-02;
+        bench_interp_sum[0] = 5.020784396805174e+03;
+        bench_interp_sum[1] = 4.414757116172001e+04;
+        bench_interp_sum[2] = 1.405230772269357e+04;
+    }
+    else if (NDIM == 3)
+    {
+        bench_spread_integral[0] = 7.527522625690044e+00;
+        bench_spread_integral[1] = -1.413980668581470e+01;
+        bench_spread_integral[2] = -1.435201901749424e+01;
+        bench_interp_sum[0] = 8.026399890369124e+03;
+        bench_interp_sum[1] = 6.223549923036666e+04;
+        bench_interp_sum[2] = 3.914414950555246e+04;
+    }
+
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc, ex_argv, max_rel_diff, spread_integral, interp_sum);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,422 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LEInteractor.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test checks that the multithreaded spreading implementations are
+// reproducible.  For each kernel function supported by the C++ kernels, and
+// using both the Fortran and the C++ kernels, values are spread to
+// cell-centered and side-centered data using 1, 2, ..., MAX_NUM_THREADS
+// threads.  Fixed-order spreading (LEInteractor::s_use_fixed_order_spreading)
+// must yield results that are bitwise identical to those of unthreaded
+// spreading with the same kernels, and the colored tiling must yield results
+// that do not depend on the number of threads and that agree with unthreaded
+// spreading up to round-off.  The
+// markers are generated over the whole computational domain, so that the
+// integrals of the spread values do not depend on the patch decomposition or
+// the number of processes.
+
+namespace
+{
+static const int NUM_KERNELS = 12;
+static const std::string KERNEL_FCNS[NUM_KERNELS] = { "PIECEWISE_CONSTANT",
+                                                      "PIECEWISE_LINEAR",
+                                                      "PIECEWISE_CUBIC",
+                                                      "IB_3",
+                                                      "IB_4",
+                                                      "IB_4_W8",
+                                                      "IB_5",
+                                                      "IB_6",
+                                                      "BSPLINE_3",
+                                                      "BSPLINE_4",
+                                                      "BSPLINE_5",
+                                                      "BSPLINE_6" };
+
+// Cell-centered data of depth 3 and side-centered data.
+static const int NUM_LAYOUTS = 2;
+
+// The Fortran kernels and the C++ kernels (LEInteractor::s_use_vectorized_kernels).
+static const int NUM_IMPLEMENTATIONS = 2;
+static const std::string IMPLEMENTATION_NAMES[NUM_IMPLEMENTATIONS] = { "Fortran", "C++" };
+
+// A linear congruential generator, used so that the marker positions do not
+// depend on the standard library implementation.
+class MarkerGenerator
+{
+public:
+    explicit MarkerGenerator(const unsigned long long seed) : d_state(seed)
+    {
+    }
+
+    double next()
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(d_state >> 11) / 9007199254740992.0;
+    }
+
+private:
+    unsigned long long d_state;
+};
+
+// Return the number of entries of the two arrays that are not bitwise
+// identical, and update the largest absolute difference and the largest
+// absolute value of the first array.
+int
+num_mismatches(const ArrayData<NDIM, double>& a, const ArrayData<NDIM, double>& b, double& max_diff, double& max_abs)
+{
+    int count = 0;
+    for (int d = 0; d < a.getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator bb(a.getBox()); bb; bb++)
+        {
+            const Index<NDIM>& i = bb();
+            if (!(a(i, d) == b(i, d))) ++count;
+            max_diff = std::max(max_diff, std::abs(a(i, d) - b(i, d)));
+            max_abs = std::max(max_abs, std::abs(a(i, d)));
+        }
+    }
+    return count;
+} // num_mismatches
+
+int
+num_mismatches(const CellData<NDIM, double>& a, const CellData<NDIM, double>& b, double& max_diff, double& max_abs)
+{
+    return num_mismatches(a.getArrayData(), b.getArrayData(), max_diff, max_abs);
+} // num_mismatches
+
+int
+num_mismatches(const SideData<NDIM, double>& a, const SideData<NDIM, double>& b, double& max_diff, double& max_abs)
+{
+    int count = 0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        count += num_mismatches(a.getArrayData(axis), b.getArrayData(axis), max_diff, max_abs);
+    }
+    return count;
+} // num_mismatches
+
+// Return the sum of the values multiplied by the cell volume.
+double
+integrate(const ArrayData<NDIM, double>& data, const double* const dx)
+{
+    double cell_volume = 1.0;
+    for (unsigned int k = 0; k < NDIM; ++k) cell_volume *= dx[k];
+    double integral = 0.0;
+    for (int d = 0; d < data.getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator b(data.getBox()); b; b++)
+        {
+            integral += data(b(), d) * cell_volume;
+        }
+    }
+    return integral;
+} // integrate
+
+double
+integrate(const CellData<NDIM, double>& data, const double* const dx)
+{
+    return integrate(data.getArrayData(), dx);
+} // integrate
+
+double
+integrate(const SideData<NDIM, double>& data, const double* const dx)
+{
+    double integral = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis) integral += integrate(data.getArrayData(axis), dx);
+    return integral;
+} // integrate
+
+// Spread the values using the specified configuration of LEInteractor and the
+// specified number of threads.  Returns the elapsed time.
+template <class DataType>
+double
+spread(Pointer<DataType> q_data,
+       const std::vector<double>& Q,
+       const int Q_depth,
+       const std::vector<double>& X,
+       Pointer<Patch<NDIM> > patch,
+       const std::string& kernel_fcn,
+       const bool use_threaded_interaction,
+       const bool use_fixed_order_spreading,
+       const int num_threads,
+       const int num_reps)
+{
+    LEInteractor::s_use_threaded_interaction = use_threaded_interaction;
+    LEInteractor::s_use_fixed_order_spreading = use_fixed_order_spreading;
+#ifdef _OPENMP
+    omp_set_num_threads(num_threads);
+#else
+    NULL_USE(num_threads);
+#endif
+    q_data->fillAll(0.0);
+    const double start_time = MPI_Wtime();
+    for (int k = 0; k < num_reps; ++k)
+    {
+        LEInteractor::spread(q_data, Q, Q_depth, X, NDIM, patch, patch->getBox(), kernel_fcn);
+    }
+    return MPI_Wtime() - start_time;
+} // spread
+
+// Accumulates the number of mismatched values for the two threaded spreading
+// implementations, the largest difference between colored and unthreaded
+// spreading, and the integral of the spread values.
+struct Comparison
+{
+    int fixed_order_mismatches = 0, colored_mismatches = 0;
+    double colored_max_diff = 0.0, max_abs = 0.0;
+    double integral = 0.0;
+};
+
+template <class DataType>
+void
+compare_spreading(Comparison& comparison,
+                  Pointer<DataType> q_serial,
+                  Pointer<DataType> q_colored,
+                  Pointer<DataType> q_threaded,
+                  const std::vector<double>& Q,
+                  const int Q_depth,
+                  const std::vector<double>& X,
+                  Pointer<Patch<NDIM> > patch,
+                  const std::string& kernel_fcn,
+                  const int max_num_threads,
+                  const int num_reps)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    spread(q_serial, Q, Q_depth, X, patch, kernel_fcn, false, false, 1, 1);
+    comparison.integral += integrate(*q_serial, pgeom->getDx());
+    spread(q_colored, Q, Q_depth, X, patch, kernel_fcn, true, false, 1, 1);
+    num_mismatches(*q_serial, *q_colored, comparison.colored_max_diff, comparison.max_abs);
+    double unused_diff = 0.0, unused_abs = 0.0;
+    for (int num_threads = 1; num_threads <= max_num_threads; ++num_threads)
+    {
+        const double fixed_order_time =
+            spread(q_threaded, Q, Q_depth, X, patch, kernel_fcn, true, true, num_threads, num_reps);
+        if (num_reps != 1) spread(q_threaded, Q, Q_depth, X, patch, kernel_fcn, true, true, num_threads, 1);
+        comparison.fixed_order_mismatches += num_mismatches(*q_serial, *q_threaded, unused_diff, unused_abs);
+        const double colored_time =
+            spread(q_threaded, Q, Q_depth, X, patch, kernel_fcn, true, false, num_threads, num_reps);
+        if (num_reps != 1) spread(q_threaded, Q, Q_depth, X, patch, kernel_fcn, true, false, num_threads, 1);
+        comparison.colored_mismatches += num_mismatches(*q_colored, *q_threaded, unused_diff, unused_abs);
+        plog << "  " << num_threads << " thread(s): fixed-order: " << fixed_order_time
+             << " s, colored: " << colored_time << " s\n";
+    }
+    return;
+} // compare_spreading
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, the entries NUM_LAYOUTS*(NUM_KERNELS*i+k)+l of the output     *
+ * vectors hold, for kernel implementation i, kernel function k, and data      *
+ * layout l, the number of values for which fixed-order spreading differs from *
+ * unthreaded spreading, the number of values for which colored spreading     *
+ * depends on the number of threads, the largest difference between colored   *
+ * and unthreaded spreading relative to the largest magnitude of the spread    *
+ * values, and the integral of the values spread without threading.            *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            std::vector<int>& fixed_order_mismatches,
+            std::vector<int>& colored_mismatches,
+            std::vector<double>& colored_rel_diff,
+            std::vector<double>& spread_integral)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    fixed_order_mismatches.resize(NUM_IMPLEMENTATIONS * NUM_KERNELS * NUM_LAYOUTS);
+    colored_mismatches.resize(NUM_IMPLEMENTATIONS * NUM_KERNELS * NUM_LAYOUTS);
+    colored_rel_diff.resize(NUM_IMPLEMENTATIONS * NUM_KERNELS * NUM_LAYOUTS);
+    spread_integral.resize(NUM_IMPLEMENTATIONS * NUM_KERNELS * NUM_LAYOUTS);
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_markers = input_db->getIntegerWithDefault("NUM_MARKERS", 2000);
+        const int num_reps = input_db->getIntegerWithDefault("NUM_REPETITIONS", 1);
+        const int max_num_threads = input_db->getIntegerWithDefault("MAX_NUM_THREADS", 4);
+
+        // Create a single-level patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+
+        int gcw = 0;
+        for (const auto& kernel_fcn : KERNEL_FCNS)
+        {
+            gcw = std::max(gcw, LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        }
+        const IntVector<NDIM> ghosts(gcw);
+
+        // Generate the markers over the whole domain, along with the values to
+        // spread.
+        const double* const domain_x_lower = grid_geometry->getXLower();
+        const double* const domain_x_upper = grid_geometry->getXUpper();
+        MarkerGenerator generator(1);
+        std::vector<double> X(NDIM * num_markers), QC(3 * num_markers), QS(NDIM * num_markers);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X[d + NDIM * k] = domain_x_lower[d] + generator.next() * (domain_x_upper[d] - domain_x_lower[d]);
+            }
+        }
+        for (auto& Q : QC) Q = generator.next() - 0.5;
+        for (auto& Q : QS) Q = generator.next() - 0.5;
+
+        for (int impl = 0; impl < NUM_IMPLEMENTATIONS; ++impl)
+        {
+            LEInteractor::s_use_vectorized_kernels = impl == 1;
+            for (int kernel = 0; kernel < NUM_KERNELS; ++kernel)
+            {
+                const std::string& kernel_fcn = KERNEL_FCNS[kernel];
+                Comparison comparisons[NUM_LAYOUTS];
+                plog << IMPLEMENTATION_NAMES[impl] << " " << kernel_fcn << "\n";
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    const Box<NDIM>& patch_box = patch->getBox();
+                    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+
+                    // Collect the markers that lie within the patch.
+                    std::vector<double> X_patch, QC_patch, QS_patch;
+                    for (int k = 0; k < num_markers; ++k)
+                    {
+                        if (!patch_box.contains(IndexUtilities::getCellIndex(&X[NDIM * k], pgeom, patch_box))) continue;
+                        X_patch.insert(X_patch.end(), &X[NDIM * k], &X[NDIM * k] + NDIM);
+                        QC_patch.insert(QC_patch.end(), &QC[3 * k], &QC[3 * k] + 3);
+                        QS_patch.insert(QS_patch.end(), &QS[NDIM * k], &QS[NDIM * k] + NDIM);
+                    }
+
+                    // Cell-centered data.
+                    Pointer<CellData<NDIM, double> > qc_serial = new CellData<NDIM, double>(patch_box, 3, ghosts);
+                    Pointer<CellData<NDIM, double> > qc_colored = new CellData<NDIM, double>(patch_box, 3, ghosts);
+                    Pointer<CellData<NDIM, double> > qc_threaded = new CellData<NDIM, double>(patch_box, 3, ghosts);
+                    compare_spreading(comparisons[0],
+                                      qc_serial,
+                                      qc_colored,
+                                      qc_threaded,
+                                      QC_patch,
+                                      3,
+                                      X_patch,
+                                      patch,
+                                      kernel_fcn,
+                                      max_num_threads,
+                                      num_reps);
+
+                    // Side-centered data.
+                    Pointer<SideData<NDIM, double> > qs_serial = new SideData<NDIM, double>(patch_box, 1, ghosts);
+                    Pointer<SideData<NDIM, double> > qs_colored = new SideData<NDIM, double>(patch_box, 1, ghosts);
+                    Pointer<SideData<NDIM, double> > qs_threaded = new SideData<NDIM, double>(patch_box, 1, ghosts);
+                    compare_spreading(comparisons[1],
+                                      qs_serial,
+                                      qs_colored,
+                                      qs_threaded,
+                                      QS_patch,
+                                      NDIM,
+                                      X_patch,
+                                      patch,
+                                      kernel_fcn,
+                                      max_num_threads,
+                                      num_reps);
+                }
+
+                for (int l = 0; l < NUM_LAYOUTS; ++l)
+                {
+                    const int k = NUM_LAYOUTS * (NUM_KERNELS * impl + kernel) + l;
+                    fixed_order_mismatches[k] = SAMRAI_MPI::sumReduction(comparisons[l].fixed_order_mismatches);
+                    colored_mismatches[k] = SAMRAI_MPI::sumReduction(comparisons[l].colored_mismatches);
+                    colored_rel_diff[k] = SAMRAI_MPI::maxReduction(comparisons[l].colored_max_diff) /
+                                          std::max(SAMRAI_MPI::maxReduction(comparisons[l].max_abs), 1.0);
+                    spread_integral[k] = SAMRAI_MPI::sumReduction(comparisons[l].integral);
+                }
+            }
+        }
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+static const double REL_ERROR = 1.0e-10;
+static const double MAX_COLORED_DIFF = 1.0e-12;
+std::vector<int> fixed_order_mismatches, colored_mismatches;
+std::vector<double> colored_rel_diff, spread_integral;
+std::vector<double> bench_spread_integral;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME LEInteractor_test1_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME LEInteractor_test1_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+// Fixed-order spreading is bitwise identical to unthreaded spreading with the
+// same (Fortran or C++) kernels for any number of threads.
+TEST(TEST_CASE_NAME, fixed_order_spreading_matches_unthreaded_spreading)
+{
+    for (int k = 0; k < NUM_IMPLEMENTATIONS * NUM_KERNELS * NUM_LAYOUTS; ++k)
+    {
+        SCOPED_TRACE(IMPLEMENTATION_NAMES[k / (NUM_KERNELS * NUM_LAYOUTS)] + " " +
+                     KERNEL_FCNS[(k / NUM_LAYOUTS) % NUM_KERNELS] + " layout " + std::to_string(k % NUM_LAYOUTS));
+        EXPECT_EQ(fixed_order_mismatches[k], 0);
+    }
+}
+
+// Colored spreading does not depend on the number of threads, and agrees with
+// unthreaded spreading up to round-off.
+TEST(TEST_CASE_NAME, colored_spreading_is_independent_of_number_of_threads)
+{
+    for (int k = 0; k < NUM_IMPLEMENTATIONS * NUM_KERNELS * NUM_LAYOUTS; ++k)
+    {
+        SCOPED_TRACE(IMPLEMENTATION_NAMES[k / (NUM_KERNELS * NUM_LAYOUTS)] + " " +
+                     KERNEL_FCNS[(k / NUM_LAYOUTS) % NUM_KERNELS] + " layout " + std::to_string(k % NUM_LAYOUTS));
+        EXPECT_EQ(colored_mismatches[k], 0);
+        EXPECT_LE(colored_rel_diff[k], MAX_COLORED_DIFF);
+    }
+}
+
+TEST(TEST_CASE_NAME, spreading_is_conservative)
+{
+    for (int k = 0; k < NUM_IMPLEMENTATIONS * NUM_KERNELS * NUM_LAYOUTS; ++k)
+    {
+        SCOPED_TRACE(IMPLEMENTATION_NAMES[k / (NUM_KERNELS * NUM_LAYOUTS)] + " " +
+                     KERNEL_FCNS[(k / NUM_LAYOUTS) % NUM_KERNELS] + " layout " + std::to_string(k % NUM_LAYOUTS));
+        const double bench = bench_spread_integral[k % NUM_LAYOUTS];
+        const double actual = spread_integral[k];
+        EXPECT_LE(std::abs(actual - bench), std::max(std::abs(bench), 1.0) * REL_ERROR);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    // Sums of the values generated by MarkerGenerator(1) for input[23]d.test,
+    // for cell-centered data of depth 3 and for side-centered data.
+    bench_spread_integral.resize(NUM_LAYOUTS);
+    if (NDIM == 2)
+    {
+        bench_spread_integral[0] = 9.226933846122245e+00;
+        bench_spread_integral[1] = -8.856544283779918e+00;
+    }
+    else if (NDIM == 3)
+    {
+        bench_spread_integral[0] = -1.697222637134930e+01;
+        bench_spread_integral[1] = 6.391387099995063e+00;
+    }
+
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(
+        ex_argc, ex_argv, fixed_order_mismatches, colored_mismatches, colored_rel_diff, spread_integral);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,408 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/NonbondedForceEvaluator.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LInitStrategy.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+#include <ibtk/LNodeSetData.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// This test checks that the forces computed by NonbondedForceEvaluator with a
+// Verlet list (verlet_skin > 0) are the same as those computed without one
+// (verlet_skin = 0), for which the candidate pairs are found anew every time
+// that the forces are computed.  A cloud of nodes is moved by a smooth velocity
+// field for several steps without redistributing the Lagrangian data, so that
+// the Verlet list is reused for some steps and rebuilt for others.
+
+namespace
+{
+// A linear congruential generator, used so that the node positions do not
+// depend on the standard library implementation.
+class NodeGenerator
+{
+public:
+    explicit NodeGenerator(const unsigned long long seed) : d_state(seed)
+    {
+    }
+
+    double next()
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(d_state >> 11) / 9007199254740992.0;
+    }
+
+private:
+    unsigned long long d_state;
+};
+
+// Initializes a cloud of randomly placed nodes on the coarsest level of the
+// patch hierarchy.  The nodes are placed in the middle 80% of the domain in each
+// direction.
+class PointCloudInitializer : public LInitStrategy
+{
+public:
+    PointCloudInitializer(const int num_nodes, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
+        : d_grid_geom(grid_geom), d_X(num_nodes)
+    {
+        const double* const x_lower = grid_geom->getXLower();
+        const double* const x_upper = grid_geom->getXUpper();
+        NodeGenerator generator(1);
+        for (auto& X : d_X)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X[d] = x_lower[d] + (0.1 + 0.8 * generator.next()) * (x_upper[d] - x_lower[d]);
+            }
+        }
+        return;
+    }
+
+    bool getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const override
+    {
+        return level_number == 0;
+    }
+
+    unsigned int computeGlobalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                    const int /*level_number*/,
+                                                    const double /*init_data_time*/,
+                                                    const bool /*can_be_refined*/,
+                                                    const bool /*initial_time*/) override
+    {
+        return static_cast<unsigned int>(d_X.size());
+    }
+
+    unsigned int computeLocalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number,
+                                                   const double /*init_data_time*/,
+                                                   const bool /*can_be_refined*/,
+                                                   const bool /*initial_time*/) override
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        unsigned int local_node_count = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            local_node_count += getPatchNodes(level, level->getPatch(p())->getBox()).size();
+        }
+        return local_node_count;
+    }
+
+    unsigned int initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                            const unsigned int global_index_offset,
+                                            const unsigned int local_index_offset,
+                                            Pointer<LData> X_data,
+                                            Pointer<LData> U_data,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int level_number,
+                                            const double /*init_data_time*/,
+                                            const bool /*can_be_refined*/,
+                                            const bool /*initial_time*/,
+                                            LDataManager* const /*l_data_manager*/) override
+    {
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        int local_idx = -1;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
+            for (const int lag_idx : getPatchNodes(level, patch->getBox()))
+            {
+                const int local_petsc_idx = ++local_idx + local_index_offset;
+                const int global_petsc_idx = local_petsc_idx + global_index_offset;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_array[local_petsc_idx][d] = d_X[lag_idx][d];
+                    U_array[local_petsc_idx][d] = 0.0;
+                }
+                const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(d_X[lag_idx], d_grid_geom, level->getRatio());
+                if (!index_data->isElement(idx))
+                {
+                    index_data->appendItemPointer(idx, new LNodeSet());
+                }
+                index_data->getItem(idx)->push_back(new LNode(lag_idx, global_petsc_idx, local_petsc_idx));
+            }
+        }
+        X_data->restoreArrays();
+        U_data->restoreArrays();
+        return local_idx + 1;
+    }
+
+private:
+    std::vector<int> getPatchNodes(Pointer<PatchLevel<NDIM> > level, const Box<NDIM>& patch_box) const
+    {
+        std::vector<int> patch_nodes;
+        for (int lag_idx = 0; lag_idx < static_cast<int>(d_X.size()); ++lag_idx)
+        {
+            const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(d_X[lag_idx], d_grid_geom, level->getRatio());
+            if (patch_box.contains(idx)) patch_nodes.push_back(lag_idx);
+        }
+        return patch_nodes;
+    }
+
+    Pointer<CartesianGridGeometry<NDIM> > d_grid_geom;
+    std::vector<Point> d_X;
+};
+
+// Forwards the gridding algorithm callbacks to the LDataManager, in the same
+// way as IBMethod.
+class LDataManagerTagStrategy : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    explicit LDataManagerTagStrategy(LDataManager* const l_data_manager) : d_l_data_manager(l_data_manager)
+    {
+    }
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             const int level_number,
+                             const double init_data_time,
+                             const bool can_be_refined,
+                             const bool initial_time,
+                             Pointer<BasePatchLevel<NDIM> > old_level,
+                             const bool allocate_data) override
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->initializeLevelData(
+            hierarchy, level_number, init_data_time, can_be_refined, initial_time, old_level, allocate_data);
+        return;
+    }
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                                     const int coarsest_level,
+                                     const int finest_level) override
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+        return;
+    }
+
+private:
+    LDataManager* const d_l_data_manager;
+};
+
+// A soft repulsive force that vanishes for separations larger than the cutoff
+// distance params[1], with stiffness params[0].
+void
+soft_repulsion(double* D, const Array<double> params, double* out_force)
+{
+    const double kappa = params[0];
+    const double r_c = params[1];
+    double r_sq = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d) r_sq += D[d] * D[d];
+    const double r = std::sqrt(r_sq);
+    const double mag = (r > 0.0 && r < r_c) ? kappa * (1.0 - r / r_c) * (1.0 - r / r_c) / r : 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d) out_force[d] = mag * D[d];
+    return;
+} // soft_repulsion
+
+// A divergence-free velocity field that moves the nodes within the domain.
+void
+velocity(const double* const X, double* const U)
+{
+    U[0] = std::sin(M_PI * X[0]) * std::cos(M_PI * X[1]);
+    U[1] = -std::cos(M_PI * X[0]) * std::sin(M_PI * X[1]);
+    for (unsigned int d = 2; d < NDIM; ++d) U[d] = 0.0;
+    return;
+} // velocity
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * The forces are computed at the initial node positions and after each of    *
+ * the NUM_STEPS steps.  Upon return, entry s of force_rel_diff holds the      *
+ * largest difference between the forces computed with and without the Verlet *
+ * list at step s, relative to the largest force magnitude, entry s of         *
+ * force_norm holds the largest force magnitude, and num_builds holds the      *
+ * largest number of times that any process has built the Verlet list for     *
+ * verlet_skin = 0 and verlet_skin > 0.                                        *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            std::vector<double>& force_rel_diff,
+            std::vector<double>& force_norm,
+            std::array<int, 2>& num_builds)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_nodes = input_db->getInteger("NUM_NODES");
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        const double dt = input_db->getDouble("DT");
+        const double verlet_skin = input_db->getDouble("VERLET_SKIN");
+        force_rel_diff.resize(num_steps + 1);
+        force_norm.resize(num_steps + 1);
+
+        // Create the nonbonded force evaluators without and with a Verlet list.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<Database> force_db = app_initializer->getComponentDatabase("NonbondedForceEvaluator");
+        std::array<Pointer<NonbondedForceEvaluator>, 2> force_evaluators;
+        for (int k = 0; k < 2; ++k)
+        {
+            force_db->putDouble("verlet_skin", k == 0 ? 0.0 : verlet_skin);
+            force_evaluators[k] = new NonbondedForceEvaluator(force_db, grid_geometry);
+            force_evaluators[k]->registerForceFcnPtr(&soft_repulsion);
+        }
+
+        // Create the Lagrangian data manager and a single-level patch
+        // hierarchy.  The ghost cell width must cover the largest search
+        // distance of the force evaluators.
+        const double interaction_radius = force_db->getDouble("interaction_radius");
+        const double regrid_alpha = force_db->getDouble("regrid_alpha");
+        const int ghost_width = static_cast<int>(std::ceil(interaction_radius + 2.0 * regrid_alpha + verlet_skin));
+        const IntVector<NDIM> ghosts(ghost_width);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        LDataManager* const l_data_manager = LDataManager::getManager(
+            "LDataManager", "IB_4", "IB_4", /*error_if_points_leave_domain*/ true, ghosts, false);
+        Pointer<PointCloudInitializer> l_initializer = new PointCloudInitializer(num_nodes, grid_geometry);
+        l_data_manager->registerLInitStrategy(l_initializer);
+        LDataManagerTagStrategy tag_strategy(l_data_manager);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               &tag_strategy,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        l_data_manager->beginDataRedistribution();
+        l_data_manager->endDataRedistribution();
+
+        // Compute the forces and move the nodes.
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, 0);
+        std::array<Pointer<LData>, 2> F_data;
+        for (int k = 0; k < 2; ++k) F_data[k] = l_data_manager->createLData("F_" + std::to_string(k), 0, NDIM);
+        const std::vector<LNode*>& local_nodes = l_data_manager->getLMesh(0)->getLocalNodes();
+        for (int s = 0; s <= num_steps; ++s)
+        {
+            for (int k = 0; k < 2; ++k)
+            {
+                VecSet(F_data[k]->getVec(), 0.0);
+                force_evaluators[k]->computeLagrangianForce(
+                    F_data[k], X_data, U_data, patch_hierarchy, 0, s * dt, l_data_manager);
+            }
+
+            double max_diff = 0.0, max_abs = 0.0;
+            const boost::multi_array_ref<double, 2>& F_array = *F_data[0]->getLocalFormVecArray();
+            const boost::multi_array_ref<double, 2>& F_verlet_array = *F_data[1]->getLocalFormVecArray();
+            for (const auto& node : local_nodes)
+            {
+                const int local_idx = node->getLocalPETScIndex();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    max_diff = std::max(max_diff, std::abs(F_verlet_array[local_idx][d] - F_array[local_idx][d]));
+                    max_abs = std::max(max_abs, std::abs(F_array[local_idx][d]));
+                }
+            }
+            F_data[0]->restoreArrays();
+            F_data[1]->restoreArrays();
+            max_diff = SAMRAI_MPI::maxReduction(max_diff);
+            force_norm[s] = SAMRAI_MPI::maxReduction(max_abs);
+            force_rel_diff[s] = max_diff / std::max(force_norm[s], 1.0e-12);
+            pout << "step " << s << ": largest force = " << force_norm[s]
+                 << ", relative difference = " << force_rel_diff[s] << "\n";
+
+            // Move the nodes with the prescribed velocity without
+            // redistributing the Lagrangian data.
+            if (s < num_steps)
+            {
+                boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+                for (const auto& node : local_nodes)
+                {
+                    const int local_idx = node->getLocalPETScIndex();
+                    double U[NDIM];
+                    velocity(&X_array[local_idx][0], U);
+                    for (unsigned int d = 0; d < NDIM; ++d) X_array[local_idx][d] += dt * U[d];
+                }
+                X_data->restoreArrays();
+            }
+        }
+        for (int k = 0; k < 2; ++k)
+        {
+            num_builds[k] = SAMRAI_MPI::maxReduction(force_evaluators[k]->getNumberOfVerletListBuilds());
+            pout << "verlet_skin = " << (k == 0 ? 0.0 : verlet_skin) << ": Verlet list built " << num_builds[k]
+                 << " time(s)\n";
+        }
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <array>
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+static const double MAX_FORCE_DIFF = 1.0e-12;
+std::vector<double> force_rel_diff, force_norm;
+std::array<int, 2> num_builds;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME NonbondedForceEvaluator_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME NonbondedForceEvaluator_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+// The nodes are close enough together that the forces do not vanish.
+TEST(TEST_CASE_NAME, forces_are_nonzero)
+{
+    ASSERT_FALSE(force_norm.empty());
+    for (int s = 0; s < static_cast<int>(force_norm.size()); ++s)
+    {
+        SCOPED_TRACE("step " + std::to_string(s));
+        EXPECT_GT(force_norm[s], 0.0);
+    }
+}
+
+TEST(TEST_CASE_NAME, verlet_list_forces_match_unlisted_forces)
+{
+    ASSERT_FALSE(force_rel_diff.empty());
+    for (int s = 0; s < static_cast<int>(force_rel_diff.size()); ++s)
+    {
+        SCOPED_TRACE("step " + std::to_string(s));
+        EXPECT_LE(force_rel_diff[s], MAX_FORCE_DIFF);
+    }
+}
+
+// Without a skin, the list of pairs is rebuilt every time that the forces are
+// computed.  With a skin, it is rebuilt only after the nodes have moved far
+// enough, which happens at least once over the steps.
+TEST(TEST_CASE_NAME, verlet_list_rebuilt_only_when_nodes_move_far_enough)
+{
+    const int num_evals = static_cast<int>(force_rel_diff.size());
+    EXPECT_EQ(num_builds[0], num_evals);
+    EXPECT_GE(num_builds[1], 2);
+    EXPECT_LT(num_builds[1], num_evals);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc, ex_argv, force_rel_diff, force_norm, num_builds);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,388 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAIVectorReal.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PETScSAMRAIVectorReal.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test checks that the multi-vector operations of PETScSAMRAIVectorReal
+// (VecMDot, VecMTDot, VecMAXPY, and VecDotNorm2), which make a single sweep over
+// the patch data when all of the vectors have the same layout, give the same
+// results as the corresponding sequences of single-vector operations.  The
+// vectors are defined on a two-level locally refined grid, and the test covers:
+//
+//   - vectors with a cell-centered component with depth 2;
+//   - vectors with a side-centered component;
+//   - vectors with both components and control volume weights;
+//   - vectors whose components use different variables with different ghost
+//     cell widths, for which the operations must fall back to the per-vector
+//     implementations.  VecMAXPY includes the ghost cells, so it gives wrong
+//     results if such vectors are not detected.
+
+namespace
+{
+static const int NUM_VECS = 3;
+
+// A linear congruential generator, used so that the vector values do not depend
+// on the standard library implementation.
+class ValueGenerator
+{
+public:
+    explicit ValueGenerator(const unsigned long long seed) : d_state(seed)
+    {
+    }
+
+    double next()
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(d_state >> 11) / 9007199254740992.0;
+    }
+
+private:
+    unsigned long long d_state;
+};
+
+// The layout of the vectors used in one case of the test.
+struct VectorLayout
+{
+    std::string name;
+    bool use_cell_component;
+    bool use_side_component;
+    bool use_cvol;
+    bool use_mismatched_variable;
+};
+
+// Return the array data of the specified patch data, which must be cell- or
+// side-centered.
+std::vector<ArrayData<NDIM, double>*>
+get_array_data(Pointer<PatchData<NDIM> > data)
+{
+    std::vector<ArrayData<NDIM, double>*> array_data;
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    if (cc_data) array_data.push_back(&cc_data->getArrayData());
+    if (sc_data)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis) array_data.push_back(&sc_data->getArrayData(axis));
+    }
+    return array_data;
+} // get_array_data
+
+// Set the values of the specified patch data on all levels, including ghost
+// values, to values in [lower, lower + 1).
+void
+fill_data(Pointer<PatchHierarchy<NDIM> > hierarchy, const int idx, const double lower, ValueGenerator& generator)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            for (ArrayData<NDIM, double>* array_data : get_array_data(level->getPatch(p())->getPatchData(idx)))
+            {
+                double* const vals = array_data->getPointer();
+                const int num_vals = array_data->getDepth() * array_data->getBox().size();
+                for (int i = 0; i < num_vals; ++i) vals[i] = lower + generator.next();
+            }
+        }
+    }
+    return;
+} // fill_data
+
+// Return the largest difference between the values of two vectors, including
+// ghost values, relative to the largest magnitude of the reference values.
+double
+vector_rel_diff(Pointer<SAMRAIVectorReal<NDIM, double> > vec, Pointer<SAMRAIVectorReal<NDIM, double> > ref_vec)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = vec->getPatchHierarchy();
+    double max_diff = 0.0, max_abs = 0.0;
+    for (int comp = 0; comp < vec->getNumberOfComponents(); ++comp)
+    {
+        for (int ln = vec->getCoarsestLevelNumber(); ln <= vec->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const std::vector<ArrayData<NDIM, double>*> array_data =
+                    get_array_data(patch->getPatchData(vec->getComponentDescriptorIndex(comp)));
+                const std::vector<ArrayData<NDIM, double>*> ref_array_data =
+                    get_array_data(patch->getPatchData(ref_vec->getComponentDescriptorIndex(comp)));
+                for (unsigned int k = 0; k < array_data.size(); ++k)
+                {
+                    const double* const vals = array_data[k]->getPointer();
+                    const double* const ref_vals = ref_array_data[k]->getPointer();
+                    const int num_vals = array_data[k]->getDepth() * array_data[k]->getBox().size();
+                    for (int i = 0; i < num_vals; ++i)
+                    {
+                        max_diff = std::max(max_diff, std::abs(vals[i] - ref_vals[i]));
+                        max_abs = std::max(max_abs, std::abs(ref_vals[i]));
+                    }
+                }
+            }
+        }
+    }
+    max_diff = SAMRAI_MPI::maxReduction(max_diff);
+    max_abs = SAMRAI_MPI::maxReduction(max_abs);
+    return max_diff / std::max(max_abs, 1.0);
+} // vector_rel_diff
+
+// Return the largest difference between the entries of two arrays, relative to
+// the largest magnitude of the reference values.
+double
+array_rel_diff(const std::vector<PetscScalar>& vals, const std::vector<PetscScalar>& ref_vals)
+{
+    double max_diff = 0.0, max_abs = 0.0;
+    for (unsigned int k = 0; k < vals.size(); ++k)
+    {
+        max_diff = std::max(max_diff, std::abs(vals[k] - ref_vals[k]));
+        max_abs = std::max(max_abs, std::abs(ref_vals[k]));
+    }
+    return max_diff / std::max(max_abs, 1.0);
+} // array_rel_diff
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, entry c of mdot_rel_diff, mtdot_rel_diff, dotnorm2_rel_diff,   *
+ * and maxpy_rel_diff holds the largest difference between the results of      *
+ * VecMDot, VecMTDot, VecDotNorm2, and VecMAXPY, respectively, and those of    *
+ * the corresponding sequences of VecDot and VecAXPY for vector layout c,      *
+ * relative to the largest magnitude of the latter.  Entry c of dot_norm holds *
+ * the largest magnitude of the dot products computed for layout c.            *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            int& num_levels,
+            std::vector<double>& mdot_rel_diff,
+            std::vector<double>& mtdot_rel_diff,
+            std::vector<double>& dotnorm2_rel_diff,
+            std::vector<double>& maxpy_rel_diff,
+            std::vector<double>& dot_norm)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "PETScSAMRAIVectorReal.log");
+
+        // Create a locally refined patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        num_levels = finest_ln + 1;
+
+        // Create the data.  Index 0 holds the data of x, indices 1, ...,
+        // NUM_VECS hold the data of the y[k], and the last two indices hold the
+        // results of VecMAXPY and of the sequence of VecAXPY.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > q_var = new CellVariable<NDIM, double>("q", 2);
+        Pointer<CellVariable<NDIM, double> > q_alt_var = new CellVariable<NDIM, double>("q_alt", 2);
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > cc_wgt_var = new CellVariable<NDIM, double>("cc_wgt");
+        Pointer<SideVariable<NDIM, double> > sc_wgt_var = new SideVariable<NDIM, double>("sc_wgt");
+        const int num_data = NUM_VECS + 3;
+        std::vector<int> q_idxs(num_data), u_idxs(num_data);
+        for (int k = 0; k < num_data; ++k)
+        {
+            Pointer<VariableContext> ctx = var_db->getContext("context_" + std::to_string(k));
+            q_idxs[k] = var_db->registerVariableAndContext(q_var, ctx, IntVector<NDIM>(1));
+            u_idxs[k] = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        }
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const int q_alt_idx = var_db->registerVariableAndContext(q_alt_var, ctx, IntVector<NDIM>(2));
+        const int cc_wgt_idx = var_db->registerVariableAndContext(cc_wgt_var, ctx, IntVector<NDIM>(0));
+        const int sc_wgt_idx = var_db->registerVariableAndContext(sc_wgt_var, ctx, IntVector<NDIM>(0));
+        ValueGenerator generator(1);
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (int k = 0; k < num_data; ++k)
+            {
+                level->allocatePatchData(q_idxs[k], 0.0);
+                level->allocatePatchData(u_idxs[k], 0.0);
+            }
+            level->allocatePatchData(q_alt_idx, 0.0);
+            level->allocatePatchData(cc_wgt_idx, 0.0);
+            level->allocatePatchData(sc_wgt_idx, 0.0);
+        }
+        for (int k = 0; k <= NUM_VECS; ++k)
+        {
+            fill_data(patch_hierarchy, q_idxs[k], 0.5, generator);
+            fill_data(patch_hierarchy, u_idxs[k], 0.5, generator);
+        }
+        fill_data(patch_hierarchy, q_alt_idx, 0.5, generator);
+        fill_data(patch_hierarchy, cc_wgt_idx, 0.5, generator);
+        fill_data(patch_hierarchy, sc_wgt_idx, 0.5, generator);
+
+        // Compare the multi-vector operations to sequences of single-vector
+        // operations for each vector layout.
+        const std::vector<VectorLayout> layouts = { { "cell", true, false, false, false },
+                                                    { "side", false, true, false, false },
+                                                    { "weighted cell and side", true, true, true, false },
+                                                    { "mismatched cell", true, false, false, true } };
+        const int num_layouts = static_cast<int>(layouts.size());
+        mdot_rel_diff.resize(num_layouts);
+        mtdot_rel_diff.resize(num_layouts);
+        dotnorm2_rel_diff.resize(num_layouts);
+        maxpy_rel_diff.resize(num_layouts);
+        dot_norm.resize(num_layouts);
+        const PetscScalar alpha[NUM_VECS] = { 0.5, -1.0, 2.0 };
+        for (int c = 0; c < num_layouts; ++c)
+        {
+            const VectorLayout& layout = layouts[c];
+            std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > samrai_vecs(num_data);
+            std::vector<Vec> petsc_vecs(num_data);
+            for (int k = 0; k < num_data; ++k)
+            {
+                samrai_vecs[k] =
+                    new SAMRAIVectorReal<NDIM, double>("vec_" + std::to_string(k), patch_hierarchy, 0, finest_ln);
+                if (layout.use_cell_component)
+                {
+                    // The second of the y[k] uses a different variable with a
+                    // wider ghost cell width in the mismatched layout.
+                    if (layout.use_mismatched_variable && k == 2)
+                    {
+                        samrai_vecs[k]->addComponent(q_alt_var, q_alt_idx, layout.use_cvol ? cc_wgt_idx : -1);
+                    }
+                    else
+                    {
+                        samrai_vecs[k]->addComponent(q_var, q_idxs[k], layout.use_cvol ? cc_wgt_idx : -1);
+                    }
+                }
+                if (layout.use_side_component)
+                {
+                    samrai_vecs[k]->addComponent(u_var, u_idxs[k], layout.use_cvol ? sc_wgt_idx : -1);
+                }
+                petsc_vecs[k] = PETScSAMRAIVectorReal::createPETScVector(samrai_vecs[k], PETSC_COMM_WORLD);
+            }
+            Vec x = petsc_vecs[0];
+            Vec* y = &petsc_vecs[1];
+            Vec maxpy_result = petsc_vecs[NUM_VECS + 1];
+            Vec axpy_result = petsc_vecs[NUM_VECS + 2];
+
+            std::vector<PetscScalar> vals(NUM_VECS), ref_vals(NUM_VECS);
+            for (int k = 0; k < NUM_VECS; ++k) VecDot(x, y[k], &ref_vals[k]);
+            VecMDot(x, NUM_VECS, y, vals.data());
+            mdot_rel_diff[c] = array_rel_diff(vals, ref_vals);
+            VecMTDot(x, NUM_VECS, y, vals.data());
+            mtdot_rel_diff[c] = array_rel_diff(vals, ref_vals);
+            dot_norm[c] = 0.0;
+            for (int k = 0; k < NUM_VECS; ++k) dot_norm[c] = std::max(dot_norm[c], std::abs(ref_vals[k]));
+
+            std::vector<PetscScalar> dotnorm2_vals(2), dotnorm2_ref_vals(2);
+            VecDot(y[0], y[1], &dotnorm2_ref_vals[0]);
+            VecDot(y[1], y[1], &dotnorm2_ref_vals[1]);
+            PetscReal nm;
+            VecDotNorm2(y[0], y[1], &dotnorm2_vals[0], &nm);
+            dotnorm2_vals[1] = nm;
+            dotnorm2_rel_diff[c] = array_rel_diff(dotnorm2_vals, dotnorm2_ref_vals);
+
+            // VecCopy and VecAXPY also update the ghost values.
+            VecCopy(x, maxpy_result);
+            VecCopy(x, axpy_result);
+            VecMAXPY(maxpy_result, NUM_VECS, alpha, y);
+            for (int k = 0; k < NUM_VECS; ++k) VecAXPY(axpy_result, alpha[k], y[k]);
+            maxpy_rel_diff[c] = vector_rel_diff(samrai_vecs[NUM_VECS + 1], samrai_vecs[NUM_VECS + 2]);
+
+            pout << layout.name << ": VecMDot difference = " << mdot_rel_diff[c]
+                 << ", VecMTDot difference = " << mtdot_rel_diff[c]
+                 << ", VecDotNorm2 difference = " << dotnorm2_rel_diff[c]
+                 << ", VecMAXPY difference = " << maxpy_rel_diff[c] << "\n";
+
+            for (int k = 0; k < num_data; ++k) PETScSAMRAIVectorReal::destroyPETScVector(petsc_vecs[k]);
+        }
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
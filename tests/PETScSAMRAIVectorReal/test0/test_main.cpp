@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+int num_levels;
+std::vector<double> mdot_rel_diff, mtdot_rel_diff, dotnorm2_rel_diff, maxpy_rel_diff, dot_norm;
+
+// The multi-vector and single-vector operations accumulate the same products in
+// a different order, so that the results agree only up to round-off.
+static const double MAX_REL_DIFF = 1.0e-12;
+
+// The vector layouts, in the order used by run_example().
+static const char* const LAYOUT_NAMES[] = { "cell", "side", "weighted cell and side", "mismatched cell" };
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME PETScSAMRAIVectorReal_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME PETScSAMRAIVectorReal_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, hierarchy_has_two_levels)
+{
+    EXPECT_EQ(num_levels, 2);
+}
+
+TEST(TEST_CASE_NAME, dot_products_are_nonzero)
+{
+    ASSERT_EQ(dot_norm.size(), 4u);
+    for (unsigned int c = 0; c < dot_norm.size(); ++c)
+    {
+        SCOPED_TRACE(LAYOUT_NAMES[c]);
+        EXPECT_GT(dot_norm[c], 1.0);
+    }
+}
+
+TEST(TEST_CASE_NAME, mdot_matches_dot)
+{
+    ASSERT_EQ(mdot_rel_diff.size(), 4u);
+    for (unsigned int c = 0; c < mdot_rel_diff.size(); ++c)
+    {
+        SCOPED_TRACE(LAYOUT_NAMES[c]);
+        EXPECT_LE(mdot_rel_diff[c], MAX_REL_DIFF);
+        EXPECT_LE(mtdot_rel_diff[c], MAX_REL_DIFF);
+    }
+}
+
+TEST(TEST_CASE_NAME, dotnorm2_matches_dot)
+{
+    ASSERT_EQ(dotnorm2_rel_diff.size(), 4u);
+    for (unsigned int c = 0; c < dotnorm2_rel_diff.size(); ++c)
+    {
+        SCOPED_TRACE(LAYOUT_NAMES[c]);
+        EXPECT_LE(dotnorm2_rel_diff[c], MAX_REL_DIFF);
+    }
+}
+
+// VecMAXPY updates the ghost values, which are also compared.  In the
+// mismatched layout, the data of the vectors have different ghost cell widths,
+// so this only passes if the per-vector fallback is used.
+TEST(TEST_CASE_NAME, maxpy_matches_axpy)
+{
+    ASSERT_EQ(maxpy_rel_diff.size(), 4u);
+    for (unsigned int c = 0; c < maxpy_rel_diff.size(); ++c)
+    {
+        SCOPED_TRACE(LAYOUT_NAMES[c]);
+        EXPECT_LE(maxpy_rel_diff[c], MAX_REL_DIFF);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(
+        ex_argc, ex_argv, num_levels, mdot_rel_diff, mtdot_rel_diff, dotnorm2_rel_diff, maxpy_rel_diff, dot_norm);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,305 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/ParallelMap.h>
+#include <ibtk/Streamable.h>
+#include <ibtk/StreamableFactory.h>
+#include <ibtk/StreamableManager.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test adds items to and removes items from replicated and
+// owner-partitioned ParallelMap objects, with each item registered by a
+// process other than the one that owns its key, and checks the contents of the
+// maps after each call to communicateData().  The number of items and the sum
+// of their keys do not depend on the number of processes.  The time required to
+// communicate the data with each distribution strategy is written to pout.
+
+namespace
+{
+// A simple Streamable object that stores a value and a payload of fixed size.
+class TestItem : public Streamable
+{
+public:
+    static int STREAMABLE_CLASS_ID;
+
+    TestItem(const double value, const int payload_size) : d_value(value), d_payload(payload_size, value)
+    {
+    }
+
+    double getValue() const
+    {
+        return d_value;
+    }
+
+    int getStreamableClassID() const override
+    {
+        return STREAMABLE_CLASS_ID;
+    }
+
+    size_t getDataStreamSize() const override
+    {
+        return AbstractStream::sizeofInt() + AbstractStream::sizeofDouble() * (1 + d_payload.size());
+    }
+
+    void packStream(AbstractStream& stream) override
+    {
+        const int payload_size = static_cast<int>(d_payload.size());
+        stream.pack(&payload_size, 1);
+        stream.pack(&d_value, 1);
+        if (payload_size > 0) stream.pack(d_payload.data(), payload_size);
+        return;
+    }
+
+private:
+    double d_value;
+    std::vector<double> d_payload;
+};
+
+int TestItem::STREAMABLE_CLASS_ID = StreamableManager::getUnregisteredID();
+
+class TestItemFactory : public StreamableFactory
+{
+public:
+    int getStreamableClassID() const override
+    {
+        return TestItem::STREAMABLE_CLASS_ID;
+    }
+
+    void setStreamableClassID(const int class_id) override
+    {
+        TestItem::STREAMABLE_CLASS_ID = class_id;
+        return;
+    }
+
+    Pointer<Streamable> unpackStream(AbstractStream& stream, const IntVector<NDIM>& /*offset*/) override
+    {
+        int payload_size;
+        stream.unpack(&payload_size, 1);
+        double value;
+        stream.unpack(&value, 1);
+        std::vector<double> payload(payload_size);
+        if (payload_size > 0) stream.unpack(payload.data(), payload_size);
+        return new TestItem(value, payload_size);
+    }
+};
+
+static const int NUM_TYPES = 2;
+static const ParallelMap::DistributionType distribution_types[NUM_TYPES] = { ParallelMap::REPLICATED,
+                                                                              ParallelMap::OWNER_PARTITIONED };
+static const std::string distribution_type_names[NUM_TYPES] = { "REPLICATED", "OWNER_PARTITIONED" };
+
+// The ranks of the processes that add and remove each key.  Keys that are
+// divisible by 5 are added by a second process when there is more than one
+// process, and keys that are divisible by 3 are removed.
+int
+first_adding_rank(const int key)
+{
+    return (7 * key) % SAMRAI_MPI::getNodes();
+} // first_adding_rank
+
+int
+second_adding_rank(const int key)
+{
+    return (7 * key + 1) % SAMRAI_MPI::getNodes();
+} // second_adding_rank
+
+int
+removing_rank(const int key)
+{
+    return (11 * key) % SAMRAI_MPI::getNodes();
+} // removing_rank
+
+double
+item_value(const int key, const int rank)
+{
+    return key + 0.5 * rank;
+} // item_value
+
+void
+add_items(ParallelMap& map, const int num_keys, const int payload_size)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    for (int key = 0; key < num_keys; ++key)
+    {
+        if (first_adding_rank(key) == rank)
+        {
+            map.addItem(key, new TestItem(item_value(key, rank), payload_size));
+        }
+        if (key % 5 == 0 && SAMRAI_MPI::getNodes() > 1 && second_adding_rank(key) == rank)
+        {
+            map.addItem(key, new TestItem(item_value(key, rank), payload_size));
+        }
+    }
+    return;
+} // add_items
+
+void
+remove_items(ParallelMap& map, const int num_keys)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    for (int key = 0; key < num_keys; ++key)
+    {
+        if (key % 3 == 0 && removing_rank(key) == rank) map.removeItem(key);
+    }
+    return;
+} // remove_items
+
+// The contents of a map after a call to communicateData(): the total number of
+// items, the sum of their keys, and the number of processes on which the map
+// does not contain exactly the expected items.
+struct MapContents
+{
+    int num_items = 0;
+    int key_sum = 0;
+    int num_failures = 0;
+};
+
+MapContents
+check_map(const ParallelMap& map,
+          const ParallelMap::DistributionType distribution_type,
+          const int num_keys,
+          const bool removed)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    std::map<int, double> expected;
+    for (int key = 0; key < num_keys; ++key)
+    {
+        if (removed && key % 3 == 0) continue;
+        if (distribution_type == ParallelMap::OWNER_PARTITIONED && ParallelMap::getOwnerRank(key) != rank) continue;
+        int adding_rank = first_adding_rank(key);
+        if (key % 5 == 0 && SAMRAI_MPI::getNodes() > 1) adding_rank = std::max(adding_rank, second_adding_rank(key));
+        expected[key] = item_value(key, adding_rank);
+    }
+    bool passed = map.getMap().size() == expected.size();
+    MapContents contents;
+    for (const auto& item : map.getMap())
+    {
+        const Pointer<TestItem> test_item = item.second;
+        passed = passed && !test_item.isNull() && expected.count(item.first) &&
+                 test_item->getValue() == expected[item.first];
+        contents.num_items += 1;
+        contents.key_sum += item.first;
+    }
+
+    // Each process stores every item of a replicated map, so only the items
+    // stored on the root process are counted.
+    if (distribution_type == ParallelMap::REPLICATED)
+    {
+        contents.num_items = SAMRAI_MPI::bcast(contents.num_items, 0);
+        contents.key_sum = SAMRAI_MPI::bcast(contents.key_sum, 0);
+    }
+    else
+    {
+        contents.num_items = SAMRAI_MPI::sumReduction(contents.num_items);
+        contents.key_sum = SAMRAI_MPI::sumReduction(contents.key_sum);
+    }
+    contents.num_failures = SAMRAI_MPI::sumReduction(passed ? 0 : 1);
+    return contents;
+} // check_map
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, entry t of the output vectors holds the contents of the map    *
+ * with the tth distribution type (REPLICATED and OWNER_PARTITIONED) after the *
+ * items are added and after some of them are removed.                         *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc, char* argv[], std::vector<MapContents>& additions, std::vector<MapContents>& removals)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    additions.resize(NUM_TYPES);
+    removals.resize(NUM_TYPES);
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_keys = input_db->getIntegerWithDefault("NUM_KEYS", 1000);
+        const int payload_size = input_db->getIntegerWithDefault("PAYLOAD_SIZE", 0);
+        const int num_reps = input_db->getIntegerWithDefault("NUM_REPETITIONS", 1);
+        TestItem::STREAMABLE_CLASS_ID = StreamableManager::getManager()->registerFactory(new TestItemFactory());
+
+        for (int t = 0; t < NUM_TYPES; ++t)
+        {
+            ParallelMap map(distribution_types[t]);
+            add_items(map, num_keys, payload_size);
+            map.communicateData();
+            additions[t] = check_map(map, distribution_types[t], num_keys, false);
+            remove_items(map, num_keys);
+            map.communicateData();
+            removals[t] = check_map(map, distribution_types[t], num_keys, true);
+
+            // Time the communication of the additions.
+            double communication_time = 0.0;
+            for (int k = 0; k < num_reps; ++k)
+            {
+                ParallelMap timed_map(distribution_types[t]);
+                add_items(timed_map, num_keys, payload_size);
+                SAMRAI_MPI::barrier();
+                const double start_time = MPI_Wtime();
+                timed_map.communicateData();
+                communication_time += MPI_Wtime() - start_time;
+            }
+
+            pout << distribution_type_names[t] << "\n"
+                 << "  communicateData() time: " << SAMRAI_MPI::maxReduction(communication_time) << " s\n";
+        }
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
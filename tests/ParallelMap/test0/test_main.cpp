@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+std::vector<MapContents> additions, removals;
+int bench_num_items_added, bench_key_sum_added;
+int bench_num_items_removed, bench_key_sum_removed;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME ParallelMap_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME ParallelMap_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, additions)
+{
+    for (int t = 0; t < NUM_TYPES; ++t)
+    {
+        SCOPED_TRACE(distribution_type_names[t]);
+        EXPECT_EQ(additions[t].num_items, bench_num_items_added);
+        EXPECT_EQ(additions[t].key_sum, bench_key_sum_added);
+        EXPECT_EQ(additions[t].num_failures, 0);
+    }
+}
+
+TEST(TEST_CASE_NAME, removals)
+{
+    for (int t = 0; t < NUM_TYPES; ++t)
+    {
+        SCOPED_TRACE(distribution_type_names[t]);
+        EXPECT_EQ(removals[t].num_items, bench_num_items_removed);
+        EXPECT_EQ(removals[t].key_sum, bench_key_sum_removed);
+        EXPECT_EQ(removals[t].num_failures, 0);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    // With NUM_KEYS = 10000, every key in [0, 10000) is added, and then the
+    // keys that are divisible by 3 are removed.
+    bench_num_items_added = 10000;
+    bench_key_sum_added = 49995000;
+    bench_num_items_removed = 6666;
+    bench_key_sum_removed = 33326667;
+
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc, ex_argv, additions, removals);
+    return RUN_ALL_TESTS();
+}
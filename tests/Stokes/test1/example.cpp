@@ -0,0 +1,284 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <LocationIndexRobinBcCoefs.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/StaggeredStokesSolver.h>
+#include <ibamr/StaggeredStokesSolverManager.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LinearSolver.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// This test checks that the multicolor ordering used by the box relaxation
+// smoother of StaggeredStokesBoxRelaxationFACOperator does not increase the
+// number of FAC-preconditioned Krylov iterations needed to solve a
+// time-dependent Stokes problem on a locally refined grid.  The same problem is
+// solved twice, first with the sequential lexicographic ordering, which
+// reproduces the original box relaxation smoother, and then with the
+// multicolor ordering.
+
+namespace
+{
+// Set a smooth body force on the velocity degrees of freedom.
+void
+fill_velocity_rhs(Pointer<PatchHierarchy<NDIM> > hierarchy, const int f_idx)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+                {
+                    const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                    double f = 1.0;
+                    for (unsigned int k = 0; k < NDIM; ++k)
+                    {
+                        const double offset = k == axis ? 0.0 : 0.5;
+                        const double x = x_lower[k] + dx[k] * (i_s(k) - patch_box.lower(k) + offset);
+                        f *= std::sin(M_PI * (k + axis + 1) * x);
+                    }
+                    (*f_data)(i_s) = f;
+                }
+            }
+        }
+    }
+    return;
+} // fill_velocity_rhs
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, entry k of each output vector holds the number of Krylov       *
+ * iterations and the final residual norm relative to the norm of the right-   *
+ * hand side for the solve performed with the lexicographic (k = 0) and the    *
+ * multicolor (k = 1) box relaxation orderings.                                *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc, char* argv[], std::vector<int>& num_iterations, std::vector<double>& rel_residuals)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "Stokes.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double mu = input_db->getDouble("MU");
+        const double rho = input_db->getDouble("RHO");
+        const double dt = input_db->getDouble("DT");
+        num_iterations.resize(2);
+        rel_residuals.resize(2);
+
+        // Create a locally refined patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Create the solution and right-hand side data.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        Pointer<CellVariable<NDIM, double> > g_var = new CellVariable<NDIM, double>("g");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+        const int g_idx = var_db->registerVariableAndContext(g_var, ctx, IntVector<NDIM>(1));
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(f_idx, 0.0);
+            level->allocatePatchData(p_idx, 0.0);
+            level->allocatePatchData(g_idx, 0.0);
+        }
+
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, 0, finest_ln);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+
+        Pointer<SAMRAIVectorReal<NDIM, double> > x_vec =
+            new SAMRAIVectorReal<NDIM, double>("x", patch_hierarchy, 0, finest_ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > b_vec =
+            new SAMRAIVectorReal<NDIM, double>("b", patch_hierarchy, 0, finest_ln);
+        x_vec->addComponent(u_var, u_idx, wgt_sc_idx);
+        x_vec->addComponent(p_var, p_idx, wgt_cc_idx);
+        b_vec->addComponent(f_var, f_idx, wgt_sc_idx);
+        b_vec->addComponent(g_var, g_idx, wgt_cc_idx);
+        b_vec->setToScalar(0.0);
+        fill_velocity_rhs(patch_hierarchy, f_idx);
+        const double b_norm = b_vec->L2Norm();
+
+        // The pressure is determined only up to a constant.
+        Pointer<SAMRAIVectorReal<NDIM, double> > nul_vec = x_vec->cloneVector("nul_vec");
+        nul_vec->allocateVectorData(0.0);
+        hier_sc_data_ops.setToScalar(nul_vec->getComponentDescriptorIndex(0), 0.0);
+        hier_cc_data_ops.setToScalar(nul_vec->getComponentDescriptorIndex(1), 1.0);
+
+        // Use homogeneous Dirichlet boundary conditions for the velocity and
+        // homogeneous Neumann boundary conditions for the pressure.
+        LocationIndexRobinBcCoefs<NDIM> U_bc_coef("U_bc_coef", Pointer<Database>(NULL));
+        LocationIndexRobinBcCoefs<NDIM> P_bc_coef("P_bc_coef", Pointer<Database>(NULL));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_bc_coef.setBoundaryValue(2 * d, 0.0);
+            U_bc_coef.setBoundaryValue(2 * d + 1, 0.0);
+            P_bc_coef.setBoundarySlope(2 * d, 0.0);
+            P_bc_coef.setBoundarySlope(2 * d + 1, 0.0);
+        }
+        const std::vector<RobinBcCoefStrategy<NDIM>*> U_bc_coefs(NDIM, &U_bc_coef);
+        Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+        bc_helper->cacheBcCoefData(U_bc_coefs, dt, patch_hierarchy);
+
+        PoissonSpecifications U_problem_coefs("U_problem_coefs");
+        U_problem_coefs.setCConstant(rho / dt);
+        U_problem_coefs.setDConstant(-mu);
+
+        // Solve the Stokes system with each box relaxation ordering, starting
+        // from a zero initial guess.
+        Pointer<Database> solver_db = input_db->getDatabase("stokes_solver_db");
+        Pointer<Database> precond_db = input_db->getDatabase("stokes_precond_db");
+        for (int k = 0; k < 2; ++k)
+        {
+            const bool use_multicolor_ordering = k == 1;
+            precond_db->putBool("smoother_use_multicolor_ordering", use_multicolor_ordering);
+            const std::string suffix = use_multicolor_ordering ? "multicolor" : "lexicographic";
+            Pointer<StaggeredStokesSolver> stokes_solver = StaggeredStokesSolverManager::getManager()->allocateSolver(
+                StaggeredStokesSolverManager::PETSC_KRYLOV_SOLVER,
+                "stokes_solver_" + suffix,
+                solver_db,
+                "stokes_",
+                StaggeredStokesSolverManager::BOX_RELAXATION_FAC_PRECONDITIONER,
+                "stokes_precond_" + suffix,
+                precond_db,
+                "stokes_pc_");
+            stokes_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+            stokes_solver->setPhysicalBcCoefs(U_bc_coefs, &P_bc_coef);
+            stokes_solver->setPhysicalBoundaryHelper(bc_helper);
+            stokes_solver->setSolutionTime(dt);
+            stokes_solver->setTimeInterval(0.0, dt);
+            stokes_solver->setComponentsHaveNullspace(false, true);
+            Pointer<LinearSolver> p_stokes_linear_solver = stokes_solver;
+            p_stokes_linear_solver->setInitialGuessNonzero(false);
+            p_stokes_linear_solver->setNullspace(false,
+                                                 std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > >(1, nul_vec));
+            stokes_solver->initializeSolverState(*x_vec, *b_vec);
+            x_vec->setToScalar(0.0);
+            stokes_solver->solveSystem(*x_vec, *b_vec);
+            num_iterations[k] = stokes_solver->getNumIterations();
+            rel_residuals[k] = stokes_solver->getResidualNorm() / b_norm;
+            pout << "ordering = " << suffix << ", number of iterations = " << num_iterations[k]
+                 << ", relative residual norm = " << rel_residuals[k] << "\n";
+            stokes_solver->deallocateSolverState();
+        }
+
+        nul_vec->deallocateVectorData();
+        nul_vec->freeVectorComponents();
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
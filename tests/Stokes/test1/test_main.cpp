@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+std::vector<int> num_iterations;
+std::vector<double> rel_residuals;
+
+// The largest relative residual norm accepted after a solve, which is somewhat
+// larger than the relative residual tolerance used in input[23]d.test.
+static const double MAX_REL_RESIDUAL = 1.0e-7;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME Stokes_test1_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME Stokes_test1_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, both_orderings_converge)
+{
+    ASSERT_EQ(num_iterations.size(), 2u);
+    for (int k = 0; k < 2; ++k)
+    {
+        SCOPED_TRACE(k == 0 ? "lexicographic ordering" : "multicolor ordering");
+        EXPECT_GT(num_iterations[k], 0);
+        EXPECT_LE(rel_residuals[k], MAX_REL_RESIDUAL);
+    }
+}
+
+// The lexicographic ordering reproduces the original box relaxation smoother,
+// and the multicolor ordering may take at most about 10% more iterations.
+TEST(TEST_CASE_NAME, multicolor_iterations_do_not_regress)
+{
+    ASSERT_EQ(num_iterations.size(), 2u);
+    EXPECT_LE(num_iterations[1], static_cast<int>(1.1 * num_iterations[0]) + 1);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc, ex_argv, num_iterations, rel_residuals);
+    return RUN_ALL_TESTS();
+}
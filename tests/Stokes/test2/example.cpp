@@ -0,0 +1,360 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <LocationIndexRobinBcCoefs.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesOperator.h>
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CellNoCornersFillPattern.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/SideNoCornersFillPattern.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// This test checks that repeated applications of StaggeredStokesOperator reuse
+// the communication schedules cached by its HierarchyGhostCellInterpolation
+// object, and that fill patterns are identified by their types and parameters
+// rather than by their addresses.  The operator is applied to a sequence of
+// input vectors on a locally refined grid, and the test checks that:
+//
+//   - new schedules are created only the first time that an input vector is
+//     used;
+//   - newly allocated fill patterns with the same parameters as the fill
+//     patterns used by the operator reuse the cached schedules, and fill
+//     patterns with different parameters do not;
+//   - the results computed with cached schedules are the same as those computed
+//     by a newly initialized operator.
+
+namespace
+{
+// Provides access to the ghost cell filling object used by
+// StaggeredStokesOperator.
+class StaggeredStokesOperatorTester : public StaggeredStokesOperator
+{
+public:
+    explicit StaggeredStokesOperatorTester(const std::string& object_name)
+        : StaggeredStokesOperator(object_name, /*homogeneous_bc*/ false)
+    {
+    }
+
+    Pointer<HierarchyGhostCellInterpolation> getGhostFillOperator() const
+    {
+        return d_hier_bdry_fill;
+    }
+
+    const std::vector<HierarchyGhostCellInterpolation::InterpolationTransactionComponent>&
+    getTransactionComponents() const
+    {
+        return d_transaction_comps;
+    }
+};
+
+// Set smooth values for the velocity and pressure.
+void
+fill_data(Pointer<PatchHierarchy<NDIM> > hierarchy, const int u_idx, const int p_idx, const double shift)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+                {
+                    const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                    double u = 1.0;
+                    for (unsigned int k = 0; k < NDIM; ++k)
+                    {
+                        const double offset = k == axis ? 0.0 : 0.5;
+                        const double x = x_lower[k] + dx[k] * (i_s(k) - patch_box.lower(k) + offset);
+                        u *= std::sin(M_PI * (k + axis + 1) * x + shift);
+                    }
+                    (*u_data)(i_s) = u;
+                }
+            }
+            Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                double p = 0.0;
+                for (unsigned int k = 0; k < NDIM; ++k)
+                {
+                    const double x = x_lower[k] + dx[k] * (i(k) - patch_box.lower(k) + 0.5);
+                    p += std::cos(2.0 * M_PI * x + shift);
+                }
+                (*p_data)(i) = p;
+            }
+        }
+    }
+    return;
+} // fill_data
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * The operator is applied to the input vectors x0, x0, x1, x1, x0, in that    *
+ * order.  Upon return, init_misses holds the number of schedule cache misses  *
+ * after the operator is initialized, entry k of num_hits and num_misses holds *
+ * the numbers of schedule cache hits and misses during application k,         *
+ * equivalent_pattern_hits and equivalent_pattern_misses hold the numbers of   *
+ * hits and misses when the transaction components are reset with newly        *
+ * allocated fill patterns with the same parameters, different_pattern_hits    *
+ * and different_pattern_misses hold the numbers of hits and misses when the   *
+ * transaction components are reset with fill patterns with different          *
+ * parameters, and max_rel_diff holds the largest difference between the       *
+ * results of the last application and those of a newly initialized operator, *
+ * relative to the largest magnitude of the results.                           *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            int& init_misses,
+            std::vector<int>& num_hits,
+            std::vector<int>& num_misses,
+            int& equivalent_pattern_hits,
+            int& equivalent_pattern_misses,
+            int& different_pattern_hits,
+            int& different_pattern_misses,
+            double& max_rel_diff)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "Stokes.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double mu = input_db->getDouble("MU");
+        const double rho = input_db->getDouble("RHO");
+        const double dt = input_db->getDouble("DT");
+
+        // Create a locally refined patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Create two input vectors and two output vectors.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        std::vector<int> u_idxs(4), p_idxs(4);
+        for (int k = 0; k < 4; ++k)
+        {
+            Pointer<VariableContext> ctx = var_db->getContext("context_" + std::to_string(k));
+            u_idxs[k] = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+            p_idxs[k] = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+        }
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (int k = 0; k < 4; ++k)
+            {
+                level->allocatePatchData(u_idxs[k], 0.0);
+                level->allocatePatchData(p_idxs[k], 0.0);
+            }
+        }
+
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > vecs(4);
+        for (int k = 0; k < 4; ++k)
+        {
+            vecs[k] = new SAMRAIVectorReal<NDIM, double>("vec_" + std::to_string(k), patch_hierarchy, 0, finest_ln);
+            vecs[k]->addComponent(u_var, u_idxs[k], wgt_sc_idx);
+            vecs[k]->addComponent(p_var, p_idxs[k], wgt_cc_idx);
+        }
+        Pointer<SAMRAIVectorReal<NDIM, double> > x0_vec = vecs[0], x1_vec = vecs[1];
+        Pointer<SAMRAIVectorReal<NDIM, double> > y_vec = vecs[2], y_ref_vec = vecs[3];
+        fill_data(patch_hierarchy, u_idxs[0], p_idxs[0], 0.0);
+        fill_data(patch_hierarchy, u_idxs[1], p_idxs[1], 0.25);
+
+        // Setup the operator with homogeneous Dirichlet boundary conditions for
+        // the velocity and homogeneous Neumann boundary conditions for the
+        // pressure.
+        LocationIndexRobinBcCoefs<NDIM> U_bc_coef("U_bc_coef", Pointer<Database>(NULL));
+        LocationIndexRobinBcCoefs<NDIM> P_bc_coef("P_bc_coef", Pointer<Database>(NULL));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_bc_coef.setBoundaryValue(2 * d, 0.0);
+            U_bc_coef.setBoundaryValue(2 * d + 1, 0.0);
+            P_bc_coef.setBoundarySlope(2 * d, 0.0);
+            P_bc_coef.setBoundarySlope(2 * d + 1, 0.0);
+        }
+        const std::vector<RobinBcCoefStrategy<NDIM>*> U_bc_coefs(NDIM, &U_bc_coef);
+        Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+        bc_helper->cacheBcCoefData(U_bc_coefs, dt, patch_hierarchy);
+
+        PoissonSpecifications U_problem_coefs("U_problem_coefs");
+        U_problem_coefs.setCConstant(rho / dt);
+        U_problem_coefs.setDConstant(-mu);
+
+        std::vector<Pointer<StaggeredStokesOperatorTester> > stokes_ops(2);
+        for (int k = 0; k < 2; ++k)
+        {
+            stokes_ops[k] = new StaggeredStokesOperatorTester("stokes_op_" + std::to_string(k));
+            stokes_ops[k]->setVelocityPoissonSpecifications(U_problem_coefs);
+            stokes_ops[k]->setPhysicalBcCoefs(U_bc_coefs, &P_bc_coef);
+            stokes_ops[k]->setPhysicalBoundaryHelper(bc_helper);
+            stokes_ops[k]->setSolutionTime(dt);
+            stokes_ops[k]->setTimeInterval(0.0, dt);
+        }
+        Pointer<StaggeredStokesOperatorTester> stokes_op = stokes_ops[0];
+        stokes_op->initializeOperatorState(*x0_vec, *y_vec);
+        Pointer<HierarchyGhostCellInterpolation> ghost_fill_op = stokes_op->getGhostFillOperator();
+        init_misses = ghost_fill_op->getNumberOfScheduleCacheMisses();
+
+        // Apply the operator to a sequence of input vectors.
+        const std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > x_vecs = {
+            x0_vec, x0_vec, x1_vec, x1_vec, x0_vec
+        };
+        num_hits.resize(x_vecs.size());
+        num_misses.resize(x_vecs.size());
+        for (unsigned int k = 0; k < x_vecs.size(); ++k)
+        {
+            const int hits_before = ghost_fill_op->getNumberOfScheduleCacheHits();
+            const int misses_before = ghost_fill_op->getNumberOfScheduleCacheMisses();
+            stokes_op->apply(*x_vecs[k], *y_vec);
+            num_hits[k] = ghost_fill_op->getNumberOfScheduleCacheHits() - hits_before;
+            num_misses[k] = ghost_fill_op->getNumberOfScheduleCacheMisses() - misses_before;
+            pout << "application " << k << ": " << num_hits[k] << " schedule cache hit(s), " << num_misses[k]
+                 << " schedule cache miss(es)\n";
+        }
+
+        // Compare the last result with that of a newly initialized operator,
+        // which does not have any cached schedules.
+        stokes_ops[1]->initializeOperatorState(*x0_vec, *y_ref_vec);
+        stokes_ops[1]->apply(*x0_vec, *y_ref_vec);
+        const double max_abs = y_ref_vec->maxNorm();
+        y_ref_vec->subtract(y_ref_vec, y_vec);
+        max_rel_diff = y_ref_vec->maxNorm() / std::max(max_abs, 1.0);
+        stokes_ops[1]->deallocateOperatorState();
+
+        // Reset the transaction components with newly allocated fill patterns
+        // with the same parameters as those used by the operator, and then with
+        // fill patterns with different parameters.
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        const std::vector<InterpolationTransactionComponent> transaction_comps = stokes_op->getTransactionComponents();
+        std::vector<InterpolationTransactionComponent> equivalent_transaction_comps = transaction_comps;
+        equivalent_transaction_comps[0].d_fill_pattern = new SideNoCornersFillPattern(1, false, false, true);
+        equivalent_transaction_comps[1].d_fill_pattern = new CellNoCornersFillPattern(1, false, false, true);
+        std::vector<InterpolationTransactionComponent> different_transaction_comps = transaction_comps;
+        different_transaction_comps[0].d_fill_pattern = new SideNoCornersFillPattern(1, true, false, true);
+        different_transaction_comps[1].d_fill_pattern = new CellNoCornersFillPattern(1, true, false, true);
+
+        int hits_before = ghost_fill_op->getNumberOfScheduleCacheHits();
+        int misses_before = ghost_fill_op->getNumberOfScheduleCacheMisses();
+        ghost_fill_op->resetTransactionComponents(equivalent_transaction_comps);
+        equivalent_pattern_hits = ghost_fill_op->getNumberOfScheduleCacheHits() - hits_before;
+        equivalent_pattern_misses = ghost_fill_op->getNumberOfScheduleCacheMisses() - misses_before;
+
+        hits_before = ghost_fill_op->getNumberOfScheduleCacheHits();
+        misses_before = ghost_fill_op->getNumberOfScheduleCacheMisses();
+        ghost_fill_op->resetTransactionComponents(different_transaction_comps);
+        different_pattern_hits = ghost_fill_op->getNumberOfScheduleCacheHits() - hits_before;
+        different_pattern_misses = ghost_fill_op->getNumberOfScheduleCacheMisses() - misses_before;
+
+        ghost_fill_op->resetTransactionComponents(transaction_comps);
+        stokes_op->deallocateOperatorState();
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+int init_misses;
+std::vector<int> num_hits, num_misses;
+int equivalent_pattern_hits, equivalent_pattern_misses;
+int different_pattern_hits, different_pattern_misses;
+double max_rel_diff;
+static const double MAX_REL_DIFF = 1.0e-12;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME Stokes_test2_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME Stokes_test2_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+// Each application resets the transaction components twice: once for the
+// input vector and once to restore the components set up by
+// initializeOperatorState().  The input vectors are x0, x0, x1, x1, x0, so
+// that new schedules are only needed the first time that x1 is used.
+TEST(TEST_CASE_NAME, schedules_reused_by_repeated_applications)
+{
+    EXPECT_EQ(init_misses, 1);
+    const std::vector<int> expected_hits = { 2, 2, 1, 2, 2 };
+    const std::vector<int> expected_misses = { 0, 0, 1, 0, 0 };
+    ASSERT_EQ(num_hits.size(), expected_hits.size());
+    for (unsigned int k = 0; k < expected_hits.size(); ++k)
+    {
+        SCOPED_TRACE("application " + std::to_string(k));
+        EXPECT_EQ(num_hits[k], expected_hits[k]);
+        EXPECT_EQ(num_misses[k], expected_misses[k]);
+    }
+}
+
+TEST(TEST_CASE_NAME, equivalent_fill_patterns_share_schedules)
+{
+    EXPECT_EQ(equivalent_pattern_hits, 1);
+    EXPECT_EQ(equivalent_pattern_misses, 0);
+}
+
+TEST(TEST_CASE_NAME, different_fill_patterns_do_not_share_schedules)
+{
+    EXPECT_EQ(different_pattern_hits, 0);
+    EXPECT_EQ(different_pattern_misses, 1);
+}
+
+TEST(TEST_CASE_NAME, cached_results_match_uncached_results)
+{
+    EXPECT_LE(max_rel_diff, MAX_REL_DIFF);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc,
+                          ex_argv,
+                          init_misses,
+                          num_hits,
+                          num_misses,
+                          equivalent_pattern_hits,
+                          equivalent_pattern_misses,
+                          different_pattern_hits,
+                          different_pattern_misses,
+                          max_rel_diff);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,368 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <BoundaryBox.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeGeometry.h>
+#include <NodeVariable.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PhysicalBoundaryUtilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+#include <muParser.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This test checks that muParserCartGridFunction and muParserRobinBcCoefs,
+// which evaluate their expressions at all of the points of a patch or boundary
+// box with a single call to muParser's bulk Eval(), give the same values as
+// evaluating the expressions one point at a time with the scalar Eval().  The
+// reference values are computed by separate mu::Parser objects that use scalar
+// variables.  The data are set for several data centerings, boundary boxes of
+// several sizes, and two times, so that the arrays used for bulk evaluation are
+// reallocated between calls.  The test also checks that isTimeDependent()
+// only returns true for functions that use t or T.
+
+namespace
+{
+// Evaluates expressions one point at a time.
+class ScalarEvaluator
+{
+public:
+    explicit ScalarEvaluator(Pointer<Database> db)
+    {
+        const Array<std::string> key_names = db->getAllKeys();
+        for (int k = 0; k < key_names.size(); ++k)
+        {
+            if (db->isDouble(key_names[k])) d_constants[key_names[k]] = db->getDouble(key_names[k]);
+        }
+        return;
+    }
+
+    double eval(const std::string& expr, const double* const X, const double time)
+    {
+        if (!d_parsers.count(expr))
+        {
+            mu::Parser& parser = d_parsers[expr];
+            parser.SetExpr(expr);
+            parser.DefineConst("pi", M_PI);
+            for (const auto& constant : d_constants) parser.DefineConst(constant.first, constant.second);
+            parser.DefineVar("t", &d_time);
+            parser.DefineVar("T", &d_time);
+            for (unsigned int d = 0; d < NDIM; ++d) parser.DefineVar("X" + std::to_string(d), &d_posn[d]);
+        }
+        std::copy(X, X + NDIM, d_posn);
+        d_time = time;
+        return d_parsers[expr].Eval();
+    }
+
+private:
+    std::map<std::string, double> d_constants;
+    std::map<std::string, mu::Parser> d_parsers;
+    double d_posn[NDIM], d_time;
+};
+
+// Compute the position of the specified index, which is offset from the lower
+// corner of the cell with the same index by offset[d] grid cells.
+void
+get_posn(double* const X, const Patch<NDIM>& patch, const Index<NDIM>& i, const double* const offset)
+{
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const Index<NDIM>& patch_lower = patch.getBox().lower();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        X[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + offset[d]);
+    }
+    return;
+} // get_posn
+
+// Update the largest difference and the largest reference magnitude.
+void
+update_diff(double& max_diff, double& max_abs, const double val, const double ref_val)
+{
+    max_diff = std::max(max_diff, std::abs(val - ref_val));
+    max_abs = std::max(max_abs, std::abs(ref_val));
+    return;
+} // update_diff
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Upon return, entry c of grid_fcn_rel_diff holds the largest difference      *
+ * between the cell-, side-, and node-centered (c = 0, 1, 2) values set by     *
+ * muParserCartGridFunction and the scalar values, relative to the largest     *
+ * magnitude of the scalar values.  robin_rel_diff holds the same quantity for *
+ * the Robin coefficients set by muParserRobinBcCoefs, and num_bdry_boxes      *
+ * holds the number of boundary boxes at which they were compared.  Entry k of *
+ * time_dependent holds the value of isTimeDependent() for the k-th function   *
+ * listed in the input file.                                                   *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc,
+            char* argv[],
+            std::vector<double>& grid_fcn_rel_diff,
+            double& robin_rel_diff,
+            int& num_bdry_boxes,
+            std::vector<bool>& time_dependent)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "muParser.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const Array<double> times = input_db->getDoubleArray("TIMES");
+
+        // Create a single-level patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+
+        // Create the data.  The cell- and node-centered data have one component
+        // for each of the NDIM functions, and the side-centered data use
+        // function d on the sides normal to direction d.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc", NDIM);
+        Pointer<SideVariable<NDIM, double> > sc_var = new SideVariable<NDIM, double>("sc");
+        Pointer<NodeVariable<NDIM, double> > nc_var = new NodeVariable<NDIM, double>("nc", NDIM);
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, IntVector<NDIM>(0));
+        const int sc_idx = var_db->registerVariableAndContext(sc_var, ctx, IntVector<NDIM>(0));
+        const int nc_idx = var_db->registerVariableAndContext(nc_var, ctx, IntVector<NDIM>(0));
+        level->allocatePatchData(cc_idx, 0.0);
+        level->allocatePatchData(sc_idx, 0.0);
+        level->allocatePatchData(nc_idx, 0.0);
+
+        // Check which of the functions are time dependent.
+        Pointer<Database> fcn_db = app_initializer->getComponentDatabase("GridFunction");
+        const std::vector<std::string> fcn_db_names = { "GridFunction",
+                                                        "TimeIndependentFunction",
+                                                        "CapitalTimeFunction" };
+        time_dependent.clear();
+        for (const auto& name : fcn_db_names)
+        {
+            muParserCartGridFunction fcn(name, app_initializer->getComponentDatabase(name), grid_geometry);
+            time_dependent.push_back(fcn.isTimeDependent());
+        }
+
+        // Compare the values set by muParserCartGridFunction to the scalar
+        // values.  The data are set in order of increasing number of points
+        // per patch, so that the bulk evaluation arrays are reallocated.
+        muParserCartGridFunction grid_fcn("GridFunction", fcn_db, grid_geometry);
+        ScalarEvaluator grid_fcn_evaluator(fcn_db);
+        std::vector<std::string> fcn_strings(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d) fcn_strings[d] = fcn_db->getString("function_" + std::to_string(d));
+        std::vector<double> max_diff(3, 0.0), max_abs(3, 0.0);
+        for (int n = 0; n < times.size(); ++n)
+        {
+            const double time = times[n];
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                double X[NDIM], offset[NDIM];
+
+                grid_fcn.setDataOnPatch(cc_idx, cc_var, patch, time);
+                Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(cc_idx);
+                std::fill(offset, offset + NDIM, 0.5);
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    const CellIndex<NDIM> i(b());
+                    get_posn(X, *patch, i, offset);
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const double ref_val = grid_fcn_evaluator.eval(fcn_strings[d], X, time);
+                        update_diff(max_diff[0], max_abs[0], (*cc_data)(i, d), ref_val);
+                    }
+                }
+
+                grid_fcn.setDataOnPatch(sc_idx, sc_var, patch, time);
+                Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(sc_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d) offset[d] = d == axis ? 0.0 : 0.5;
+                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+                    {
+                        const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                        get_posn(X, *patch, i, offset);
+                        const double ref_val = grid_fcn_evaluator.eval(fcn_strings[axis], X, time);
+                        update_diff(max_diff[1], max_abs[1], (*sc_data)(i), ref_val);
+                    }
+                }
+
+                grid_fcn.setDataOnPatch(nc_idx, nc_var, patch, time);
+                Pointer<NodeData<NDIM, double> > nc_data = patch->getPatchData(nc_idx);
+                std::fill(offset, offset + NDIM, 0.0);
+                for (Box<NDIM>::Iterator b(NodeGeometry<NDIM>::toNodeBox(patch_box)); b; b++)
+                {
+                    const NodeIndex<NDIM> i(b(), IntVector<NDIM>(0));
+                    get_posn(X, *patch, i, offset);
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const double ref_val = grid_fcn_evaluator.eval(fcn_strings[d], X, time);
+                        update_diff(max_diff[2], max_abs[2], (*nc_data)(i, d), ref_val);
+                    }
+                }
+            }
+        }
+        grid_fcn_rel_diff.resize(3);
+        for (int c = 0; c < 3; ++c)
+        {
+            grid_fcn_rel_diff[c] =
+                SAMRAI_MPI::maxReduction(max_diff[c]) / std::max(SAMRAI_MPI::maxReduction(max_abs[c]), 1.0);
+        }
+
+        // Compare the coefficients set by muParserRobinBcCoefs to the scalar
+        // values.  At each boundary box, the coefficients are set on a single
+        // point, on the boundary box, and on the boundary box extended past the
+        // patch, so that the bulk evaluation arrays are reallocated.
+        Pointer<Database> bc_db = app_initializer->getComponentDatabase("RobinBcCoefs");
+        muParserRobinBcCoefs bc_coefs("RobinBcCoefs", bc_db, grid_geometry);
+        const Pointer<Variable<NDIM> > bc_var = sc_var;
+        ScalarEvaluator bc_coef_evaluator(bc_db);
+        double robin_max_diff = 0.0, robin_max_abs = 0.0;
+        num_bdry_boxes = 0;
+        for (int n = 0; n < times.size(); ++n)
+        {
+            const double time = times[n];
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Array<BoundaryBox<NDIM> > bdry_boxes =
+                    PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+                for (int k = 0; k < bdry_boxes.size(); ++k)
+                {
+                    const BoundaryBox<NDIM>& bdry_box = bdry_boxes[k];
+                    const int location_index = bdry_box.getLocationIndex();
+                    const unsigned int bdry_normal_axis = location_index / 2;
+                    const std::string postfix = "_function_" + std::to_string(location_index);
+                    const std::array<std::string, 3> coef_strings = { { bc_db->getString("acoef" + postfix),
+                                                                        bc_db->getString("bcoef" + postfix),
+                                                                        bc_db->getString("gcoef" + postfix) } };
+                    const Box<NDIM> side_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(bdry_box);
+                    Box<NDIM> extended_box = side_box;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (d == bdry_normal_axis) continue;
+                        extended_box.lower(d) -= 2;
+                        extended_box.upper(d) += 2;
+                    }
+                    double X[NDIM], offset[NDIM];
+                    for (unsigned int d = 0; d < NDIM; ++d) offset[d] = d == bdry_normal_axis ? 0.0 : 0.5;
+                    for (const Box<NDIM>& bc_coef_box :
+                         { Box<NDIM>(side_box.lower(), side_box.lower()), side_box, extended_box })
+                    {
+                        std::array<Pointer<ArrayData<NDIM, double> >, 3> coef_data;
+                        for (auto& data : coef_data) data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                        bc_coefs.setBcCoefs(coef_data[0], coef_data[1], coef_data[2], bc_var, *patch, bdry_box, time);
+                        for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+                        {
+                            const Index<NDIM>& i = b();
+                            get_posn(X, *patch, i, offset);
+                            for (unsigned int l = 0; l < coef_strings.size(); ++l)
+                            {
+                                const double ref_val = bc_coef_evaluator.eval(coef_strings[l], X, time);
+                                update_diff(robin_max_diff, robin_max_abs, (*coef_data[l])(i, 0), ref_val);
+                            }
+                        }
+                    }
+                    ++num_bdry_boxes;
+                }
+            }
+        }
+        robin_rel_diff =
+            SAMRAI_MPI::maxReduction(robin_max_diff) / std::max(SAMRAI_MPI::maxReduction(robin_max_abs), 1.0);
+        num_bdry_boxes = SAMRAI_MPI::sumReduction(num_bdry_boxes);
+
+        pout << "cell difference = " << grid_fcn_rel_diff[0] << ", side difference = " << grid_fcn_rel_diff[1]
+             << ", node difference = " << grid_fcn_rel_diff[2] << ", Robin coefficient difference = " << robin_rel_diff
+             << "\n";
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
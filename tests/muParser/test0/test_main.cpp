@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "example.cpp"
+#include <vector>
+
+int ex_argc;
+char** ex_argv;
+bool ex_runs;
+std::vector<double> grid_fcn_rel_diff;
+double robin_rel_diff;
+int num_bdry_boxes;
+std::vector<bool> time_dependent;
+
+// The bulk and scalar evaluations use the same expressions at the same
+// positions, so that the results agree up to round-off.
+static const double MAX_REL_DIFF = 1.0e-12;
+
+// Set names of test based on if compiled with 2D or 3D libraries
+#if (NDIM == 2)
+#define TEST_CASE_NAME muParser_test0_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME muParser_test0_3d
+#endif
+
+TEST(TEST_CASE_NAME, example_runs)
+{
+    EXPECT_TRUE(ex_runs);
+}
+
+TEST(TEST_CASE_NAME, grid_function_matches_scalar_eval)
+{
+    static const char* const centerings[] = { "cell", "side", "node" };
+    ASSERT_EQ(grid_fcn_rel_diff.size(), 3u);
+    for (unsigned int c = 0; c < grid_fcn_rel_diff.size(); ++c)
+    {
+        SCOPED_TRACE(centerings[c]);
+        EXPECT_LE(grid_fcn_rel_diff[c], MAX_REL_DIFF);
+    }
+}
+
+TEST(TEST_CASE_NAME, robin_coefs_match_scalar_eval)
+{
+    EXPECT_GT(num_bdry_boxes, 0);
+    EXPECT_LE(robin_rel_diff, MAX_REL_DIFF);
+}
+
+// The functions in the input file use t, neither t nor T, and T.
+TEST(TEST_CASE_NAME, time_dependence)
+{
+    ASSERT_EQ(time_dependent.size(), 3u);
+    EXPECT_TRUE(time_dependent[0]);
+    EXPECT_FALSE(time_dependent[1]);
+    EXPECT_TRUE(time_dependent[2]);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ex_argc = argc;
+    ex_argv = argv;
+    ex_runs = run_example(ex_argc, ex_argv, grid_fcn_rel_diff, robin_rel_diff, num_bdry_boxes, time_dependent);
+    return RUN_ALL_TESTS();
+}